@@ -13,7 +13,7 @@
 #include <vector>
 
 #include "misc/utils.h"
-#include "2d/Vector2D.h"
+#include "2D/Vector2D.h"
 
 
 
@@ -10,7 +10,9 @@
 //
 //------------------------------------------------------------------------
 #include <math.h>
+#ifndef HEADLESS
 #include <windows.h>
+#endif
 #include <iosfwd>
 #include <limits>
 #include "misc/utils.h"
@@ -299,6 +301,8 @@ inline double Vec2DLengthSq(const Vector2D& v)
 }
 
 
+#ifndef HEADLESS
+
 inline Vector2D POINTStoVector(const POINTS& p)
 {
   return Vector2D(p.x, p.y);
@@ -327,6 +331,8 @@ inline POINT VectorToPOINT(const Vector2D& v)
   return p;
 }
 
+#endif //HEADLESS
+
 
 
 //------------------------------------------------------------------------operator overloads
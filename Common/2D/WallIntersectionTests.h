@@ -8,8 +8,8 @@
 //          walls
 //-----------------------------------------------------------------------------
 
-#include "2d/Vector2D.h"
-#include "2d/Wall2d.h"
+#include "2D/Vector2D.h"
+#include "2D/Wall2D.h"
 
 
 //----------------------- doWallsObstructLineSegment --------------------------
@@ -24,7 +24,7 @@ inline bool doWallsObstructLineSegment(Vector2D from,
                                        const ContWall& walls)
 {
   //test against the walls
-  ContWall::const_iterator curWall = walls.begin();
+  typename ContWall::const_iterator curWall = walls.begin();
 
   for (curWall; curWall != walls.end(); ++curWall)
   {
@@ -94,7 +94,7 @@ inline bool FindClosestPointOfIntersectionWithWalls(Vector2D        A,
 {
   distance = MaxDouble;
 
-  ContWall::const_iterator curWall = walls.begin();
+  typename ContWall::const_iterator curWall = walls.begin();
   for (curWall; curWall != walls.end(); ++curWall)
   {
     double dist = 0.0;
@@ -115,6 +115,36 @@ inline bool FindClosestPointOfIntersectionWithWalls(Vector2D        A,
   return false;
 }
 
+//---------------------------- DistanceToWalls --------------------------------
+//
+//  returns the shortest distance between the line segment AB and the walls,
+//  0 if a wall crosses it and MaxDouble if there are no walls
+//-----------------------------------------------------------------------------
+template <class ContWall>
+inline double DistanceToWalls(Vector2D A, Vector2D B, const ContWall& walls)
+{
+  double ClosestSoFar = MaxDouble;
+
+  typename ContWall::const_iterator curWall = walls.begin();
+
+  for (curWall; curWall != walls.end(); ++curWall)
+  {
+    Vector2D C = (*curWall)->From();
+    Vector2D D = (*curWall)->To();
+
+    if (LineIntersection2D(A, B, C, D)) return 0;
+
+    //else the closest points of two segments which do not cross include
+    //an end of one of them
+    ClosestSoFar = MinOf(ClosestSoFar, DistToLineSegment(A, B, C));
+    ClosestSoFar = MinOf(ClosestSoFar, DistToLineSegment(A, B, D));
+    ClosestSoFar = MinOf(ClosestSoFar, DistToLineSegment(C, D, A));
+    ClosestSoFar = MinOf(ClosestSoFar, DistToLineSegment(C, D, B));
+  }
+
+  return ClosestSoFar;
+}
+
 //------------------------ doWallsIntersectCircle -----------------------------
 //
 //  returns true if any walls intersect the circle of radius at point p
@@ -123,7 +153,7 @@ template <class ContWall>
 inline bool doWallsIntersectCircle(const ContWall& walls, Vector2D p, double r)
 {
   //test against the walls
-  ContWall::const_iterator curWall = walls.begin();
+  typename ContWall::const_iterator curWall = walls.begin();
 
   for (curWall; curWall != walls.end(); ++curWall)
   {
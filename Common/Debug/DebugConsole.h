@@ -18,11 +18,23 @@
 //
 //------------------------------------------------------------------------
 #include <vector>
-#include <windows.h>
 #include <iosfwd>
 #include <fstream>
 
 #include "misc/utils.h"
+
+//when HEADLESS is defined there is no console window: everything sent to
+//debug_con goes to the sink
+#ifdef HEADLESS
+
+#define debug_con *(CSink::Instance())
+
+#define debug_on
+#define debug_off
+
+#else
+
+#include <windows.h>
 #include "misc/WindowUtils.h"
 
 
@@ -49,6 +61,8 @@ const int DEBUG_WINDOW_HEIGHT = 400;
 #define debug_on  DebugConsole::On();
 #define debug_off DebugConsole::Off();
 
+#endif //HEADLESS
+
 
 //this little class just acts as a sink for any input. Used in place
 //of the DebugConsole class when the console is not required
@@ -75,6 +89,8 @@ public:
 
 
 
+#ifndef HEADLESS
+
 class DebugConsole
 {
 private:
@@ -174,6 +190,8 @@ public:
   }
 };
 
+#endif //HEADLESS
+
  
 
 #endif
\ No newline at end of file
@@ -15,7 +15,7 @@
 #include <string>
 #include <iosfwd>
 #include "2D/Vector2D.h"
-#include "2D/Geometry.h"
+#include "2D/geometry.h"
 #include "misc/utils.h"
 
 
@@ -40,10 +40,6 @@ private:
   //this is a generic flag. 
   bool        m_bTag;
 
-  //this is the next valid ID. Each time a BaseGameEntity is instantiated
-  //this value is updated
-  static int  m_iNextValidID;
-
   //this must be called within each constructor to make sure the ID is set
   //correctly. It verifies that the value passed to the method is greater
   //or equal to the next valid ID, before setting the ID and incrementing
@@ -78,11 +74,12 @@ public:
   virtual void Write(std::ostream&  os)const{}
   virtual void Read (std::ifstream& is){}
 
-  //use this to grab the next valid ID
-  static int   GetNextValidID(){return m_iNextValidID;}
+  //use this to grab the next valid ID. The sequence belongs to the
+  //entity manager of the current world
+  static int   GetNextValidID();
   
   //this can be used to reset the next ID
-  static void  ResetNextValidID(){m_iNextValidID = 0;}
+  static void  ResetNextValidID();
   
 
 
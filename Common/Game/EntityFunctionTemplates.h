@@ -1,8 +1,8 @@
 #ifndef GAME_ENTITY_FUNCTION_TEMPLATES
 #define GAME_ENTITY_FUNCTION_TEMPLATES
 
-#include "game/BaseGameEntity.h"
-#include "2d/geometry.h"
+#include "Game/BaseGameEntity.h"
+#include "2D/geometry.h"
 
 
 
@@ -1,13 +1,17 @@
-#include "game/EntityManager.h"
-#include "game/BaseGameEntity.h"
+#include "Game/EntityManager.h"
+#include "Game/BaseGameEntity.h"
 
 
+thread_local EntityManager* EntityManager::m_pThreadInstance = NULL;
+
 //--------------------------- Instance ----------------------------------------
 //
-//   this class is a singleton
+//   this class is a singleton (one per world when worlds are used)
 //-----------------------------------------------------------------------------
 EntityManager* EntityManager::Instance()
 {
+  if (m_pThreadInstance) return m_pThreadInstance;
+
   static EntityManager instance;
 
   return &instance;
@@ -33,7 +33,18 @@ private:
   //pointers to entities are cross referenced by their identifying number
   EntityMap m_EntityMap;
 
-  EntityManager(){}
+  //the ID the next entity created should be given. Kept here rather than
+  //in BaseGameEntity so that every world has its own sequence of IDs
+  int       m_iNextValidID;
+
+  //when set, the instance returned by Instance() for the calling thread.
+  //A WorldContext points this at its own entity manager so that several
+  //worlds can be simulated side by side on different threads
+  static thread_local EntityManager* m_pThreadInstance;
+
+  friend class WorldContext;
+
+  EntityManager():m_iNextValidID(0){}
 
   //copy ctor and assignment should be private
   EntityManager(const EntityManager&);
@@ -56,6 +67,9 @@ public:
 
   //clears all entities from the entity map
   void            Reset(){m_EntityMap.clear();}
+
+  int             GetNextValidID()const{return m_iNextValidID;}
+  void            SetNextValidID(int id){m_iNextValidID = id;}
 };
 
 
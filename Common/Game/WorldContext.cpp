@@ -0,0 +1,44 @@
+#include "Game/WorldContext.h"
+
+
+thread_local WorldContext* WorldContext::m_pCurrent = 0;
+
+
+//------------------------------ dtor -----------------------------------------
+//-----------------------------------------------------------------------------
+WorldContext::~WorldContext()
+{
+  //make sure the thread is not left pointing at a destroyed world
+  if (isCurrent()) WorldContext::Release();
+}
+
+//--------------------------- MakeCurrent -------------------------------------
+//-----------------------------------------------------------------------------
+void WorldContext::MakeCurrent()
+{
+  EntityManager::m_pThreadInstance     = &m_EntityMgr;
+  MessageDispatcher::m_pThreadInstance = &m_Dispatcher;
+  CrudeTimer::m_pThreadInstance        = &m_Clock;
+  FrameCounter::m_pThreadInstance      = &m_TickCounter;
+
+  m_pCurrent = this;
+}
+
+//----------------------------- Release ---------------------------------------
+//-----------------------------------------------------------------------------
+void WorldContext::Release()
+{
+  EntityManager::m_pThreadInstance     = 0;
+  MessageDispatcher::m_pThreadInstance = 0;
+  CrudeTimer::m_pThreadInstance        = 0;
+  FrameCounter::m_pThreadInstance      = 0;
+
+  m_pCurrent = 0;
+}
+
+//---------------------------- isCurrent --------------------------------------
+//-----------------------------------------------------------------------------
+bool WorldContext::isCurrent()const
+{
+  return EntityManager::m_pThreadInstance == &m_EntityMgr;
+}
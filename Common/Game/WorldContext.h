@@ -0,0 +1,71 @@
+#ifndef WORLD_CONTEXT_H
+#define WORLD_CONTEXT_H
+//------------------------------------------------------------------------
+//
+//  Name:   WorldContext.h
+//
+//  Desc:   the state a simulated world would otherwise share with every
+//          other world through the singletons: its entity manager (and so
+//          its sequence of entity IDs), its message dispatcher, its clock
+//          and its frame counter.
+//
+//          Once MakeCurrent has been called, EntityMgr, Dispatcher, Clock
+//          and TickCounter refer to this world's objects for the calling
+//          thread only. Each thread can therefore run a world of its own
+//          without any locking, as long as a world is only ever updated by
+//          the thread it is current on. Threads which have no current world
+//          keep using the usual global instances.
+//
+//          Derive from this class to add game specific singletons
+//          (overriding MakeCurrent and Release)
+//
+//          A world may also be made current on several threads at once to
+//          let them share work which only reads the world (see
+//          Raven_Game::Update)
+//
+//------------------------------------------------------------------------
+#include "Game/EntityManager.h"
+#include "Messaging/MessageDispatcher.h"
+#include "Time/CrudeTimer.h"
+#include "misc/FrameCounter.h"
+
+
+class WorldContext
+{
+private:
+
+  EntityManager     m_EntityMgr;
+  MessageDispatcher m_Dispatcher;
+  CrudeTimer        m_Clock;
+  FrameCounter      m_TickCounter;
+
+  //the world bound to each thread (NULL if none)
+  static thread_local WorldContext* m_pCurrent;
+
+  //copy ctor and assignment should be private
+  WorldContext(const WorldContext&);
+  WorldContext& operator=(const WorldContext&);
+
+public:
+
+  WorldContext(){}
+
+  virtual ~WorldContext();
+
+  //binds this world to the calling thread
+  virtual void MakeCurrent();
+
+  //the calling thread goes back to the global instances
+  virtual void Release();
+
+  //true if this world is the one bound to the calling thread
+  bool         isCurrent()const;
+
+  //the world bound to the calling thread, or NULL if it uses the global
+  //instances
+  static WorldContext* Current(){return m_pCurrent;}
+};
+
+
+
+#endif
@@ -10,8 +10,9 @@
 //-----------------------------------------------------------------------------
 
 struct Telegram;
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 #include "misc/TypeToString.h"
+#include "GoalArena.h"
 
 
 
@@ -55,6 +56,16 @@ public:
 
   virtual ~Goal(){}
 
+  //goals are usually created in their owner's arena, with
+  //  new (arena) Goal_X(...)
+  //so that replanning reuses the memory of the goals it replaces. Goals
+  //created with a plain new come from the heap. Either kind is deleted
+  //as usual
+  static void* operator new(size_t size){return GoalArena::AllocateFromHeap(size);}
+  static void* operator new(size_t size, GoalArena& arena){return arena.Allocate(size);}
+  static void  operator delete(void* p){GoalArena::Free(p);}
+  static void  operator delete(void* p, GoalArena&){GoalArena::Free(p);}
+
   //logic to run when the goal is activated.
   virtual void Activate() = 0;
 
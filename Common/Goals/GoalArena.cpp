@@ -0,0 +1,111 @@
+#include "GoalArena.h"
+
+#include <cassert>
+#include <new>
+
+
+//---------------------------- ctor -------------------------------------------
+//-----------------------------------------------------------------------------
+GoalArena::GoalArena():m_iNumAllocated(0)
+{
+  for (int s=0; s<NumSizeClasses; ++s) m_FreeLists[s] = 0;
+}
+
+//---------------------------- dtor -------------------------------------------
+//-----------------------------------------------------------------------------
+GoalArena::~GoalArena()
+{
+  assert(m_iNumAllocated == 0 && "<GoalArena::~GoalArena>: goals are still allocated");
+
+  for (unsigned int c=0; c<m_Chunks.size(); ++c)
+  {
+    ::operator delete(m_Chunks[c]);
+  }
+}
+
+//---------------------------- AddChunk ---------------------------------------
+//
+//  carves a new chunk into blocks of the given size and puts them on its
+//  free list
+//-----------------------------------------------------------------------------
+void GoalArena::AddChunk(int SizeClass)
+{
+  const std::size_t stride = sizeof(Header) + (SizeClass+1) * BlockGranularity;
+
+  char* pChunk = static_cast<char*>(::operator new(stride * BlocksPerChunk));
+
+  m_Chunks.push_back(pChunk);
+
+  for (int b=BlocksPerChunk-1; b>=0; --b)
+  {
+    Header* pHeader = reinterpret_cast<Header*>(pChunk + b*stride);
+
+    pHeader->pArena    = this;
+    pHeader->SizeClass = SizeClass;
+
+    FreeBlock* pBlock = reinterpret_cast<FreeBlock*>(pHeader + 1);
+
+    pBlock->pNext = m_FreeLists[SizeClass];
+
+    m_FreeLists[SizeClass] = pBlock;
+  }
+}
+
+//---------------------------- Allocate ---------------------------------------
+//-----------------------------------------------------------------------------
+void* GoalArena::Allocate(std::size_t size)
+{
+  const int SizeClass = size == 0 ? 0 : (int)((size - 1) / BlockGranularity);
+
+  if (SizeClass >= NumSizeClasses) return AllocateFromHeap(size);
+
+  if (!m_FreeLists[SizeClass]) AddChunk(SizeClass);
+
+  FreeBlock* pBlock = m_FreeLists[SizeClass];
+
+  m_FreeLists[SizeClass] = pBlock->pNext;
+
+  ++m_iNumAllocated;
+
+  return pBlock;
+}
+
+//------------------------- AllocateFromHeap ----------------------------------
+//-----------------------------------------------------------------------------
+void* GoalArena::AllocateFromHeap(std::size_t size)
+{
+  Header* pHeader = static_cast<Header*>(::operator new(sizeof(Header) + size));
+
+  pHeader->pArena    = 0;
+  pHeader->SizeClass = -1;
+
+  return pHeader + 1;
+}
+
+//---------------------------- Free -------------------------------------------
+//-----------------------------------------------------------------------------
+void GoalArena::Free(void* p)
+{
+  if (!p) return;
+
+  Header* pHeader = static_cast<Header*>(p) - 1;
+
+  GoalArena* pArena = pHeader->pArena;
+
+  if (!pArena)
+  {
+    ::operator delete(pHeader);
+
+    return;
+  }
+
+  assert(pArena->m_iNumAllocated > 0 && "<GoalArena::Free>: block freed twice");
+
+  FreeBlock* pBlock = static_cast<FreeBlock*>(p);
+
+  pBlock->pNext = pArena->m_FreeLists[pHeader->SizeClass];
+
+  pArena->m_FreeLists[pHeader->SizeClass] = pBlock;
+
+  --pArena->m_iNumAllocated;
+}
@@ -0,0 +1,87 @@
+#ifndef GOAL_ARENA_H
+#define GOAL_ARENA_H
+//------------------------------------------------------------------------
+//
+//  Name:   GoalArena.h
+//
+//  Desc:   memory for the goals of one entity. Blocks are grouped by size
+//          in steps of BlockGranularity bytes and a freed block goes back
+//          on the free list of its size, so once an entity has built its
+//          largest goal trees replanning reuses the blocks of the goals it
+//          replaces instead of going to the heap.
+//
+//          Each block starts with a header naming the arena it came from,
+//          so a goal can be freed without knowing its owner. Goals larger
+//          than the largest size, and goals created without an arena, are
+//          allocated on the heap with a header naming no arena.
+//
+//          an arena is not thread safe. It is meant to be used only by
+//          whoever is updating its entity.
+//
+//------------------------------------------------------------------------
+#include <cstddef>
+#include <vector>
+
+
+class GoalArena
+{
+private:
+
+  enum
+  {
+    BlockGranularity = 16,
+    NumSizeClasses   = 16,
+
+    //the number of blocks of a size carved out of the heap at once
+    BlocksPerChunk   = 16
+  };
+
+  //kept in front of each block. It is as aligned as anything new returns
+  //so the goal behind it is too
+  struct alignas(std::max_align_t) Header
+  {
+    GoalArena* pArena;
+    int        SizeClass;
+  };
+
+  struct FreeBlock
+  {
+    FreeBlock* pNext;
+  };
+
+  FreeBlock*          m_FreeLists[NumSizeClasses];
+
+  //the memory carved into blocks, freed with the arena
+  std::vector<void*>  m_Chunks;
+
+  //the number of blocks handed out and not yet freed
+  int                 m_iNumAllocated;
+
+  void AddChunk(int SizeClass);
+
+  //no copies
+  GoalArena(const GoalArena&);
+  GoalArena& operator=(const GoalArena&);
+
+public:
+
+  GoalArena();
+
+  //every goal allocated from the arena must have been freed
+  ~GoalArena();
+
+  void*        Allocate(std::size_t size);
+
+  //a block from the heap, freed by Free like any other
+  static void* AllocateFromHeap(std::size_t size);
+
+  //returns a block to the arena it came from, or to the heap
+  static void  Free(void* p);
+
+  int          NumAllocated()const{return m_iNumAllocated;}
+  int          NumChunks()const{return (int)m_Chunks.size();}
+};
+
+
+
+#endif
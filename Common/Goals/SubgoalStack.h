@@ -0,0 +1,115 @@
+#ifndef SUBGOAL_STACK_H
+#define SUBGOAL_STACK_H
+//-----------------------------------------------------------------------------
+//
+//  Name:   SubgoalStack.h
+//
+//  Desc:   the subgoals of a composite goal. It has the part of the
+//          interface of std::list the goals use, but keeps the pointers in
+//          an array with the front goal last, so adding and removing at the
+//          front, which is what the goals mostly do, costs nothing. The
+//          first InlineCapacity pointers are kept in the stack itself; only
+//          a composite given more subgoals than that goes to the heap, once.
+//
+//          iteration goes from the front goal to the back one, as with the
+//          list.
+//-----------------------------------------------------------------------------
+#include <cassert>
+#include <cstring>
+#include <iterator>
+
+
+template <class goal_type, int InlineCapacity = 4>
+class SubgoalStack
+{
+public:
+
+  typedef goal_type                           value_type;
+
+  //the front goal is the last in the array, so walking from the front is
+  //walking the array backwards
+  typedef std::reverse_iterator<goal_type*>        iterator;
+  typedef std::reverse_iterator<const goal_type*>  const_iterator;
+  typedef goal_type*                               reverse_iterator;
+  typedef const goal_type*                         const_reverse_iterator;
+
+private:
+
+  goal_type   m_Inline[InlineCapacity];
+
+  //m_Inline or, once the stack has outgrown it, an array on the heap
+  goal_type*  m_pGoals;
+
+  int         m_iSize;
+  int         m_iCapacity;
+
+  void Grow()
+  {
+    goal_type* pGoals = new goal_type[m_iCapacity * 2];
+
+    memcpy(pGoals, m_pGoals, m_iSize * sizeof(goal_type));
+
+    if (m_pGoals != m_Inline) delete [] m_pGoals;
+
+    m_pGoals     = pGoals;
+    m_iCapacity *= 2;
+  }
+
+  //no copies
+  SubgoalStack(const SubgoalStack&);
+  SubgoalStack& operator=(const SubgoalStack&);
+
+public:
+
+  SubgoalStack():m_pGoals(m_Inline),
+                 m_iSize(0),
+                 m_iCapacity(InlineCapacity)
+  {}
+
+  ~SubgoalStack(){if (m_pGoals != m_Inline) delete [] m_pGoals;}
+
+  bool       empty()const{return m_iSize == 0;}
+  int        size()const{return m_iSize;}
+
+  goal_type& front(){assert(m_iSize > 0); return m_pGoals[m_iSize-1];}
+  goal_type  front()const{assert(m_iSize > 0); return m_pGoals[m_iSize-1];}
+  goal_type& back(){assert(m_iSize > 0); return m_pGoals[0];}
+  goal_type  back()const{assert(m_iSize > 0); return m_pGoals[0];}
+
+  void push_front(goal_type g)
+  {
+    if (m_iSize == m_iCapacity) Grow();
+
+    m_pGoals[m_iSize++] = g;
+  }
+
+  void pop_front(){assert(m_iSize > 0); --m_iSize;}
+
+  //slides every goal along, but goals are seldom queued
+  void push_back(goal_type g)
+  {
+    if (m_iSize == m_iCapacity) Grow();
+
+    memmove(m_pGoals+1, m_pGoals, m_iSize * sizeof(goal_type));
+
+    m_pGoals[0] = g;
+
+    ++m_iSize;
+  }
+
+  //keeps the memory for the next goals
+  void clear(){m_iSize = 0;}
+
+  iterator               begin(){return iterator(m_pGoals + m_iSize);}
+  iterator               end(){return iterator(m_pGoals);}
+  const_iterator         begin()const{return const_iterator(m_pGoals + m_iSize);}
+  const_iterator         end()const{return const_iterator(m_pGoals);}
+
+  reverse_iterator       rbegin(){return m_pGoals;}
+  reverse_iterator       rend(){return m_pGoals + m_iSize;}
+  const_reverse_iterator rbegin()const{return m_pGoals;}
+  const_reverse_iterator rend()const{return m_pGoals + m_iSize;}
+};
+
+
+#endif
@@ -28,6 +28,28 @@ public:
   }
 };
 
+//-----------------------------------------------------------------------------
+//the euclidian heuristic shaved by a thousandth. The edge costs read from
+//map files are rounded, so can be a hair under the straight-line distance.
+//Searches which never reopen a node, or which stop or give up on the
+//strength of the heuristic, rely on it never being more than the cost of
+//an edge between the nodes, so they need this on such graphs
+//-----------------------------------------------------------------------------
+class Heuristic_ShavedEuclid
+{
+public:
+
+  Heuristic_ShavedEuclid(){}
+
+  //calculate the straight line distance from node nd1 to node nd2, less a
+  //thousandth
+  template <class graph_type>
+  static double Calculate(const graph_type& G, int nd1, int nd2)
+  {
+    return 0.999 * Vec2DDistance(G.GetNode(nd1).Pos(), G.GetNode(nd2).Pos());
+  }
+};
+
 //-----------------------------------------------------------------------------
 //this uses the euclidian distance but adds in an amount of noise to the 
 //result. You can use this heuristic to provide imperfect paths. This can
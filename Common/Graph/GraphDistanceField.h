@@ -0,0 +1,311 @@
+#ifndef GRAPH_DISTANCE_FIELD_H
+#define GRAPH_DISTANCE_FIELD_H
+#pragma warning (disable:4786)
+//-----------------------------------------------------------------------------
+//
+//  Name:   GraphDistanceField.h
+//
+//  Desc:   the cost of travelling from every node of a graph to the nearest
+//          of a set of source nodes, and the first edge of the way there.
+//          It is the shortest path tree of a Dijkstra search run backwards
+//          from all the sources at once, so the path from any node to its
+//          nearest source is found by following the edges, one per node.
+//
+//          sources can be added and removed and edge costs changed. Adding
+//          a source only searches the nodes that are now nearer to it than
+//          to any other, and removing one, or changing the cost of an edge
+//          some ways go through, only searches the nodes whose way led
+//          through it.
+//
+//          the field keeps pointers to the graph's edges. It must be made
+//          again if edges are added to or removed from the graph.
+//-----------------------------------------------------------------------------
+#include <vector>
+#include <cassert>
+
+#include "misc/PriorityQueue.h"
+#include "misc/utils.h"
+
+
+template <class graph_type>
+class GraphDistanceField
+{
+public:
+
+  typedef typename graph_type::EdgeType Edge;
+
+private:
+
+  const graph_type&               m_Graph;
+
+  //indexed by node. The edges leading into each node
+  std::vector<std::vector<const Edge*> > m_InEdges;
+
+  //indexed by node. The cost to the nearest source, MaxDouble if no source
+  //can be reached
+  std::vector<double>             m_Costs;
+
+  //indexed by node. The first edge of the way to the nearest source, NULL
+  //at a source or if no source can be reached
+  std::vector<const Edge*>        m_NextEdge;
+
+  //indexed by node. How many times the node has been added as a source
+  std::vector<int>                m_NumSources;
+
+  //used while searching
+  std::vector<char>               m_bQueued;
+  std::vector<char>               m_bAffected;
+  std::vector<int>                m_Affected;
+
+  IndexedPriorityQLow<double>*    m_pPQ;
+
+  //puts a node on the queue or, if it is on it already, moves it up
+  void Queue(int nd)
+  {
+    if (m_bQueued[nd])
+    {
+      m_pPQ->ChangePriority(nd);
+    }
+    else
+    {
+      m_pPQ->insert(nd);
+
+      m_bQueued[nd] = true;
+    }
+  }
+
+  //searches backwards from the queued nodes until the queue is empty
+  void Propagate();
+
+  //the nodes whose way leads through nd, nd among them, lose their costs.
+  //Each of them which is next to a node that kept its cost is given the
+  //cheapest way through such a neighbor and queued
+  void Reroute(int nd);
+
+  //no copies. The queue indexes into m_Costs
+  GraphDistanceField(const GraphDistanceField&);
+  GraphDistanceField& operator=(const GraphDistanceField&);
+
+public:
+
+  GraphDistanceField(const graph_type& G);
+
+  ~GraphDistanceField(){delete m_pPQ;}
+
+  void        AddSource(int nd);
+  void        RemoveSource(int nd);
+
+  //to be called after the cost of the edge from one node to another has
+  //been changed
+  void        EdgeCostChanged(int from, int to);
+
+  //removes every source
+  void        Clear();
+
+  bool        isSource(int nd)const{return m_NumSources[nd] > 0;}
+  bool        isReachable(int nd)const{return m_Costs[nd] < MaxDouble;}
+
+  double      Cost(int nd)const{return m_Costs[nd];}
+  const Edge* NextEdge(int nd)const{return m_NextEdge[nd];}
+};
+
+
+//---------------------------- ctor -------------------------------------------
+//-----------------------------------------------------------------------------
+template <class graph_type>
+GraphDistanceField<graph_type>::GraphDistanceField(const graph_type& G):m_Graph(G),
+                                                 m_InEdges(G.NumNodes()),
+                                                 m_Costs(G.NumNodes(), MaxDouble),
+                                                 m_NextEdge(G.NumNodes(), (const Edge*)NULL),
+                                                 m_NumSources(G.NumNodes(), 0),
+                                                 m_bQueued(G.NumNodes(), false),
+                                                 m_bAffected(G.NumNodes(), false)
+{
+  m_pPQ = new IndexedPriorityQLow<double>(m_Costs, G.NumNodes());
+
+  typename graph_type::ConstNodeIterator NodeItr(G);
+  for (const typename graph_type::NodeType* pN=NodeItr.begin();
+       !NodeItr.end();
+       pN=NodeItr.next())
+  {
+    typename graph_type::ConstEdgeIterator EdgeItr(G, pN->Index());
+    for (const Edge* pE=EdgeItr.begin(); !EdgeItr.end(); pE=EdgeItr.next())
+    {
+      m_InEdges[pE->To()].push_back(pE);
+    }
+  }
+}
+
+//---------------------------- AddSource --------------------------------------
+//-----------------------------------------------------------------------------
+template <class graph_type>
+void GraphDistanceField<graph_type>::AddSource(int nd)
+{
+  assert (nd >= 0 && nd < (int)m_Costs.size() &&
+          "<GraphDistanceField::AddSource>: invalid index");
+
+  if (m_NumSources[nd]++ > 0) return;
+
+  m_Costs[nd]    = 0;
+  m_NextEdge[nd] = NULL;
+
+  Queue(nd);
+
+  Propagate();
+}
+
+//---------------------------- RemoveSource -----------------------------------
+//-----------------------------------------------------------------------------
+template <class graph_type>
+void GraphDistanceField<graph_type>::RemoveSource(int nd)
+{
+  assert (m_NumSources[nd] > 0 && "<GraphDistanceField::RemoveSource>: not a source");
+
+  if (--m_NumSources[nd] > 0) return;
+
+  Reroute(nd);
+
+  Propagate();
+}
+
+//--------------------------- EdgeCostChanged ---------------------------------
+//
+//  if the edge is on the way from its from node the nodes whose way goes
+//  through it are given new ways. Else it can only have made a cheaper way
+//  for the from node
+//-----------------------------------------------------------------------------
+template <class graph_type>
+void GraphDistanceField<graph_type>::EdgeCostChanged(int from, int to)
+{
+  const std::vector<const Edge*>& in = m_InEdges[to];
+
+  for (unsigned int e=0; e<in.size(); ++e)
+  {
+    if (in[e]->From() != from) continue;
+
+    if (m_NextEdge[from] == in[e])
+    {
+      Reroute(from);
+    }
+
+    else if (isReachable(to) && m_Costs[to] + in[e]->Cost() < m_Costs[from])
+    {
+      m_Costs[from]    = m_Costs[to] + in[e]->Cost();
+      m_NextEdge[from] = in[e];
+
+      Queue(from);
+    }
+
+    Propagate();
+
+    return;
+  }
+}
+
+//------------------------------- Reroute -------------------------------------
+//-----------------------------------------------------------------------------
+template <class graph_type>
+void GraphDistanceField<graph_type>::Reroute(int nd)
+{
+  //gather the nodes whose way leads through nd, walking its part of the tree
+  m_Affected.clear();
+  m_Affected.push_back(nd);
+  m_bAffected[nd] = true;
+
+  for (unsigned int a=0; a<m_Affected.size(); ++a)
+  {
+    const std::vector<const Edge*>& in = m_InEdges[m_Affected[a]];
+
+    for (unsigned int e=0; e<in.size(); ++e)
+    {
+      if (m_NextEdge[in[e]->From()] == in[e])
+      {
+        m_Affected.push_back(in[e]->From());
+        m_bAffected[in[e]->From()] = true;
+      }
+    }
+  }
+
+  for (unsigned int a=0; a<m_Affected.size(); ++a)
+  {
+    m_Costs[m_Affected[a]]    = MaxDouble;
+    m_NextEdge[m_Affected[a]] = NULL;
+  }
+
+  //now give them the best way through the nodes that kept their costs
+  for (unsigned int a=0; a<m_Affected.size(); ++a)
+  {
+    const int from = m_Affected[a];
+
+    typename graph_type::ConstEdgeIterator EdgeItr(m_Graph, from);
+    for (const Edge* pE=EdgeItr.begin(); !EdgeItr.end(); pE=EdgeItr.next())
+    {
+      if (m_bAffected[pE->To()] || !isReachable(pE->To())) continue;
+
+      double cost = m_Costs[pE->To()] + pE->Cost();
+
+      if (cost < m_Costs[from])
+      {
+        m_Costs[from]    = cost;
+        m_NextEdge[from] = pE;
+      }
+    }
+
+    if (isReachable(from)) Queue(from);
+  }
+
+  for (unsigned int a=0; a<m_Affected.size(); ++a)
+  {
+    m_bAffected[m_Affected[a]] = false;
+  }
+}
+
+//---------------------------- Clear ------------------------------------------
+//-----------------------------------------------------------------------------
+template <class graph_type>
+void GraphDistanceField<graph_type>::Clear()
+{
+  for (unsigned int nd=0; nd<m_Costs.size(); ++nd)
+  {
+    m_Costs[nd]      = MaxDouble;
+    m_NextEdge[nd]   = NULL;
+    m_NumSources[nd] = 0;
+  }
+}
+
+//---------------------------- Propagate --------------------------------------
+//
+//  Dijkstra's algorithm along the edges backwards. A node's cost is only
+//  ever lowered, so the nodes the search reaches are the ones which are
+//  nearer to a queued node than to where their way led before
+//-----------------------------------------------------------------------------
+template <class graph_type>
+void GraphDistanceField<graph_type>::Propagate()
+{
+  while (!m_pPQ->empty())
+  {
+    int nd = m_pPQ->Pop();
+
+    m_bQueued[nd] = false;
+
+    const std::vector<const Edge*>& in = m_InEdges[nd];
+
+    for (unsigned int e=0; e<in.size(); ++e)
+    {
+      const int from = in[e]->From();
+
+      double cost = m_Costs[nd] + in[e]->Cost();
+
+      if (cost < m_Costs[from])
+      {
+        m_Costs[from]    = cost;
+        m_NextEdge[from] = in[e];
+
+        Queue(from);
+      }
+    }
+  }
+}
+
+
+#endif
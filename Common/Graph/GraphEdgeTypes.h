@@ -13,7 +13,7 @@
 #include <ostream>
 #include <fstream>
 
-#include "graph/NodeTypeEnumerations.h"
+#include "Graph/NodeTypeEnumerations.h"
 
 
 class GraphEdge
@@ -115,6 +115,10 @@ protected:
   //this is that object's ID. 
   int  m_iIDofIntersectingEntity;
 
+  //the distance from the edge to the nearest wall. It is not part of the
+  //graph's file: whoever loads the graph works it out from the walls
+  double m_dClearance;
+
 public:
  
   
@@ -124,13 +128,14 @@ public:
                int    flags = 0,
                int    id = -1):GraphEdge(from,to,cost),
                                m_iFlags(flags),
-                               m_iIDofIntersectingEntity(id)
+                               m_iIDofIntersectingEntity(id),
+                               m_dClearance(0)
 
   {} 
 
 
   //stream constructor
-  NavGraphEdge(std::ifstream& stream)
+  NavGraphEdge(std::ifstream& stream):m_dClearance(0)
   {
     char buffer[50];
     stream  >> buffer >> m_iFrom >> buffer >> m_iTo >> buffer >> m_dCost;
@@ -143,6 +148,9 @@ public:
   int  IDofIntersectingEntity()const{return m_iIDofIntersectingEntity;}
   void SetIDofIntersectingEntity(int id){m_iIDofIntersectingEntity = id;}
 
+  double Clearance()const{return m_dClearance;}
+  void   SetClearance(double clearance){m_dClearance = clearance;}
+
  
   friend std::ostream& operator<<(std::ostream& os, const NavGraphEdge& e)
   {
@@ -12,7 +12,7 @@
 #include <ostream>
 #include <fstream>
 #include "2D/Vector2D.h"
-#include "graph/NodeTypeEnumerations.h"
+#include "Graph/NodeTypeEnumerations.h"
 
 
 
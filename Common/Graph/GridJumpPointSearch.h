@@ -0,0 +1,569 @@
+#ifndef GRID_JUMP_POINT_SEARCH_H
+#define GRID_JUMP_POINT_SEARCH_H
+#pragma warning (disable:4786)
+//-----------------------------------------------------------------------------
+//
+//  Name:   GridJumpPointSearch.h
+//
+//  Desc:   A* for the graphs GraphHelper_CreateGrid makes: a grid of cells,
+//          node n at column n % NumCellsX and row n / NumCellsX, each
+//          joined to all eight of its neighbors with costs which are the
+//          same for every move in the same direction. Walls are cells whose
+//          nodes have been removed.
+//
+//          on such a grid many paths of the same cost join the same two
+//          cells, and plain A* expands the nodes of all of them. Jump point
+//          search only expands the cells where a path may have to turn, and
+//          gets there by scanning along the rows, columns and diagonals, so
+//          it finds a path of the same cost expanding far fewer nodes.
+//
+//          the search is told the grid's layout or looks for it. If the
+//          graph is not such a grid it expands every edge, as Dijkstra's
+//          algorithm.
+//-----------------------------------------------------------------------------
+#include <vector>
+#include <list>
+#include <cmath>
+#include <cstdlib>
+#include <cassert>
+
+#include "2D/Vector2D.h"
+#include "misc/PriorityQueue.h"
+#include "misc/utils.h"
+
+
+//the layout of a grid made by GraphHelper_CreateGrid
+struct GridLayout
+{
+  int     NumCellsX;
+  int     NumCellsY;
+
+  //the cost of a move along a row, along a column, and across a cell
+  double  CostX;
+  double  CostY;
+  double  CostDiagonal;
+};
+
+//------------------------ GraphHelper_FindGridLayout -------------------------
+//
+//  returns true if the graph is a grid as GraphHelper_CreateGrid makes,
+//  less any nodes removed since, and fills in its layout. Each node
+//  present must be joined to each of its neighbors present and to no other
+//  node, and the moves in each direction must all cost the same and be in
+//  proportion to the distances between the nodes
+//-----------------------------------------------------------------------------
+template <class graph_type>
+bool GraphHelper_FindGridLayout(const graph_type& G, GridLayout& layout)
+{
+  const double tolerance = 1e-9;
+
+  layout.NumCellsX    = 0;
+  layout.CostX        = -1;
+  layout.CostY        = -1;
+  layout.CostDiagonal = -1;
+
+  //the edges along a column tell the width of the grid, and the first edge
+  //in each direction the costs
+  double StepX = 0, StepY = 0;
+
+  for (int nd=0; nd<G.NumNodes(); ++nd)
+  {
+    if (!G.isNodePresent(nd)) continue;
+
+    typename graph_type::ConstEdgeIterator EdgeItr(G, nd);
+    for (const typename graph_type::EdgeType* pE=EdgeItr.begin();
+         !EdgeItr.end();
+         pE=EdgeItr.next())
+    {
+      Vector2D step = G.GetNode(pE->To()).Pos() - G.GetNode(nd).Pos();
+
+      if (fabs(step.x) < tolerance && layout.CostY < 0)
+      {
+        layout.NumCellsX = abs(pE->To() - nd);
+        layout.CostY     = pE->Cost();
+        StepY            = fabs(step.y);
+      }
+
+      else if (fabs(step.y) < tolerance && layout.CostX < 0)
+      {
+        layout.CostX     = pE->Cost();
+        StepX            = fabs(step.x);
+      }
+
+      else if (fabs(step.x) >= tolerance && fabs(step.y) >= tolerance && layout.CostDiagonal < 0)
+      {
+        layout.CostDiagonal = pE->Cost();
+      }
+    }
+  }
+
+  if (layout.NumCellsX <= 0 || layout.CostX < 0 || layout.CostDiagonal < 0 ||
+      G.NumNodes() % layout.NumCellsX != 0)
+  {
+    return false;
+  }
+
+  layout.NumCellsY = G.NumNodes() / layout.NumCellsX;
+
+  //the search relies on a move across a cell costing less than the two
+  //moves around it and no less than either of them
+  if (layout.CostDiagonal >= layout.CostX + layout.CostY ||
+      layout.CostDiagonal < layout.CostX ||
+      layout.CostDiagonal < layout.CostY)
+  {
+    return false;
+  }
+
+  //now check every node is where the layout puts it and joined as it says
+  for (int nd=0; nd<G.NumNodes(); ++nd)
+  {
+    if (!G.isNodePresent(nd)) continue;
+
+    const int col = nd % layout.NumCellsX;
+    const int row = nd / layout.NumCellsX;
+
+    int NumNeighbors = 0;
+
+    for (int dr=-1; dr<=1; ++dr)
+    {
+      for (int dc=-1; dc<=1; ++dc)
+      {
+        if ((dr || dc) &&
+            col+dc >= 0 && col+dc < layout.NumCellsX &&
+            row+dr >= 0 && row+dr < layout.NumCellsY &&
+            G.isNodePresent(nd + dr*layout.NumCellsX + dc))
+        {
+          ++NumNeighbors;
+        }
+      }
+    }
+
+    int NumEdges = 0;
+
+    typename graph_type::ConstEdgeIterator EdgeItr(G, nd);
+    for (const typename graph_type::EdgeType* pE=EdgeItr.begin();
+         !EdgeItr.end();
+         pE=EdgeItr.next())
+    {
+      ++NumEdges;
+
+      const int dc = pE->To() % layout.NumCellsX - col;
+      const int dr = pE->To() / layout.NumCellsX - row;
+
+      if (abs(dc) > 1 || abs(dr) > 1) return false;
+
+      Vector2D step = G.GetNode(pE->To()).Pos() - G.GetNode(nd).Pos();
+
+      if (fabs(step.x - dc*StepX) > tolerance || fabs(step.y - dr*StepY) > tolerance)
+      {
+        return false;
+      }
+
+      const double cost = dc && dr ? layout.CostDiagonal : (dc ? layout.CostX : layout.CostY);
+
+      if (fabs(pE->Cost() - cost) > tolerance) return false;
+    }
+
+    if (NumEdges != NumNeighbors) return false;
+  }
+
+  return true;
+}
+
+
+//------------------------------ Graph_SearchJPS ------------------------------
+//-----------------------------------------------------------------------------
+template <class graph_type>
+class Graph_SearchJPS
+{
+private:
+
+  //create a typedef for the edge type used by the graph
+  typedef typename graph_type::EdgeType Edge;
+
+private:
+
+  const graph_type&              m_Graph;
+
+  GridLayout                     m_Layout;
+
+  //true if the graph is a grid with the layout above
+  bool                           m_bGrid;
+
+  //indexed into by node. The cost of the way found to the node, and that
+  //plus the estimate of the cost from it to the target, which the queue
+  //indexes into
+  std::vector<double>            m_GCosts;
+  std::vector<double>            m_FCosts;
+
+  //indexed into by node. The node the way found to it comes from, which on
+  //a grid is the cell the last jump started from, and -1 if not reached
+  std::vector<int>               m_Parents;
+
+  std::vector<char>              m_bClosed;
+
+  int                            m_iSource;
+  int                            m_iTarget;
+
+  int                            m_iNumNodesExpanded;
+
+  int    Col(int nd)const{return nd % m_Layout.NumCellsX;}
+  int    Row(int nd)const{return nd / m_Layout.NumCellsX;}
+
+  //the node of the cell dc columns and dr rows from nd, or -1 if it is off
+  //the grid or a wall
+  int    Neighbor(int nd, int dc, int dr)const
+  {
+    const int col = Col(nd) + dc;
+    const int row = Row(nd) + dr;
+
+    if (col < 0 || col >= m_Layout.NumCellsX || row < 0 || row >= m_Layout.NumCellsY) return -1;
+
+    const int n = row*m_Layout.NumCellsX + col;
+
+    return m_Graph.isNodePresent(n) ? n : -1;
+  }
+
+  bool   isOpen(int nd, int dc, int dr)const{return Neighbor(nd, dc, dr) >= 0;}
+
+  //the cost of a move in the direction
+  double StepCost(int dc, int dr)const
+  {
+    return dc && dr ? m_Layout.CostDiagonal : (dc ? m_Layout.CostX : m_Layout.CostY);
+  }
+
+  //the cost of the way from the node to the target if there were no walls
+  double Heuristic(int nd)const;
+
+  //true if a path going through nd in the direction may have to turn
+  //there because of a wall beside it
+  bool   HasForcedNeighbor(int nd, int dc, int dr)const;
+
+  //scans from nd in the direction and returns the first cell where a path
+  //may turn, or -1 if it meets a wall or the edge of the grid first
+  int    Jump(int nd, int dc, int dr)const;
+
+  //reaches nd from the node being expanded with a way of the cost
+  void   Reach(IndexedPriorityQLow<double>& pq, int nd, int parent, double GCost);
+
+  void   ExpandCell(IndexedPriorityQLow<double>& pq, int nd);
+  void   ExpandEdges(IndexedPriorityQLow<double>& pq, int nd);
+
+  //the A* search algorithm
+  void   Search();
+
+public:
+
+  //looks for the grid's layout
+  Graph_SearchJPS(const graph_type& graph,
+                  int               source,
+                  int               target):m_Graph(graph),
+                                            m_GCosts(graph.NumNodes(), 0.0),
+                                            m_FCosts(graph.NumNodes(), 0.0),
+                                            m_Parents(graph.NumNodes(), -1),
+                                            m_bClosed(graph.NumNodes(), false),
+                                            m_iSource(source),
+                                            m_iTarget(target),
+                                            m_iNumNodesExpanded(0)
+  {
+    m_bGrid = GraphHelper_FindGridLayout(graph, m_Layout);
+
+    Search();
+  }
+
+  //is told it
+  Graph_SearchJPS(const graph_type& graph,
+                  const GridLayout& layout,
+                  int               source,
+                  int               target):m_Graph(graph),
+                                            m_Layout(layout),
+                                            m_bGrid(true),
+                                            m_GCosts(graph.NumNodes(), 0.0),
+                                            m_FCosts(graph.NumNodes(), 0.0),
+                                            m_Parents(graph.NumNodes(), -1),
+                                            m_bClosed(graph.NumNodes(), false),
+                                            m_iSource(source),
+                                            m_iTarget(target),
+                                            m_iNumNodesExpanded(0)
+  {
+    assert (layout.NumCellsX * layout.NumCellsY == graph.NumNodes() &&
+            "<Graph_SearchJPS::ctor>: the layout does not fit the graph");
+
+    Search();
+  }
+
+  //true if the search went by the grid's layout
+  bool   isGrid()const{return m_bGrid;}
+
+  //returns the vector of edges that the algorithm has examined. On a grid
+  //it only holds the edges leading into the cells expanded and the cells
+  //they were reached by a jump to
+  std::vector<const Edge*> GetSPT()const;
+
+  //returns a vector of node indexes that comprise the shortest path
+  //from the source to the target, every cell along the way included
+  std::list<int> GetPathToTarget()const;
+
+  //returns the total cost to the target
+  double GetCostToTarget()const{return m_GCosts[m_iTarget];}
+
+  int    NumNodesExpanded()const{return m_iNumNodesExpanded;}
+};
+
+//-----------------------------------------------------------------------------
+template <class graph_type>
+double Graph_SearchJPS<graph_type>::Heuristic(int nd)const
+{
+  //as many moves across cells as the shorter side, then straight on
+  const int dx = abs(Col(nd) - Col(m_iTarget));
+  const int dy = abs(Row(nd) - Row(m_iTarget));
+
+  const int diagonal = dx < dy ? dx : dy;
+
+  return diagonal * m_Layout.CostDiagonal +
+         (dx - diagonal) * m_Layout.CostX +
+         (dy - diagonal) * m_Layout.CostY;
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type>
+bool Graph_SearchJPS<graph_type>::HasForcedNeighbor(int nd, int dc, int dr)const
+{
+  //across a cell: a wall behind on either side opens a way which is
+  //shortest through nd
+  if (dc && dr)
+  {
+    return (!isOpen(nd, -dc, 0) && isOpen(nd, -dc, dr)) ||
+           (!isOpen(nd, 0, -dr) && isOpen(nd, dc, -dr));
+  }
+
+  //along a row or column: a wall to either side
+  if (dc)
+  {
+    return (!isOpen(nd, 0, 1) && isOpen(nd, dc, 1)) ||
+           (!isOpen(nd, 0, -1) && isOpen(nd, dc, -1));
+  }
+
+  return (!isOpen(nd, 1, 0) && isOpen(nd, 1, dr)) ||
+         (!isOpen(nd, -1, 0) && isOpen(nd, -1, dr));
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type>
+int Graph_SearchJPS<graph_type>::Jump(int nd, int dc, int dr)const
+{
+  for (;;)
+  {
+    nd = Neighbor(nd, dc, dr);
+
+    if (nd < 0) return -1;
+
+    if (nd == m_iTarget || HasForcedNeighbor(nd, dc, dr)) return nd;
+
+    //a path across cells may turn here if one along the row or column
+    //from here would
+    if (dc && dr && (Jump(nd, dc, 0) >= 0 || Jump(nd, 0, dr) >= 0)) return nd;
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type>
+void Graph_SearchJPS<graph_type>::Reach(IndexedPriorityQLow<double>& pq,
+                                        int                          nd,
+                                        int                          parent,
+                                        double                       GCost)
+{
+  if (m_bClosed[nd]) return;
+
+  const bool bReached = m_Parents[nd] >= 0 || nd == m_iSource;
+
+  if (bReached && GCost >= m_GCosts[nd]) return;
+
+  m_GCosts[nd]  = GCost;
+  m_FCosts[nd]  = GCost + (m_bGrid ? Heuristic(nd) : 0);
+  m_Parents[nd] = parent;
+
+  if (bReached) pq.ChangePriority(nd);
+  else          pq.insert(nd);
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type>
+void Graph_SearchJPS<graph_type>::ExpandCell(IndexedPriorityQLow<double>& pq, int nd)
+{
+  const int parent = m_Parents[nd];
+
+  //the directions to jump in. From the source, all of them; else the ones
+  //a shortest path coming from the parent may go on in
+  int dirs[8][2];
+  int NumDirs = 0;
+
+  if (parent < 0)
+  {
+    for (int dr=-1; dr<=1; ++dr)
+    {
+      for (int dc=-1; dc<=1; ++dc)
+      {
+        if (dc || dr) {dirs[NumDirs][0] = dc; dirs[NumDirs][1] = dr; ++NumDirs;}
+      }
+    }
+  }
+
+  else
+  {
+    const int dc = Col(nd) > Col(parent) ? 1 : (Col(nd) < Col(parent) ? -1 : 0);
+    const int dr = Row(nd) > Row(parent) ? 1 : (Row(nd) < Row(parent) ? -1 : 0);
+
+    if (dc && dr)
+    {
+      int natural[3][2] = {{dc, 0}, {0, dr}, {dc, dr}};
+
+      for (int i=0; i<3; ++i) {dirs[NumDirs][0] = natural[i][0]; dirs[NumDirs][1] = natural[i][1]; ++NumDirs;}
+
+      if (!isOpen(nd, -dc, 0)) {dirs[NumDirs][0] = -dc; dirs[NumDirs][1] = dr;  ++NumDirs;}
+      if (!isOpen(nd, 0, -dr)) {dirs[NumDirs][0] = dc;  dirs[NumDirs][1] = -dr; ++NumDirs;}
+    }
+
+    else if (dc)
+    {
+      dirs[NumDirs][0] = dc; dirs[NumDirs][1] = 0; ++NumDirs;
+
+      if (!isOpen(nd, 0, 1))  {dirs[NumDirs][0] = dc; dirs[NumDirs][1] = 1;  ++NumDirs;}
+      if (!isOpen(nd, 0, -1)) {dirs[NumDirs][0] = dc; dirs[NumDirs][1] = -1; ++NumDirs;}
+    }
+
+    else
+    {
+      dirs[NumDirs][0] = 0; dirs[NumDirs][1] = dr; ++NumDirs;
+
+      if (!isOpen(nd, 1, 0))  {dirs[NumDirs][0] = 1;  dirs[NumDirs][1] = dr; ++NumDirs;}
+      if (!isOpen(nd, -1, 0)) {dirs[NumDirs][0] = -1; dirs[NumDirs][1] = dr; ++NumDirs;}
+    }
+  }
+
+  for (int d=0; d<NumDirs; ++d)
+  {
+    const int dc = dirs[d][0];
+    const int dr = dirs[d][1];
+
+    const int JumpPoint = Jump(nd, dc, dr);
+
+    if (JumpPoint < 0) continue;
+
+    //the number of cells jumped
+    const int steps = dc ? abs(Col(JumpPoint) - Col(nd)) : abs(Row(JumpPoint) - Row(nd));
+
+    Reach(pq, JumpPoint, nd, m_GCosts[nd] + steps * StepCost(dc, dr));
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type>
+void Graph_SearchJPS<graph_type>::ExpandEdges(IndexedPriorityQLow<double>& pq, int nd)
+{
+  typename graph_type::ConstEdgeIterator ConstEdgeItr(m_Graph, nd);
+
+  for (const Edge* pE=ConstEdgeItr.begin();
+      !ConstEdgeItr.end();
+       pE=ConstEdgeItr.next())
+  {
+    Reach(pq, pE->To(), nd, m_GCosts[nd] + pE->Cost());
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type>
+void Graph_SearchJPS<graph_type>::Search()
+{
+  if (!m_Graph.isNodePresent(m_iSource) || !m_Graph.isNodePresent(m_iTarget)) return;
+
+  IndexedPriorityQLow<double> pq(m_FCosts, m_Graph.NumNodes());
+
+  m_FCosts[m_iSource] = m_bGrid ? Heuristic(m_iSource) : 0;
+
+  pq.insert(m_iSource);
+
+  while(!pq.empty())
+  {
+    int NextClosestNode = pq.Pop();
+
+    m_bClosed[NextClosestNode] = true;
+
+    ++m_iNumNodesExpanded;
+
+    //if the target has been found exit
+    if (NextClosestNode == m_iTarget) return;
+
+    if (m_bGrid) ExpandCell(pq, NextClosestNode);
+    else         ExpandEdges(pq, NextClosestNode);
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type>
+std::vector<const typename graph_type::EdgeType*> Graph_SearchJPS<graph_type>::GetSPT()const
+{
+  std::vector<const Edge*> spt(m_Graph.NumNodes());
+
+  for (int nd=0; nd<m_Graph.NumNodes(); ++nd)
+  {
+    const int parent = m_Parents[nd];
+
+    if (parent < 0) continue;
+
+    int from = parent;
+
+    //the cell before nd on the way from the parent
+    if (m_bGrid)
+    {
+      const int dc = Col(nd) > Col(parent) ? 1 : (Col(nd) < Col(parent) ? -1 : 0);
+      const int dr = Row(nd) > Row(parent) ? 1 : (Row(nd) < Row(parent) ? -1 : 0);
+
+      from = nd - dr*m_Layout.NumCellsX - dc;
+    }
+
+    spt[nd] = &m_Graph.GetEdge(from, nd);
+  }
+
+  return spt;
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type>
+std::list<int> Graph_SearchJPS<graph_type>::GetPathToTarget()const
+{
+  std::list<int> path;
+
+  //just return an empty path if no target or no path found
+  if (m_iTarget < 0 || !m_bClosed[m_iTarget]) return path;
+
+  int nd = m_iTarget;
+
+  path.push_front(nd);
+
+  while (nd != m_iSource)
+  {
+    const int parent = m_Parents[nd];
+
+    //fill in the cells jumped over
+    if (m_bGrid)
+    {
+      const int dc = Col(nd) > Col(parent) ? 1 : (Col(nd) < Col(parent) ? -1 : 0);
+      const int dr = Row(nd) > Row(parent) ? 1 : (Row(nd) < Row(parent) ? -1 : 0);
+
+      for (int cell=nd - dr*m_Layout.NumCellsX - dc; cell != parent; cell -= dr*m_Layout.NumCellsX + dc)
+      {
+        path.push_front(cell);
+      }
+    }
+
+    nd = parent;
+
+    path.push_front(nd);
+  }
+
+  return path;
+}
+
+
+#endif
@@ -15,11 +15,12 @@
 #include <cassert>
 #include <string>
 #include <iostream>
+#include <fstream>
 
 
 #include "2D/Vector2D.h"
 #include "misc/utils.h" 
-#include "graph/NodeTypeEnumerations.h"
+#include "Graph/NodeTypeEnumerations.h"
 
 
 
@@ -123,7 +124,7 @@ public:
   {
     int tot = 0;
 
-    for (EdgeListVector::const_iterator curEdge = m_Edges.begin();
+    for (typename EdgeListVector::const_iterator curEdge = m_Edges.begin();
          curEdge != m_Edges.end();
          ++curEdge)
     {
@@ -159,7 +160,7 @@ public:
 
   void RemoveEdges()
   {
-    for (EdgeListVector::iterator it = m_Edges.begin(); it != m_Edges.end(); ++it)
+    for (typename EdgeListVector::iterator it = m_Edges.begin(); it != m_Edges.end(); ++it)
     {
       it->clear();
     }
@@ -426,7 +427,7 @@ bool SparseGraph<node_type, edge_type>::isEdgePresent(int from, int to)const
 {
     if (isNodePresent(from) && isNodePresent(from))
     {
-       for (EdgeList::const_iterator curEdge = m_Edges[from].begin();
+       for (typename EdgeList::const_iterator curEdge = m_Edges[from].begin();
             curEdge != m_Edges[from].end();
             ++curEdge)
         {
@@ -479,7 +480,7 @@ const edge_type& SparseGraph<node_type, edge_type>::GetEdge(int from, int to)con
           m_Nodes[to].Index() != invalid_node_index &&
           "<SparseGraph::GetEdge>: invalid 'to' index");
 
-  for (EdgeList::const_iterator curEdge = m_Edges[from].begin();
+  for (typename EdgeList::const_iterator curEdge = m_Edges[from].begin();
        curEdge != m_Edges[from].end();
        ++curEdge)
   {
@@ -503,7 +504,7 @@ edge_type& SparseGraph<node_type, edge_type>::GetEdge(int from, int to)
           m_Nodes[to].Index() != invalid_node_index &&
           "<SparseGraph::GetEdge>: invalid 'to' index");
 
-  for (EdgeList::iterator curEdge = m_Edges[from].begin();
+  for (typename EdgeList::iterator curEdge = m_Edges[from].begin();
        curEdge != m_Edges[from].end();
        ++curEdge)
   {
@@ -563,7 +564,7 @@ void SparseGraph<node_type, edge_type>::RemoveEdge(int from, int to)
   assert ( (from < (int)m_Nodes.size()) && (to < (int)m_Nodes.size()) &&
            "<SparseGraph::RemoveEdge>:invalid node index");
 
-  EdgeList::iterator curEdge;
+  typename EdgeList::iterator curEdge;
   
   if (!m_bDigraph)
   {
@@ -626,9 +627,9 @@ int SparseGraph<node_type, edge_type>::AddNode(node_type node)
 template <class node_type, class edge_type>
 void SparseGraph<node_type, edge_type>::CullInvalidEdges()
 {
-  for (EdgeListVector::iterator curEdgeList = m_Edges.begin(); curEdgeList != m_Edges.end(); ++curEdgeList)
+  for (typename EdgeListVector::iterator curEdgeList = m_Edges.begin(); curEdgeList != m_Edges.end(); ++curEdgeList)
   {
-    for (EdgeList::iterator curEdge = (*curEdgeList).begin(); curEdge != (*curEdgeList).end(); ++curEdge)
+    for (typename EdgeList::iterator curEdge = (*curEdgeList).begin(); curEdge != (*curEdgeList).end(); ++curEdge)
     {
       if (m_Nodes[curEdge->To()].Index() == invalid_node_index || 
           m_Nodes[curEdge->From()].Index() == invalid_node_index)
@@ -658,11 +659,11 @@ void SparseGraph<node_type, edge_type>::RemoveNode(int node)
   if (!m_bDigraph)
   {    
     //visit each neighbour and erase any edges leading to this node
-    for (EdgeList::iterator curEdge = m_Edges[node].begin(); 
+    for (typename EdgeList::iterator curEdge = m_Edges[node].begin(); 
          curEdge != m_Edges[node].end();
          ++curEdge)
     {
-      for (EdgeList::iterator curE = m_Edges[curEdge->To()].begin();
+      for (typename EdgeList::iterator curE = m_Edges[curEdge->To()].begin();
            curE != m_Edges[curEdge->To()].end();
            ++curE)
       {
@@ -698,7 +699,7 @@ void SparseGraph<node_type, edge_type>::SetEdgeCost(int from, int to, double New
         "<SparseGraph::SetEdgeCost>: invalid index");
 
   //visit each neighbour and erase any edges leading to this node
-  for (EdgeList::iterator curEdge = m_Edges[from].begin(); 
+  for (typename EdgeList::iterator curEdge = m_Edges[from].begin(); 
        curEdge != m_Edges[from].end();
        ++curEdge)
   {
@@ -718,7 +719,7 @@ void SparseGraph<node_type, edge_type>::SetEdgeCost(int from, int to, double New
 template <class node_type, class edge_type>
 bool SparseGraph<node_type, edge_type>::UniqueEdge(int from, int to)const
 {
-  for (EdgeList::const_iterator curEdge = m_Edges[from].begin();
+  for (typename EdgeList::const_iterator curEdge = m_Edges[from].begin();
        curEdge != m_Edges[from].end();
        ++curEdge)
   {
@@ -756,7 +757,7 @@ bool SparseGraph<node_type, edge_type>::Save(std::ofstream& stream)const
   stream << m_Nodes.size() << std::endl;
 
   //iterate through the graph nodes and save them
-  NodeVector::const_iterator curNode = m_Nodes.begin();
+  typename NodeVector::const_iterator curNode = m_Nodes.begin();
   for (curNode; curNode!=m_Nodes.end(); ++curNode)
   {
     stream << *curNode;
@@ -769,7 +770,7 @@ bool SparseGraph<node_type, edge_type>::Save(std::ofstream& stream)const
   //iterate through the edges and save them
   for (unsigned int nodeIdx = 0; nodeIdx < m_Nodes.size(); ++nodeIdx)
   {
-    for (EdgeList::const_iterator curEdge = m_Edges[nodeIdx].begin();
+    for (typename EdgeList::const_iterator curEdge = m_Edges[nodeIdx].begin();
          curEdge!=m_Edges[nodeIdx].end(); ++curEdge)
     {
       stream << *curEdge;
@@ -1,7 +1,7 @@
 #include "MessageDispatcher.h"
 #include "Game/BaseGameEntity.h"
 #include "misc/FrameCounter.h"
-#include "game/EntityManager.h"
+#include "Game/EntityManager.h"
 #include "Debug/DebugConsole.h"
 
 using std::set;
@@ -9,12 +9,16 @@ using std::set;
 //uncomment below to send message info to the debug window
 //#define SHOW_MESSAGING_INFO
 
+thread_local MessageDispatcher* MessageDispatcher::m_pThreadInstance = NULL;
+
 //--------------------------- Instance ----------------------------------------
 //
-//   this class is a singleton
+//   this class is a singleton (one per world when worlds are used)
 //-----------------------------------------------------------------------------
 MessageDispatcher* MessageDispatcher::Instance()
 {
+  if (m_pThreadInstance) return m_pThreadInstance;
+
   static MessageDispatcher instance; 
   
   return &instance;
@@ -26,7 +26,7 @@ class BaseGameEntity;
 
 //to make code easier to read
 const double SEND_MSG_IMMEDIATELY = 0.0;
-const int    NO_ADDITIONAL_INFO   = 0;
+void* const  NO_ADDITIONAL_INFO   = 0;
 const int    SENDER_ID_IRRELEVANT = -1;
 
 
@@ -44,6 +44,12 @@ private:
   //entity, pReceiver, with the newly created telegram
   void Discharge(BaseGameEntity* pReceiver, const Telegram& msg);
 
+  //when set, the instance returned by Instance() for the calling thread
+  //(see WorldContext)
+  static thread_local MessageDispatcher* m_pThreadInstance;
+
+  friend class WorldContext;
+
   MessageDispatcher(){}
 
   //copy ctor and assignment should be private
@@ -1,9 +1,74 @@
 #include "CrudeTimer.h"
 
+#include <chrono>
+
+
+thread_local CrudeTimer* CrudeTimer::m_pThreadInstance = 0;
 
 CrudeTimer* CrudeTimer::Instance()
 {
+  if (m_pThreadInstance) return m_pThreadInstance;
+
   static CrudeTimer instance;
 
   return &instance;
-}
\ No newline at end of file
+}
+
+//----------------------------- ctor ------------------------------------------
+//-----------------------------------------------------------------------------
+CrudeTimer::CrudeTimer():m_Mode(wall_clock),
+                         m_dBaseTime(0),
+                         m_dModeStartTime(WallClockTime()),
+                         m_lNumSteps(0),
+                         m_dStepSize(0),
+                         m_dTimeScale(1)
+{}
+
+//-------------------------- WallClockTime ------------------------------------
+//-----------------------------------------------------------------------------
+double CrudeTimer::WallClockTime()
+{
+  typedef std::chrono::steady_clock clock;
+
+  return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+}
+
+//------------------------------ Rebase ---------------------------------------
+//-----------------------------------------------------------------------------
+void CrudeTimer::Rebase(clock_mode mode)
+{
+  m_dBaseTime      = GetCurrentTime();
+  m_dModeStartTime = WallClockTime();
+  m_lNumSteps      = 0;
+  m_Mode           = mode;
+}
+
+//------------------------- mode selection ------------------------------------
+//-----------------------------------------------------------------------------
+void CrudeTimer::UseWallClock()
+{
+  Rebase(wall_clock);
+}
+
+void CrudeTimer::UseFixedStep(double SecondsPerUpdate)
+{
+  Rebase(fixed_step);
+
+  m_dStepSize = SecondsPerUpdate;
+}
+
+void CrudeTimer::UseScaledClock(double TimeScale)
+{
+  Rebase(scaled);
+
+  m_dTimeScale = TimeScale;
+}
+
+//------------------------------- Reset ---------------------------------------
+//-----------------------------------------------------------------------------
+void CrudeTimer::Reset()
+{
+  m_dBaseTime      = 0;
+  m_dModeStartTime = WallClockTime();
+  m_lNumSteps      = 0;
+}
@@ -6,41 +6,101 @@
 //
 //  Desc:   timer to measure time in seconds
 //
+//          The timer can run in one of three modes:
+//
+//            wall_clock - time passes as it does in the real world
+//            fixed_step - time only advances, by a fixed amount, when
+//                         Update is called (once per game tick). This makes
+//                         a simulation independent of the speed it runs at
+//                         and therefore repeatable
+//            scaled     - real time multiplied by a constant factor
+//
 //  Author: Mat Buckland 2002 (fup@ai-junkie.com)
 //
 //------------------------------------------------------------------------
 
-//this library must be included
-#pragma comment(lib, "winmm.lib")
-
-#include <windows.h>
-
-
 
 #define Clock CrudeTimer::Instance()
 
 class CrudeTimer
 {
+public:
+
+  enum clock_mode{wall_clock, fixed_step, scaled};
+
 private:
-  
 
-  //set to the time (in seconds) when class is instantiated
-  double m_dStartTime;
+  clock_mode m_Mode;
+
+  //the value returned by GetCurrentTime when the mode was last changed
+  double     m_dBaseTime;
+
+  //the reading of the wall clock when the mode was last changed
+  double     m_dModeStartTime;
+
+  //fixed_step mode: the number of calls to Update since the mode was set
+  //and the number of seconds each of them represents
+  long       m_lNumSteps;
+  double     m_dStepSize;
+
+  //scaled mode: the number of seconds that pass for every real second
+  double     m_dTimeScale;
+
+  //returns the reading, in seconds, of a monotonic system clock
+  static double WallClockTime();
+
+  //makes the current time the starting point of a new mode
+  void       Rebase(clock_mode mode);
+
+  //when set, the instance returned by Instance() for the calling thread
+  //(see WorldContext)
+  static thread_local CrudeTimer* m_pThreadInstance;
+
+  friend class WorldContext;
 
   //set the start time
-  CrudeTimer(){m_dStartTime = timeGetTime() * 0.001;}
+  CrudeTimer();
 
   //copy ctor and assignment should be private
   CrudeTimer(const CrudeTimer&);
   CrudeTimer& operator=(const CrudeTimer&);
-  
+
 public:
 
   static CrudeTimer* Instance();
 
   //returns how much time has elapsed since the timer was started
-  double GetCurrentTime(){return timeGetTime() * 0.001 - m_dStartTime;}
+  double GetCurrentTime()const
+  {
+    switch(m_Mode)
+    {
+    case fixed_step:
+
+      return m_dBaseTime + m_lNumSteps * m_dStepSize;
+
+    case scaled:
+
+      return m_dBaseTime + (WallClockTime() - m_dModeStartTime) * m_dTimeScale;
+
+    default:
+
+      return m_dBaseTime + (WallClockTime() - m_dModeStartTime);
+    }
+  }
+
+  //this should be called once each game tick. It advances the time of a
+  //fixed_step clock and does nothing in the other modes
+  void   Update(){if (m_Mode == fixed_step) ++m_lNumSteps;}
+
+  //the time carries on from its current value when the mode is changed
+  void   UseWallClock();
+  void   UseFixedStep(double SecondsPerUpdate);
+  void   UseScaledClock(double TimeScale);
+
+  //sets the current time back to zero (the mode is unchanged)
+  void   Reset();
 
+  clock_mode Mode()const{return m_Mode;}
 };
 
 
@@ -49,4 +109,4 @@ public:
 
 
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,286 @@
+#include "FrameScheduler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+
+#include "misc/utils.h"
+
+
+//the longest cycle of frames looked at when choosing the phase of a task
+static const int MaxCycleLength = 3600;
+
+//the weight of a new measure in the average cost of a task
+static const double CostSmoothing = 0.1;
+
+//the frame a task is due on when it never runs
+static const int Never = INT_MAX;
+
+
+//---------------------------- ctor -------------------------------------------
+//-----------------------------------------------------------------------------
+FrameScheduler::FrameScheduler(double FrameRate):m_dFrameRate(FrameRate),
+                                                 m_SlotLoad(1, 0.0),
+                                                 m_iFrame(0),
+                                                 m_dBudget(0),
+                                                 m_dSpent(0),
+                                                 m_dAllowance(0),
+                                                 m_iNumDeferred(0)
+{}
+
+//---------------------------- AddTask ----------------------------------------
+//-----------------------------------------------------------------------------
+int FrameScheduler::AddTask(double NumUpdatesPerSecond)
+{
+  assert(NumClients() == 0 && "<FrameScheduler::AddTask>: tasks must be added before the clients");
+  assert(m_Tasks.size() < MaxTasks && "<FrameScheduler::AddTask>: too many tasks");
+
+  Task task;
+
+  task.Cost      = 1.0;
+  task.bMeasured = false;
+
+  if (NumUpdatesPerSecond > 0)
+  {
+    task.Period = MaxOf(1, (int)(m_dFrameRate / NumUpdatesPerSecond + 0.5));
+  }
+
+  else if (isEqual(0.0, NumUpdatesPerSecond))
+  {
+    task.Period = 0;
+  }
+
+  else
+  {
+    task.Period = -1;
+  }
+
+  m_Tasks.push_back(task);
+
+  //the cycle is the least common multiple of the periods, so a phase chosen
+  //for a task is good for every one of its runs
+  int cycle = 1;
+
+  for (unsigned int t=0; t<m_Tasks.size(); ++t)
+  {
+    const int p = m_Tasks[t].Period;
+
+    if (p <= 0) continue;
+
+    int a = cycle, b = p;
+
+    while (b) {int r = a % b; a = b; b = r;}
+
+    cycle = MinOf(cycle / a * p, MaxCycleLength);
+  }
+
+  m_SlotLoad.assign(cycle, 0.0);
+
+  return (int)m_Tasks.size() - 1;
+}
+
+//---------------------------- Phase ------------------------------------------
+//-----------------------------------------------------------------------------
+int FrameScheduler::Phase(int client, int task)const
+{
+  return m_NextFrame[client*m_Tasks.size() + task] % m_Tasks[task].Period;
+}
+
+//------------------------- CalculateSlotLoad ---------------------------------
+//-----------------------------------------------------------------------------
+void FrameScheduler::CalculateSlotLoad()
+{
+  const int cycle = (int)m_SlotLoad.size();
+
+  std::fill(m_SlotLoad.begin(), m_SlotLoad.end(), 0.0);
+
+  for (int c=0; c<NumClients(); ++c)
+  {
+    if (!isInUse(c)) continue;
+
+    for (unsigned int t=0; t<m_Tasks.size(); ++t)
+    {
+      const int p = m_Tasks[t].Period;
+
+      if (p <= 0) continue;
+
+      for (int f=Phase(c, t) % cycle; f<cycle; f+=p)
+      {
+        m_SlotLoad[f] += m_Tasks[t].Cost;
+      }
+    }
+  }
+}
+
+//---------------------------- AddClient --------------------------------------
+//
+//  gives each periodic task of the client the phase with the least work
+//  already scheduled on it. Ties go to the earliest phase
+//-----------------------------------------------------------------------------
+void FrameScheduler::AddClient(int client)
+{
+  const int NumTasks = (int)m_Tasks.size();
+
+  if (client >= NumClients())
+  {
+    m_NextFrame.resize((client+1)*NumTasks, -1);
+    m_Due.resize(client+1, 0);
+  }
+
+  assert(!isInUse(client) && "<FrameScheduler::AddClient>: client already in use");
+
+  CalculateSlotLoad();
+
+  const int cycle = (int)m_SlotLoad.size();
+
+  for (int t=0; t<NumTasks; ++t)
+  {
+    const int p = m_Tasks[t].Period;
+
+    int& next = m_NextFrame[client*NumTasks + t];
+
+    if (p < 0) {next = Never; continue;}
+    if (p == 0){next = 0;     continue;}
+
+    int    BestPhase = 0;
+    double LeastLoad = MaxDouble;
+
+    for (int phase=0; phase<p; ++phase)
+    {
+      double load = 0;
+
+      for (int f=phase % cycle; f<cycle; f+=p)
+      {
+        load += m_SlotLoad[f];
+      }
+
+      if (load < LeastLoad)
+      {
+        LeastLoad = load;
+        BestPhase = phase;
+      }
+    }
+
+    //the first frame after this one on that phase
+    next = m_iFrame + 1 + ((BestPhase - (m_iFrame + 1)) % p + p) % p;
+
+    for (int f=BestPhase % cycle; f<cycle; f+=p)
+    {
+      m_SlotLoad[f] += m_Tasks[t].Cost;
+    }
+  }
+
+  m_Due[client] = 0;
+}
+
+//---------------------------- RemoveClient -----------------------------------
+//-----------------------------------------------------------------------------
+void FrameScheduler::RemoveClient(int client)
+{
+  if (client < 0 || client >= NumClients()) return;
+
+  for (unsigned int t=0; t<m_Tasks.size(); ++t)
+  {
+    m_NextFrame[client*m_Tasks.size() + t] = -1;
+  }
+
+  m_Due[client] = 0;
+}
+
+//---------------------------- BeginFrame -------------------------------------
+//-----------------------------------------------------------------------------
+void FrameScheduler::BeginFrame()
+{
+  ++m_iFrame;
+
+  //the work done over the allowance of the last frame is taken off this one
+  const double overshoot = m_dBudget > 0 ? MaxOf(0.0, m_dSpent - m_dAllowance) : 0.0;
+
+  m_dAllowance   = m_dBudget - overshoot;
+  m_dSpent       = 0;
+  m_iNumDeferred = 0;
+
+  std::fill(m_Due.begin(), m_Due.end(), 0);
+
+  m_Jobs.clear();
+
+  const int NumTasks = (int)m_Tasks.size();
+
+  for (int c=0; c<NumClients(); ++c)
+  {
+    if (!isInUse(c)) continue;
+
+    for (int t=0; t<NumTasks; ++t)
+    {
+      if (m_Tasks[t].Period == 0)
+      {
+        m_Due[c] |= 1 << t;
+
+        continue;
+      }
+
+      const int next = m_NextFrame[c*NumTasks + t];
+
+      if (next <= m_iFrame)
+      {
+        Job job = {c, t, m_iFrame - next};
+
+        m_Jobs.push_back(job);
+      }
+    }
+  }
+
+  //without a budget everything due is run, otherwise the most overdue jobs
+  //are run first and any which does not fit in the allowance is put off
+  if (m_dBudget > 0)
+  {
+    std::sort(m_Jobs.begin(), m_Jobs.end());
+  }
+
+  double planned = 0;
+
+  for (unsigned int j=0; j<m_Jobs.size(); ++j)
+  {
+    const Job& job = m_Jobs[j];
+
+    const double cost = m_Tasks[job.Task].Cost;
+
+    if (m_dBudget > 0 && j > 0 && planned + cost > m_dAllowance)
+    {
+      ++m_iNumDeferred;
+
+      continue;
+    }
+
+    planned += cost;
+
+    m_Due[job.Client] |= 1 << job.Task;
+
+    //the job keeps its phase, a job put off for a while skips the runs
+    //it missed
+    int& next = m_NextFrame[job.Client*NumTasks + job.Task];
+
+    const int p = m_Tasks[job.Task].Period;
+
+    next += ((m_iFrame - next) / p + 1) * p;
+  }
+}
+
+//---------------------------- RecordCost -------------------------------------
+//-----------------------------------------------------------------------------
+void FrameScheduler::RecordCost(int task, double Microseconds)
+{
+  Task& t = m_Tasks[task];
+
+  if (t.bMeasured)
+  {
+    t.Cost += CostSmoothing * (Microseconds - t.Cost);
+  }
+  else
+  {
+    t.Cost      = Microseconds;
+    t.bMeasured = true;
+  }
+
+  m_dSpent += Microseconds;
+}
@@ -0,0 +1,159 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+//------------------------------------------------------------------------
+//
+//  Name:   FrameScheduler.h
+//
+//  Desc:   decides, once per update-step (a frame), which periodic tasks of
+//          a group of clients are run. It does the same job as one
+//          Regulator per client and task, but looks at all of them at
+//          once:
+//
+//          - each task is run every n frames, n being given by the number
+//            of updates per second it requires. When a client is added,
+//            each of its tasks is given the phase (the frame in its period
+//            it runs on) where the least work is already scheduled. So the
+//            expensive tasks of many clients do not pile up on the same
+//            frames as they can with randomly seeded regulators.
+//
+//          - a budget of microseconds per frame can be set. The due tasks
+//            are then run most overdue first, using the measured average
+//            cost of each task, until the budget is spent. The others are
+//            put off to the next frame. When a frame went over budget the
+//            overshoot is taken off the budget of the next one. The most
+//            overdue task is always run so nothing is put off forever.
+//
+//          Clients are identified by a small non-negative integer (the
+//          bot slot for example). Tasks are numbered in the order they are
+//          added and the tasks due for a client are returned as a bit set,
+//          task i being bit (1 << i).
+//
+//          Without a budget the tasks run depend only on the order the
+//          clients were added, so a game remains reproducible. With a
+//          budget they depend on the speed of the machine.
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+
+class FrameScheduler
+{
+public:
+
+  enum {MaxTasks = 32};
+
+private:
+
+  struct Task
+  {
+    //the number of frames between two runs. 0 means every frame with no
+    //regard to the budget, a negative value means never
+    int    Period;
+
+    //the average cost of a run in microseconds
+    double Cost;
+
+    bool   bMeasured;
+  };
+
+  struct Job
+  {
+    int Client;
+    int Task;
+
+    //the number of frames the job is overdue
+    int Lateness;
+
+    bool operator<(const Job& rhs)const
+    {
+      if (Lateness != rhs.Lateness) return Lateness > rhs.Lateness;
+      if (Client   != rhs.Client)   return Client   < rhs.Client;
+      return Task < rhs.Task;
+    }
+  };
+
+  double              m_dFrameRate;
+
+  std::vector<Task>   m_Tasks;
+
+  //the frame each task of each client is next due, client c task t being
+  //m_NextFrame[c*m_Tasks.size() + t]. -1 if the client is not in use
+  std::vector<int>    m_NextFrame;
+
+  //the tasks due this frame for each client
+  std::vector<int>    m_Due;
+
+  //the work scheduled on each frame of a cycle of m_SlotLoad.size()
+  //frames, used to choose the phase of the tasks of a new client
+  std::vector<double> m_SlotLoad;
+
+  int                 m_iFrame;
+
+  //the microseconds of work allowed per frame. 0 for no limit
+  double              m_dBudget;
+
+  //the microseconds of work recorded during the current frame
+  double              m_dSpent;
+
+  //the work allowed on the current frame
+  double              m_dAllowance;
+
+  //the number of jobs put off during the current frame
+  int                 m_iNumDeferred;
+
+  //working buffer
+  std::vector<Job>    m_Jobs;
+
+  int    NumClients()const{return (int)m_Due.size();}
+
+  bool   isInUse(int client)const
+  {
+    return !m_Tasks.empty() && m_NextFrame[client*m_Tasks.size()] != -1;
+  }
+
+  //the frame in its period a task of a client runs on
+  int    Phase(int client, int task)const;
+
+  //sums the estimated cost of the tasks of the clients in use into
+  //m_SlotLoad
+  void   CalculateSlotLoad();
+
+public:
+
+  FrameScheduler(double FrameRate);
+
+  //adds a task run NumUpdatesPerSecond times a second. A frequency of 0
+  //runs the task every frame and a negative one never. Returns the task
+  //number. All the tasks must be added before the first client
+  int    AddTask(double NumUpdatesPerSecond);
+
+  //the client number must not be in use
+  void   AddClient(int client);
+  void   RemoveClient(int client);
+
+  //0 to remove the limit
+  void   SetBudget(double Microseconds){m_dBudget = Microseconds;}
+  double Budget()const{return m_dBudget;}
+
+  //chooses the tasks run this frame. Call once per update-step, before
+  //any DueTasks
+  void   BeginFrame();
+
+  //the tasks of the client chosen by BeginFrame
+  int    DueTasks(int client)const
+  {
+    return client < (int)m_Due.size() ? m_Due[client] : 0;
+  }
+
+  //records the time a run of the task took. It updates the average cost
+  //of the task and the work done this frame
+  void   RecordCost(int task, double Microseconds);
+
+  int    NumDeferred()const{return m_iNumDeferred;}
+  double Spent()const{return m_dSpent;}
+  double Cost(int task)const{return m_Tasks[task].Cost;}
+};
+
+
+
+#endif
@@ -10,12 +10,48 @@
 //          activated when an entity moves within its region of influence.
 //
 //-----------------------------------------------------------------------------
-#include "game/BaseGameEntity.h"
+#include <vector>
+#include <algorithm>
+
+#include "Game/BaseGameEntity.h"
 #include "TriggerRegion.h"
 
 struct Telegram;
 struct Vector2D;
 
+template <class entity_type> class Trigger;
+
+
+//what a trigger system keeps for each type of trigger registered with it
+template <class entity_type>
+struct TriggerTypeRecord
+{
+  //bumped each time a trigger of the type is activated, deactivated,
+  //registered or removed
+  unsigned int                        ActivityEpoch;
+
+  //bumped each time a trigger of the type is registered or removed
+  unsigned int                        MembershipEpoch;
+
+  //the active triggers of the type, in no particular order
+  std::vector<Trigger<entity_type>*>  Active;
+
+  TriggerTypeRecord():ActivityEpoch(0), MembershipEpoch(0){}
+
+  void RemoveActive(Trigger<entity_type>* pTrigger)
+  {
+    typename std::vector<Trigger<entity_type>*>::iterator it =
+      std::find(Active.begin(), Active.end(), pTrigger);
+
+    if (it != Active.end())
+    {
+      *it = Active.back();
+      Active.pop_back();
+    }
+  }
+};
+
+
 template <class entity_type>
 class Trigger : public BaseGameEntity
 {   
@@ -38,11 +74,30 @@ private:
   //type of trigger.
   int            m_iGraphNodeIndex;
 
+  //the record of the trigger's type kept by the trigger system it is
+  //registered with. It is told each time the trigger is activated or
+  //deactivated
+  TriggerTypeRecord<entity_type>* m_pTypeRecord;
+
+  void SetActiveState(bool bActive)
+  {
+    if (m_bActive == bActive) return;
+
+    m_bActive = bActive;
+
+    if (!m_pTypeRecord) return;
+
+    if (bActive) m_pTypeRecord->Active.push_back(this);
+    else         m_pTypeRecord->RemoveActive(this);
+
+    ++m_pTypeRecord->ActivityEpoch;
+  }
+
 protected:
 
   void SetToBeRemovedFromGame(){m_bRemoveFromGame = true;}
-  void SetInactive(){m_bActive = false;}
-  void SetActive(){m_bActive = true;}
+  void SetInactive(){SetActiveState(false);}
+  void SetActive(){SetActiveState(true);}
 
   //returns true if the entity given by a position and bounding radius is
   //overlapping the trigger region
@@ -54,10 +109,13 @@ protected:
 
 public:
 
+  typedef TriggerTypeRecord<entity_type> TypeRecord;
+
   Trigger(unsigned int id):BaseGameEntity(id),
                            m_bRemoveFromGame(false),
                            m_bActive(true),
                            m_iGraphNodeIndex(-1),
+                           m_pTypeRecord(NULL),
                            m_pRegionOfInfluence(NULL)
                            
   {}
@@ -74,8 +132,21 @@ public:
   virtual void  Update() = 0;
 
   void SetGraphNodeIndex(int idx) { m_iGraphNodeIndex = idx; }
+  void SetTypeRecord(TypeRecord* pRecord){m_pTypeRecord = pRecord;}
+  TypeRecord* GetTypeRecord()const{return m_pTypeRecord;}
   int  GraphNodeIndex()const{return m_iGraphNodeIndex;}
   bool isToBeRemoved()const{return m_bRemoveFromGame;}
+
+  //fills in the bounding box of the trigger region. Returns false if the
+  //trigger has no region (and so can never be triggered)
+  bool GetRegionBounds(Vector2D& TopLeft, Vector2D& BottomRight)const
+  {
+    if (!m_pRegionOfInfluence) return false;
+
+    m_pRegionOfInfluence->GetBounds(TopLeft, BottomRight);
+
+    return true;
+  }
   bool isActive(){return m_bActive;}
 };
 
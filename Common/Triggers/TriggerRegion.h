@@ -10,8 +10,8 @@
 //          TriggerRegion has one method, isTouching, which returns true if
 //          a given position is inside the region
 //-----------------------------------------------------------------------------
-#include "2d/Vector2d.h"
-#include "2d/InvertedAABBox2D.h"
+#include "2D/Vector2D.h"
+#include "2D/InvertedAABBox2D.h"
 
 class TriggerRegion
 {
@@ -22,6 +22,10 @@ public:
   //returns true if an entity of the given size and position is intersecting
   //the trigger region.
   virtual bool isTouching(Vector2D EntityPos, double EntityRadius)const = 0;
+
+  //the axis aligned box enclosing the region (used by the TriggerSystem to
+  //sort the triggers into cells)
+  virtual void GetBounds(Vector2D& TopLeft, Vector2D& BottomRight)const = 0;
 };
 
 
@@ -50,6 +54,12 @@ public:
   {
     return Vec2DDistanceSq(m_vPos, pos) < (EntityRadius + m_dRadius)*(EntityRadius + m_dRadius);
   }
+
+  void GetBounds(Vector2D& TopLeft, Vector2D& BottomRight)const
+  {
+    TopLeft     = m_vPos - Vector2D(m_dRadius, m_dRadius);
+    BottomRight = m_vPos + Vector2D(m_dRadius, m_dRadius);
+  }
 };
 
 
@@ -83,6 +93,12 @@ public:
 
     return Box.isOverlappedWith(*m_pTrigger);
   }
+
+  void GetBounds(Vector2D& TopLeft, Vector2D& BottomRight)const
+  {
+    TopLeft     = m_pTrigger->TopLeft();
+    BottomRight = m_pTrigger->BottomRight();
+  }
 };
 
 
@@ -11,18 +11,122 @@
 //           takes care of updating those triggers and of removing them from
 //           the system if their lifetime has expired.
 //
+//           Once Partition has been called the triggers are also sorted
+//           into a grid of cells by the bounding box of their trigger
+//           region, and an entity is only tried against the triggers
+//           found in the cells its bounding circle overlaps. The triggers
+//           are still tried in the order they were registered.
+//
+//           For each type of trigger the system keeps a list of the active
+//           triggers, which the triggers update as they are activated and
+//           deactivated, and epochs telling when the list or the triggers
+//           of the type last changed, so anything worked out from them can
+//           be kept until they change.
+//
 //-----------------------------------------------------------------------------
+#include <list>
+#include <map>
+#include <vector>
+#include <algorithm>
+
+#include "2D/Vector2D.h"
+
+
 template <class trigger_type>
 class TriggerSystem
 {
 public:
 
-  typedef std::list<trigger_type*> TriggerList;
+  typedef std::list<trigger_type*>          TriggerList;
+  typedef typename trigger_type::TypeRecord TypeRecord;
 
 private:
 
   TriggerList   m_Triggers; 
 
+  //an entry of a grid cell. Seq is the order the trigger was registered in
+  struct CellEntry
+  {
+    int           Seq;
+    trigger_type* pTrigger;
+
+    bool operator<(const CellEntry& rhs)const{return Seq < rhs.Seq;}
+    bool operator==(const CellEntry& rhs)const{return Seq == rhs.Seq;}
+  };
+
+  //the grid. It is empty until Partition is called
+  std::vector<std::vector<CellEntry> > m_Cells;
+
+  int     m_iNumCellsX;
+  int     m_iNumCellsY;
+  double  m_dCellSizeX;
+  double  m_dCellSizeY;
+
+  int     m_iNextSeq;
+
+  //the records by type of trigger. The triggers point to theirs, which
+  //stay put as others are added
+  std::map<int, TypeRecord> m_TypeRecords;
+
+  //the triggers found in the cells overlapped by an entity
+  std::vector<CellEntry> m_Candidates;
+
+  int  CellX(double x)const{return Clamped((int)(x / m_dCellSizeX), m_iNumCellsX);}
+  int  CellY(double y)const{return Clamped((int)(y / m_dCellSizeY), m_iNumCellsY);}
+
+  static int Clamped(int i, int NumCells)
+  {
+    if (i < 0)         return 0;
+    if (i >= NumCells) return NumCells-1;
+    return i;
+  }
+
+  //adds the trigger to (or removes it from) every cell its region overlaps
+  void AddToCells(trigger_type* trigger, int seq)
+  {
+    Vector2D TopLeft, BottomRight;
+
+    if (!trigger->GetRegionBounds(TopLeft, BottomRight)) return;
+
+    CellEntry entry;
+    entry.Seq      = seq;
+    entry.pTrigger = trigger;
+
+    for (int y=CellY(TopLeft.y); y<=CellY(BottomRight.y); ++y)
+    {
+      for (int x=CellX(TopLeft.x); x<=CellX(BottomRight.x); ++x)
+      {
+        m_Cells[y*m_iNumCellsX + x].push_back(entry);
+      }
+    }
+  }
+
+  void RemoveFromCells(trigger_type* trigger)
+  {
+    Vector2D TopLeft, BottomRight;
+
+    if (!trigger->GetRegionBounds(TopLeft, BottomRight)) return;
+
+    for (int y=CellY(TopLeft.y); y<=CellY(BottomRight.y); ++y)
+    {
+      for (int x=CellX(TopLeft.x); x<=CellX(BottomRight.x); ++x)
+      {
+        std::vector<CellEntry>& cell = m_Cells[y*m_iNumCellsX + x];
+
+        for (unsigned int e=0; e<cell.size(); ++e)
+        {
+          if (cell[e].pTrigger == trigger)
+          {
+            //the order within a cell does not matter
+            cell[e] = cell.back();
+            cell.pop_back();
+            break;
+          }
+        }
+      }
+    }
+  }
+
 
   //this method iterates through all the triggers present in the system and
   //calls their Update method in order that their internal state can be
@@ -30,12 +134,21 @@ private:
   //have their m_bRemoveFromGame field set to true.
   void UpdateTriggers()
   {
-    TriggerList::iterator curTrg = m_Triggers.begin();
+    typename TriggerList::iterator curTrg = m_Triggers.begin();
     while (curTrg != m_Triggers.end())
     {
       //remove trigger if dead
       if ((*curTrg)->isToBeRemoved())
       {
+        if (!m_Cells.empty()) RemoveFromCells(*curTrg);
+
+        TypeRecord* pRecord = (*curTrg)->GetTypeRecord();
+
+        if ((*curTrg)->isActive()) pRecord->RemoveActive(*curTrg);
+
+        ++pRecord->ActivityEpoch;
+        ++pRecord->MembershipEpoch;
+
         delete *curTrg;
 
         curTrg = m_Triggers.erase(curTrg);
@@ -57,14 +170,21 @@ private:
   void TryTriggers(ContainerOfEntities& entities)
   {
     //test each entity against the triggers
-    ContainerOfEntities::iterator curEnt = entities.begin();
+    typename ContainerOfEntities::iterator curEnt = entities.begin();
     for (curEnt; curEnt != entities.end(); ++curEnt)
     {
       //an entity must be ready for its next trigger update and it must be 
       //alive before it is tested against each trigger.
       if ((*curEnt)->isReadyForTriggerUpdate() && (*curEnt)->isAlive())
       {
-        TriggerList::const_iterator curTrg;
+        if (!m_Cells.empty())
+        {
+          TryTriggersInCells(*curEnt);
+
+          continue;
+        }
+
+        typename TriggerList::const_iterator curTrg;
         for (curTrg = m_Triggers.begin(); curTrg != m_Triggers.end(); ++curTrg)
         {
           (*curTrg)->Try(*curEnt);
@@ -72,10 +192,48 @@ private:
       }
     }
   }
-  
+
+  //tries the entity against the triggers in the cells overlapped by its
+  //bounding circle. A trigger spanning several of these cells is only
+  //tried once
+  template <class entity_type>
+  void TryTriggersInCells(entity_type* pEnt)
+  {
+    const Vector2D pos = pEnt->Pos();
+    const double   r   = pEnt->BRadius();
+
+    m_Candidates.clear();
+
+    for (int y=CellY(pos.y - r); y<=CellY(pos.y + r); ++y)
+    {
+      for (int x=CellX(pos.x - r); x<=CellX(pos.x + r); ++x)
+      {
+        const std::vector<CellEntry>& cell = m_Cells[y*m_iNumCellsX + x];
+
+        m_Candidates.insert(m_Candidates.end(), cell.begin(), cell.end());
+      }
+    }
+
+    std::sort(m_Candidates.begin(), m_Candidates.end());
+
+    m_Candidates.erase(std::unique(m_Candidates.begin(), m_Candidates.end()),
+                       m_Candidates.end());
+
+    for (unsigned int t=0; t<m_Candidates.size(); ++t)
+    {
+      m_Candidates[t].pTrigger->Try(pEnt);
+    }
+  }
 
 public:
 
+  TriggerSystem():m_iNumCellsX(0),
+                  m_iNumCellsY(0),
+                  m_dCellSizeX(1),
+                  m_dCellSizeY(1),
+                  m_iNextSeq(0)
+  {}
+
   ~TriggerSystem()
   {
     Clear();
@@ -84,13 +242,48 @@ public:
   //this deletes any current triggers and empties the trigger list
   void Clear()
   {
-    TriggerList::iterator curTrg;
+    typename TriggerList::iterator curTrg;
     for (curTrg = m_Triggers.begin(); curTrg != m_Triggers.end(); ++curTrg)
     {
       delete *curTrg;
     }
 
     m_Triggers.clear();
+
+    typename std::map<int, TypeRecord>::iterator curRecord;
+    for (curRecord = m_TypeRecords.begin(); curRecord != m_TypeRecords.end(); ++curRecord)
+    {
+      curRecord->second.Active.clear();
+
+      ++curRecord->second.ActivityEpoch;
+      ++curRecord->second.MembershipEpoch;
+    }
+
+    for (unsigned int c=0; c<m_Cells.size(); ++c)
+    {
+      m_Cells[c].clear();
+    }
+  }
+
+  //sets up the grid used to find the triggers near an entity: the space
+  //(width x height) is divided into cellsX x cellsY cells. Any triggers
+  //already registered are sorted into the cells
+  void Partition(double width, double height, int cellsX, int cellsY)
+  {
+    m_iNumCellsX = cellsX > 0 ? cellsX : 1;
+    m_iNumCellsY = cellsY > 0 ? cellsY : 1;
+    m_dCellSizeX = width  / m_iNumCellsX;
+    m_dCellSizeY = height / m_iNumCellsY;
+
+    m_Cells.assign(m_iNumCellsX*m_iNumCellsY, std::vector<CellEntry>());
+
+    m_iNextSeq = 0;
+
+    typename TriggerList::iterator curTrg;
+    for (curTrg = m_Triggers.begin(); curTrg != m_Triggers.end(); ++curTrg)
+    {
+      AddToCells(*curTrg, m_iNextSeq++);
+    }
   }
 
   //This method should be called each update-step of the game. It will first
@@ -108,12 +301,23 @@ public:
   void Register(trigger_type* trigger)
   {
     m_Triggers.push_back(trigger);
+
+    TypeRecord& record = m_TypeRecords[trigger->EntityType()];
+
+    trigger->SetTypeRecord(&record);
+
+    if (trigger->isActive()) record.Active.push_back(trigger);
+
+    ++record.ActivityEpoch;
+    ++record.MembershipEpoch;
+
+    if (!m_Cells.empty()) AddToCells(trigger, m_iNextSeq++);
   }
 
   //some triggers are required to be rendered (like giver-triggers for example)
   void Render()
   {
-    TriggerList::iterator curTrg;
+    typename TriggerList::iterator curTrg;
     for (curTrg = m_Triggers.begin(); curTrg != m_Triggers.end(); ++curTrg)
     {
       (*curTrg)->Render();
@@ -122,6 +326,22 @@ public:
 
   const TriggerList& GetTriggers()const{return m_Triggers;}
 
+  //the record of the given type of trigger, or NULL if none of the type
+  //has been registered
+  const TypeRecord*  GetTypeRecord(int type)const
+  {
+    typename std::map<int, TypeRecord>::const_iterator it = m_TypeRecords.find(type);
+
+    return it == m_TypeRecords.end() ? NULL : &it->second;
+  }
+
+  unsigned int       GetActivityEpoch(int type)const
+  {
+    const TypeRecord* pRecord = GetTypeRecord(type);
+
+    return pRecord ? pRecord->ActivityEpoch : 0;
+  }
+
 };
 
 
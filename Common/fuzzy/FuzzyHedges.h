@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 #include "FuzzySet.h"
 #include "FuzzyTerm.h"
+#include "FuzzyProgram.h"
 #include <math.h>
 
 class FzVery : public FuzzyTerm
@@ -25,7 +26,7 @@ private:
 
 public:
 
-  FzVery(FzSet& ft):m_Set(ft.m_Set){}
+  FzVery(const FzSet& ft):m_Set(ft.m_Set){}
 
   double GetDOM()const
   {
@@ -36,6 +37,16 @@ public:
 
   void ClearDOM(){m_Set.ClearDOM();}
   void ORwithDOM(double val){m_Set.ORwithDOM(val * val);}
+
+  void CompileGetDOM(FuzzyProgram& prog)const
+  {
+    prog.Emit(FuzzyProgram::op_push_very, prog.SetHandle(&m_Set));
+  }
+
+  void CompileORwithDOM(FuzzyProgram& prog)const
+  {
+    prog.Emit(FuzzyProgram::op_or_into_very, prog.SetHandle(&m_Set));
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -51,7 +62,7 @@ private:
 
 public:
 
-  FzFairly(FzSet& ft):m_Set(ft.m_Set){}
+  FzFairly(const FzSet& ft):m_Set(ft.m_Set){}
 
   double GetDOM()const
   {
@@ -62,6 +73,16 @@ public:
 
   void ClearDOM(){m_Set.ClearDOM();}
   void ORwithDOM(double val){m_Set.ORwithDOM(sqrt(val));}
+
+  void CompileGetDOM(FuzzyProgram& prog)const
+  {
+    prog.Emit(FuzzyProgram::op_push_fairly, prog.SetHandle(&m_Set));
+  }
+
+  void CompileORwithDOM(FuzzyProgram& prog)const
+  {
+    prog.Emit(FuzzyProgram::op_or_into_fairly, prog.SetHandle(&m_Set));
+  }
 };
 
 
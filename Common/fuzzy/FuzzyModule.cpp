@@ -3,7 +3,7 @@
 #include <iostream>
 #include <cassert>
 
-#include "Fuzzy/FuzzyModule.h"
+#include "fuzzy/FuzzyModule.h"
 
 //------------------------------ dtor -----------------------------------------
 FuzzyModule::~FuzzyModule()
@@ -22,7 +22,7 @@ FuzzyModule::~FuzzyModule()
 }
 
 //----------------------------- AddRule ---------------------------------------
-void FuzzyModule::AddRule(FuzzyTerm& antecedent, FuzzyTerm& consequence)
+void FuzzyModule::AddRule(const FuzzyTerm& antecedent, const FuzzyTerm& consequence)
 {
   m_Rules.push_back(new FuzzyRule(antecedent, consequence));
 }
@@ -40,6 +40,61 @@ FuzzyVariable& FuzzyModule::CreateFLV(const std::string& VarName)
 }
 
 
+//---------------------------- Compile ----------------------------------------
+//
+//  the variables and their sets are numbered in the order of their names,
+//  the order DeFuzzifyMaxAv and DeFuzzifyCentroid add them up in
+//-----------------------------------------------------------------------------
+FuzzyProgram FuzzyModule::Compile(const std::vector<std::string>& inputs,
+                                  const std::vector<std::string>& outputs,
+                                  DefuzzifyMethod                 method)const
+{
+  FuzzyProgram prog;
+
+  std::map<std::string, int> VarIndex;
+
+  VarMap::const_iterator curVar = m_Variables.begin();
+  for (curVar; curVar != m_Variables.end(); ++curVar)
+  {
+    VarIndex[curVar->first] = prog.AddVariable(curVar->second->m_dMinRange,
+                                               curVar->second->m_dMaxRange);
+
+    FuzzyVariable::MemberSets::const_iterator curSet = curVar->second->m_MemberSets.begin();
+    for (curSet; curSet != curVar->second->m_MemberSets.end(); ++curSet)
+    {
+      curSet->second->Compile(prog);
+    }
+  }
+
+  for (unsigned int i=0; i<inputs.size(); ++i)
+  {
+    assert ( (VarIndex.find(inputs[i]) != VarIndex.end()) &&
+             "<FuzzyModule::Compile>:input not found");
+
+    prog.AddInput(VarIndex[inputs[i]]);
+  }
+
+  std::vector<int> OutputVars;
+
+  for (unsigned int o=0; o<outputs.size(); ++o)
+  {
+    assert ( (VarIndex.find(outputs[o]) != VarIndex.end()) &&
+             "<FuzzyModule::Compile>:output not found");
+
+    OutputVars.push_back(VarIndex[outputs[o]]);
+  }
+
+  std::vector<FuzzyRule*>::const_iterator curRule = m_Rules.begin();
+  for (curRule; curRule != m_Rules.end(); ++curRule)
+  {
+    (*curRule)->Compile(prog);
+  }
+
+  prog.Finish(OutputVars, method == centroid, NumSamples);
+
+  return prog;
+}
+
 //---------------------------- WriteAllDOMs -----------------------------------
 std::ostream& FuzzyModule::WriteAllDOMs(std::ostream& os)
 {
@@ -22,6 +22,7 @@
 #include "FuzzyOperators.h"
 #include "FzSet.h"
 #include "FuzzyHedges.h"
+#include "FuzzyProgram.h"
 
 
 
@@ -62,7 +63,7 @@ public:
   FuzzyVariable&  CreateFLV(const std::string& VarName);
   
   //adds a rule to the module
-  void            AddRule(FuzzyTerm& antecedent, FuzzyTerm& consequence);
+  void            AddRule(const FuzzyTerm& antecedent, const FuzzyTerm& consequence);
 
   //this method calls the Fuzzify method of the named FLV 
   inline void     Fuzzify(const std::string& NameOfFLV, double val);
@@ -73,6 +74,13 @@ public:
                             DefuzzifyMethod    method = max_av);
     
   
+  //compiles the rules giving the named outputs into a program. Evaluating
+  //the program with the inputs in the given order gives the same values as
+  //fuzzifying the inputs and defuzzifying the outputs with this module
+  FuzzyProgram    Compile(const std::vector<std::string>& inputs,
+                          const std::vector<std::string>& outputs,
+                          DefuzzifyMethod                 method = max_av)const;
+
   //writes the DOMs of all the variables in the module to an output stream
   std::ostream&   WriteAllDOMs(std::ostream& os);
 
@@ -1,4 +1,5 @@
 #include "FuzzyOperators.h"
+#include "FuzzyProgram.h"
  
 ///////////////////////////////////////////////////////////////////////////////
 //
@@ -15,14 +16,14 @@ FzAND::FzAND(const FzAND& fa)
 }
    
   //ctor using two terms
-FzAND::FzAND(FuzzyTerm& op1, FuzzyTerm& op2)
+FzAND::FzAND(const FuzzyTerm& op1, const FuzzyTerm& op2)
 {
    m_Terms.push_back(op1.Clone());
    m_Terms.push_back(op2.Clone());
 }
 
 //ctor using three terms
-FzAND::FzAND(FuzzyTerm& op1, FuzzyTerm& op2, FuzzyTerm& op3)
+FzAND::FzAND(const FuzzyTerm& op1, const FuzzyTerm& op2, const FuzzyTerm& op3)
 {
    m_Terms.push_back(op1.Clone());
    m_Terms.push_back(op2.Clone());
@@ -30,7 +31,7 @@ FzAND::FzAND(FuzzyTerm& op1, FuzzyTerm& op2, FuzzyTerm& op3)
 }
 
       //ctor using four terms
-FzAND::FzAND(FuzzyTerm& op1, FuzzyTerm& op2, FuzzyTerm& op3, FuzzyTerm& op4)
+FzAND::FzAND(const FuzzyTerm& op1, const FuzzyTerm& op2, const FuzzyTerm& op3, const FuzzyTerm& op4)
 {
    m_Terms.push_back(op1.Clone());
    m_Terms.push_back(op2.Clone());
@@ -90,6 +91,28 @@ void FzAND::ClearDOM()
   }
 }
 
+//------------------------- CompileGetDOM -------------------------------------
+void FzAND::CompileGetDOM(FuzzyProgram& prog)const
+{
+  std::vector<FuzzyTerm*>::const_iterator curTerm;
+  for (curTerm = m_Terms.begin(); curTerm != m_Terms.end(); ++curTerm)
+  {
+    (*curTerm)->CompileGetDOM(prog);
+  }
+
+  prog.Emit(FuzzyProgram::op_and, (int)m_Terms.size());
+}
+
+//------------------------- CompileORwithDOM ----------------------------------
+void FzAND::CompileORwithDOM(FuzzyProgram& prog)const
+{
+  std::vector<FuzzyTerm*>::const_iterator curTerm;
+  for (curTerm = m_Terms.begin(); curTerm != m_Terms.end(); ++curTerm)
+  {
+    (*curTerm)->CompileORwithDOM(prog);
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 //  implementation of FzOR
@@ -105,14 +128,14 @@ FzOR::FzOR(const FzOR& fa)
 }
    
   //ctor using two terms
-FzOR::FzOR(FuzzyTerm& op1, FuzzyTerm& op2)
+FzOR::FzOR(const FuzzyTerm& op1, const FuzzyTerm& op2)
 {
    m_Terms.push_back(op1.Clone());
    m_Terms.push_back(op2.Clone());
 }
 
     //ctor using three terms
-FzOR::FzOR(FuzzyTerm& op1, FuzzyTerm& op2, FuzzyTerm& op3)
+FzOR::FzOR(const FuzzyTerm& op1, const FuzzyTerm& op2, const FuzzyTerm& op3)
 {
    m_Terms.push_back(op1.Clone());
    m_Terms.push_back(op2.Clone());
@@ -120,7 +143,7 @@ FzOR::FzOR(FuzzyTerm& op1, FuzzyTerm& op2, FuzzyTerm& op3)
 }
 
       //ctor using four terms
-FzOR::FzOR(FuzzyTerm& op1, FuzzyTerm& op2, FuzzyTerm& op3, FuzzyTerm& op4)
+FzOR::FzOR(const FuzzyTerm& op1, const FuzzyTerm& op2, const FuzzyTerm& op3, const FuzzyTerm& op4)
 {
    m_Terms.push_back(op1.Clone());
    m_Terms.push_back(op2.Clone());
@@ -158,3 +181,15 @@ double FzOR::GetDOM()const
 
   return largest;
 }
+
+//------------------------- CompileGetDOM -------------------------------------
+void FzOR::CompileGetDOM(FuzzyProgram& prog)const
+{
+  std::vector<FuzzyTerm*>::const_iterator curTerm;
+  for (curTerm = m_Terms.begin(); curTerm != m_Terms.end(); ++curTerm)
+  {
+    (*curTerm)->CompileGetDOM(prog);
+  }
+
+  prog.Emit(FuzzyProgram::op_or, (int)m_Terms.size());
+}
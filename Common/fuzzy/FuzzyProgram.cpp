@@ -0,0 +1,438 @@
+#include "FuzzyProgram.h"
+
+#include <cassert>
+#include <math.h>
+
+#include "misc/utils.h"
+#include "FuzzySet_Triangle.h"
+#include "FuzzySet_LeftShoulder.h"
+#include "FuzzySet_RightShoulder.h"
+#include "FuzzySet_Singleton.h"
+
+
+//---------------------------- ctor -------------------------------------------
+//-----------------------------------------------------------------------------
+FuzzyProgram::FuzzyProgram():m_iNumOutputs(0),
+                             m_iNumSamples(0),
+                             m_iDepth(0)
+{}
+
+//---------------------------- AddVariable ------------------------------------
+//-----------------------------------------------------------------------------
+int FuzzyProgram::AddVariable(double MinRange, double MaxRange)
+{
+  Variable var = {(int)m_Sets.size(), 0, MinRange, MaxRange};
+
+  m_Variables.push_back(var);
+
+  return (int)m_Variables.size() - 1;
+}
+
+//---------------------------- AddSet -----------------------------------------
+//-----------------------------------------------------------------------------
+void FuzzyProgram::AddSet(const FuzzySet* pSet,
+                          SetShape         shape,
+                          double           peak,
+                          double           LeftOffset,
+                          double           RightOffset,
+                          double           RepresentativeVal)
+{
+  assert(!m_Variables.empty() && "<FuzzyProgram::AddSet>: no variable to add the set to");
+
+  Set set = {shape, peak, LeftOffset, RightOffset, RepresentativeVal};
+
+  m_Sets.push_back(set);
+  m_DOMs.push_back(0.0);
+  m_SetAddresses.push_back(pSet);
+
+  ++m_Variables.back().NumSets;
+}
+
+//---------------------------- SetHandle --------------------------------------
+//-----------------------------------------------------------------------------
+int FuzzyProgram::SetHandle(const FuzzySet* pSet)const
+{
+  for (unsigned int s=0; s<m_SetAddresses.size(); ++s)
+  {
+    if (m_SetAddresses[s] == pSet) return (int)s;
+  }
+
+  assert(0 && "<FuzzyProgram::SetHandle>: the set is not part of the module");
+
+  return -1;
+}
+
+//---------------------------- Emit -------------------------------------------
+//
+//  appends an op and keeps track of the depth of the stack
+//-----------------------------------------------------------------------------
+void FuzzyProgram::Emit(OpCode code, int arg)
+{
+  Op op = {code, arg};
+
+  m_Ops.push_back(op);
+
+  switch (code)
+  {
+  case op_push:
+  case op_push_very:
+  case op_push_fairly:
+
+    ++m_iDepth; break;
+
+  case op_and:
+  case op_or:
+
+    assert(arg > 0 && arg <= m_iDepth && "<FuzzyProgram::Emit>: not enough operands");
+
+    m_iDepth -= arg - 1; break;
+
+  case op_pop:
+
+    assert(m_iDepth > 0 && "<FuzzyProgram::Emit>: nothing to pop");
+
+    --m_iDepth; break;
+
+  default: break;
+  }
+
+  if (m_iDepth > (int)m_Stack.size()) m_Stack.resize(m_iDepth);
+}
+
+//---------------------------- EndRule ----------------------------------------
+//-----------------------------------------------------------------------------
+void FuzzyProgram::EndRule()
+{
+  assert(m_iDepth == 0 && "<FuzzyProgram::EndRule>: a rule must leave the stack empty");
+}
+
+//---------------------------- Finish -----------------------------------------
+//
+//  a rule is kept if it writes to a set of an output or to a set read by a
+//  rule already kept. The consequents of the kept rules are zeroed first, as
+//  DeFuzzify does, then the kept rules are run in their original order
+//-----------------------------------------------------------------------------
+void FuzzyProgram::Finish(const std::vector<int>& outputs, bool bCentroid, int NumSamples)
+{
+  const int NumRules = (int)m_RuleStart.size();
+
+  std::vector<int> RuleEnd(NumRules);
+
+  for (int r=0; r<NumRules; ++r)
+  {
+    RuleEnd[r] = r+1 < NumRules ? m_RuleStart[r+1] : (int)m_Ops.size();
+  }
+
+  std::vector<bool> bNeeded(m_Sets.size(), false);
+  std::vector<bool> bWritten(m_Sets.size(), false);
+  std::vector<bool> bKept(NumRules, false);
+
+  for (unsigned int o=0; o<outputs.size(); ++o)
+  {
+    const Variable& var = m_Variables[outputs[o]];
+
+    for (int s=var.FirstSet; s<var.FirstSet+var.NumSets; ++s) bNeeded[s] = true;
+  }
+
+  bool bChanged = true;
+
+  while (bChanged)
+  {
+    bChanged = false;
+
+    for (int r=0; r<NumRules; ++r)
+    {
+      if (bKept[r]) continue;
+
+      bool bFeedsNeededSet = false;
+
+      for (int i=m_RuleStart[r]; i<RuleEnd[r]; ++i)
+      {
+        const Op& op = m_Ops[i];
+
+        if (op.Code >= op_or_into && op.Code <= op_or_into_fairly && bNeeded[op.Arg])
+        {
+          bFeedsNeededSet = true;
+        }
+      }
+
+      if (!bFeedsNeededSet) continue;
+
+      bKept[r] = bChanged = true;
+
+      for (int i=m_RuleStart[r]; i<RuleEnd[r]; ++i)
+      {
+        const Op& op = m_Ops[i];
+
+        if (op.Code <= op_push_fairly)
+        {
+          bNeeded[op.Arg] = true;
+        }
+
+        else if (op.Code >= op_or_into && op.Code <= op_or_into_fairly)
+        {
+          bWritten[op.Arg] = true;
+        }
+      }
+    }
+  }
+
+#ifndef NDEBUG
+  //a set read by the rules must be given by the inputs or by the rules,
+  //otherwise the result would depend on what the module was last given
+  std::vector<bool> bInput(m_Sets.size(), false);
+
+  for (unsigned int i=0; i<m_Inputs.size(); ++i)
+  {
+    const Variable& var = m_Variables[m_Inputs[i]];
+
+    for (int s=var.FirstSet; s<var.FirstSet+var.NumSets; ++s) bInput[s] = true;
+  }
+
+  for (int r=0; r<NumRules; ++r)
+  {
+    if (!bKept[r]) continue;
+
+    for (int i=m_RuleStart[r]; i<RuleEnd[r]; ++i)
+    {
+      const Op& op = m_Ops[i];
+
+      assert((op.Code > op_push_fairly || bInput[op.Arg] || bWritten[op.Arg]) &&
+             "<FuzzyProgram::Finish>: a rule reads a variable which is not an input");
+    }
+  }
+#endif
+
+  std::vector<Op> ops;
+
+  for (unsigned int s=0; s<m_Sets.size(); ++s)
+  {
+    if (bWritten[s])
+    {
+      Op op = {op_clear, (int)s};
+
+      ops.push_back(op);
+    }
+  }
+
+  for (int r=0; r<NumRules; ++r)
+  {
+    if (bKept[r]) ops.insert(ops.end(), m_Ops.begin()+m_RuleStart[r], m_Ops.begin()+RuleEnd[r]);
+  }
+
+  for (unsigned int o=0; o<outputs.size(); ++o)
+  {
+    Op op = {bCentroid ? op_centroid : op_max_av, outputs[o]};
+
+    ops.push_back(op);
+  }
+
+  m_Ops.swap(ops);
+
+  m_iNumOutputs = (int)outputs.size();
+  m_iNumSamples = NumSamples;
+
+  m_RuleStart.clear();
+  m_SetAddresses.clear();
+}
+
+//---------------------------- CalculateDOM -----------------------------------
+//-----------------------------------------------------------------------------
+double FuzzyProgram::CalculateDOM(const Set& set, double val)const
+{
+  switch (set.Shape)
+  {
+  case triangle:
+
+    return FuzzySet_Triangle::CalculateDOM(val, set.Peak, set.LeftOffset, set.RightOffset);
+
+  case left_shoulder:
+
+    return FuzzySet_LeftShoulder::CalculateDOM(val, set.Peak, set.LeftOffset, set.RightOffset);
+
+  case right_shoulder:
+
+    return FuzzySet_RightShoulder::CalculateDOM(val, set.Peak, set.LeftOffset, set.RightOffset);
+
+  case singleton:
+
+    return FuzzySet_Singleton::CalculateDOM(val, set.Peak, set.LeftOffset, set.RightOffset);
+  }
+
+  return 0.0;
+}
+
+//--------------------------- DeFuzzifyMaxAv ----------------------------------
+//
+//  same sums, in the same order, as FuzzyVariable::DeFuzzifyMaxAv
+//-----------------------------------------------------------------------------
+double FuzzyProgram::DeFuzzifyMaxAv(const Variable& var)const
+{
+  double bottom = 0.0;
+  double top    = 0.0;
+
+  for (int s=var.FirstSet; s<var.FirstSet+var.NumSets; ++s)
+  {
+    bottom += m_DOMs[s];
+
+    top += m_Sets[s].RepresentativeVal * m_DOMs[s];
+  }
+
+  if (isEqual(0, bottom)) return 0.0;
+
+  return top / bottom;
+}
+
+//------------------------- DeFuzzifyCentroid ---------------------------------
+//
+//  same sums, in the same order, as FuzzyVariable::DeFuzzifyCentroid
+//-----------------------------------------------------------------------------
+double FuzzyProgram::DeFuzzifyCentroid(const Variable& var)const
+{
+  double StepSize = (var.MaxRange - var.MinRange)/(double)m_iNumSamples;
+
+  double TotalArea    = 0.0;
+  double SumOfMoments = 0.0;
+
+  for (int samp=1; samp<=m_iNumSamples; ++samp)
+  {
+    for (int s=var.FirstSet; s<var.FirstSet+var.NumSets; ++s)
+    {
+      double contribution =
+          MinOf(CalculateDOM(m_Sets[s], var.MinRange + samp * StepSize), m_DOMs[s]);
+
+      TotalArea += contribution;
+
+      SumOfMoments += (var.MinRange + samp * StepSize)  * contribution;
+    }
+  }
+
+  if (isEqual(0, TotalArea)) return 0.0;
+
+  return (SumOfMoments / TotalArea);
+}
+
+//---------------------------- Evaluate ---------------------------------------
+//-----------------------------------------------------------------------------
+void FuzzyProgram::Evaluate(const double* inputs, double* outputs, int NumCases)
+{
+  const int  NumIns = NumInputs();
+  const Op*  ops    = m_Ops.empty() ? 0 : &m_Ops[0];
+  const int  NumOps = (int)m_Ops.size();
+  double*    DOMs   = m_DOMs.empty() ? 0 : &m_DOMs[0];
+  double*    stack  = m_Stack.empty() ? 0 : &m_Stack[0];
+
+  for (int c=0; c<NumCases; ++c, inputs += NumIns)
+  {
+    //fuzzify the inputs
+    for (int i=0; i<NumIns; ++i)
+    {
+      const Variable& var = m_Variables[m_Inputs[i]];
+
+      const double val = inputs[i];
+
+      assert ( (val >= var.MinRange) && (val <= var.MaxRange) &&
+               "<FuzzyProgram::Evaluate>: value out of range");
+
+      for (int s=var.FirstSet; s<var.FirstSet+var.NumSets; ++s)
+      {
+        DOMs[s] = CalculateDOM(m_Sets[s], val);
+      }
+    }
+
+    //run the rules and defuzzify the outputs
+    int top = -1;
+
+    for (int i=0; i<NumOps; ++i)
+    {
+      const int arg = ops[i].Arg;
+
+      switch (ops[i].Code)
+      {
+      case op_push:
+
+        stack[++top] = DOMs[arg]; break;
+
+      case op_push_very:
+
+        stack[++top] = DOMs[arg] * DOMs[arg]; break;
+
+      case op_push_fairly:
+
+        stack[++top] = sqrt(DOMs[arg]); break;
+
+      case op_and:
+        {
+          double smallest = MaxDouble;
+
+          for (int t=top-arg+1; t<=top; ++t)
+          {
+            if (stack[t] < smallest) smallest = stack[t];
+          }
+
+          top -= arg - 1;
+
+          stack[top] = smallest;
+        }
+
+        break;
+
+      case op_or:
+        {
+          double largest = MinFloat;
+
+          for (int t=top-arg+1; t<=top; ++t)
+          {
+            if (stack[t] > largest) largest = stack[t];
+          }
+
+          top -= arg - 1;
+
+          stack[top] = largest;
+        }
+
+        break;
+
+      case op_or_into:
+
+        if (stack[top] > DOMs[arg]) DOMs[arg] = stack[top];
+
+        break;
+
+      case op_or_into_very:
+        {
+          const double val = stack[top] * stack[top];
+
+          if (val > DOMs[arg]) DOMs[arg] = val;
+        }
+
+        break;
+
+      case op_or_into_fairly:
+        {
+          const double val = sqrt(stack[top]);
+
+          if (val > DOMs[arg]) DOMs[arg] = val;
+        }
+
+        break;
+
+      case op_pop:
+
+        --top; break;
+
+      case op_clear:
+
+        DOMs[arg] = 0.0; break;
+
+      case op_max_av:
+
+        *outputs++ = DeFuzzifyMaxAv(m_Variables[arg]); break;
+
+      case op_centroid:
+
+        *outputs++ = DeFuzzifyCentroid(m_Variables[arg]); break;
+      }
+    }
+  }
+}
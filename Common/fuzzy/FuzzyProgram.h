@@ -0,0 +1,163 @@
+#ifndef FUZZY_PROGRAM_H
+#define FUZZY_PROGRAM_H
+#pragma warning (disable:4786)
+//-----------------------------------------------------------------------------
+//
+//  Name:   FuzzyProgram.h
+//
+//  Desc:   a FuzzyModule compiled into a flat program (see
+//          FuzzyModule::Compile). The variables and sets are numbered, the
+//          rules are turned into an array of ops working on a small stack and
+//          the inputs and outputs are passed as arrays of crisp values, in
+//          the order given to Compile. So an evaluation does no string
+//          lookups, no virtual calls and no memory allocation.
+//
+//          Evaluate gives exactly the same results as calling Fuzzify on the
+//          module for each input followed by DeFuzzify for each output.
+//          Only the rules which can affect the outputs are compiled, so a
+//          module with rules for several outputs (desirability and precision
+//          for instance) can be split into one program per output.
+//
+//          The methods under 'compilation' are used by FuzzyModule and the
+//          fuzzy terms to build the program.
+//
+//-----------------------------------------------------------------------------
+#include <vector>
+
+
+class FuzzySet;
+
+
+class FuzzyProgram
+{
+public:
+
+  //the shapes of the membership functions
+  enum SetShape {triangle, left_shoulder, right_shoulder, singleton};
+
+  enum OpCode
+  {
+    op_push,            //pushes the DOM of set Arg
+    op_push_very,       //pushes the square of the DOM of set Arg
+    op_push_fairly,     //pushes the square root of the DOM of set Arg
+    op_and,             //replaces the Arg values on top by their minimum
+    op_or,              //replaces the Arg values on top by their maximum
+    op_or_into,         //ORs the value on top into the DOM of set Arg
+    op_or_into_very,    //same with the square of the value
+    op_or_into_fairly,  //same with the square root of the value
+    op_pop,             //removes the value on top
+    op_clear,           //zeros the DOM of set Arg
+    op_max_av,          //defuzzifies variable Arg into the next output
+    op_centroid         //same with the centroid method
+  };
+
+private:
+
+  struct Set
+  {
+    SetShape Shape;
+    double   Peak;
+    double   LeftOffset;
+    double   RightOffset;
+    double   RepresentativeVal;
+  };
+
+  //the sets of variable v are m_Sets[FirstSet] to m_Sets[FirstSet+NumSets-1]
+  struct Variable
+  {
+    int    FirstSet;
+    int    NumSets;
+    double MinRange;
+    double MaxRange;
+  };
+
+  struct Op
+  {
+    OpCode Code;
+    int    Arg;
+  };
+
+  std::vector<Set>          m_Sets;
+  std::vector<Variable>     m_Variables;
+
+  //the DOM of each set. Kept from one evaluation to the next like the DOMs
+  //of a module
+  std::vector<double>       m_DOMs;
+
+  //the variable of each input
+  std::vector<int>          m_Inputs;
+
+  int                       m_iNumOutputs;
+
+  std::vector<Op>           m_Ops;
+
+  //the stack the ops work on, sized to the deepest the ops go
+  std::vector<double>       m_Stack;
+
+  //the number of samples of the centroid method
+  int                       m_iNumSamples;
+
+  //the address of the FuzzySet each set was made from. Used to find the
+  //sets referred to by the terms of the rules while compiling
+  std::vector<const FuzzySet*> m_SetAddresses;
+
+  //the ops of each rule while compiling, [m_RuleStart[r], m_RuleStart[r+1])
+  std::vector<int>          m_RuleStart;
+
+  //the stack depth reached by the ops so far while compiling
+  int                       m_iDepth;
+
+  double CalculateDOM(const Set& set, double val)const;
+
+  double DeFuzzifyMaxAv(const Variable& var)const;
+  double DeFuzzifyCentroid(const Variable& var)const;
+
+public:
+
+  FuzzyProgram();
+
+  int    NumInputs()const{return (int)m_Inputs.size();}
+  int    NumOutputs()const{return m_iNumOutputs;}
+
+  //the range of values input i may take
+  double InputMinRange(int i)const{return m_Variables[m_Inputs[i]].MinRange;}
+  double InputMaxRange(int i)const{return m_Variables[m_Inputs[i]].MaxRange;}
+
+  //evaluates the program for NumCases sets of inputs. The inputs of case c
+  //are inputs[c*NumInputs()] onwards and its outputs are written to
+  //outputs[c*NumOutputs()] onwards
+  void   Evaluate(const double* inputs, double* outputs, int NumCases = 1);
+
+
+  //---------------------------- compilation
+
+  //adds a variable. The sets added next belong to it
+  int    AddVariable(double MinRange, double MaxRange);
+
+  void   AddSet(const FuzzySet* pSet,
+                SetShape         shape,
+                double           peak,
+                double           LeftOffset,
+                double           RightOffset,
+                double           RepresentativeVal);
+
+  //the number given to the set made from pSet
+  int    SetHandle(const FuzzySet* pSet)const;
+
+  void   AddInput(int variable){m_Inputs.push_back(variable);}
+
+  //the ops emitted between BeginRule and EndRule make up one rule
+  void   BeginRule(){m_RuleStart.push_back((int)m_Ops.size());}
+  void   EndRule();
+
+  void   Emit(OpCode code, int arg = 0);
+
+  //turns the rules emitted so far into the final program: ops zeroing the
+  //consequents, the rules which can affect the outputs, then one op per
+  //output defuzzifying it
+  void   Finish(const std::vector<int>& outputs, bool bCentroid, int NumSamples);
+};
+
+
+
+#endif
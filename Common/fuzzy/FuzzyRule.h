@@ -13,8 +13,9 @@
 //          
 //-----------------------------------------------------------------------------
 #include <vector>
-#include "Fuzzy/FuzzySet.h"
+#include "fuzzy/FuzzySet.h"
 #include "fuzzy/FuzzyOperators.h"
+#include "fuzzy/FuzzyProgram.h"
 #include "misc/utils.h"
 
 
@@ -50,6 +51,19 @@ public:
   {
     m_pConsequence->ORwithDOM(m_pAntecedent->GetDOM());
   }
+
+  //emits the ops of Calculate
+  void Compile(FuzzyProgram& prog)const
+  {
+    prog.BeginRule();
+
+    m_pAntecedent->CompileGetDOM(prog);
+    m_pConsequence->CompileORwithDOM(prog);
+
+    prog.Emit(FuzzyProgram::op_pop);
+
+    prog.EndRule();
+  }
 };
 
 #endif
\ No newline at end of file
@@ -12,6 +12,9 @@
 #include <cassert>
 
 
+class FuzzyProgram;
+
+
 class FuzzySet
 {
 protected:
@@ -36,6 +39,10 @@ public:
   //to determine the DOMs of the values it uses as its sample points.
   virtual double      CalculateDOM(double val)const = 0;
 
+  //adds the shape of this set to a program compiled from the module it
+  //belongs to
+  virtual void        Compile(FuzzyProgram& prog)const = 0;
+
   //if this fuzzy set is part of a consequent FLV, and it is fired by a rule 
   //then this method sets the DOM (in this context, the DOM represents a
   //confidence level)to the maximum of the parameter value or the set's 
@@ -1,26 +1,35 @@
 #include "FuzzySet_RightShoulder.h"
+#include "FuzzyProgram.h"
 #include <cassert>
 
 
 double FuzzySet_RightShoulder::CalculateDOM(double val)const
+{
+  return CalculateDOM(val, m_dPeakPoint, m_dLeftOffset, m_dRightOffset);
+}
+
+double FuzzySet_RightShoulder::CalculateDOM(double val,
+                                            double peak,
+                                            double LeftOffset,
+                                            double RightOffset)
 {
   //test for the case where the left or right offsets are zero
   //(to prevent divide by zero errors below)
-  if ( (isEqual(m_dRightOffset, 0.0) && (isEqual(m_dPeakPoint, val))) ||
-       (isEqual(m_dLeftOffset, 0.0) && (isEqual(m_dPeakPoint, val))) )
+  if ( (isEqual(RightOffset, 0.0) && (isEqual(peak, val))) ||
+       (isEqual(LeftOffset, 0.0) && (isEqual(peak, val))) )
   {
     return 1.0;
   }
   
   //find DOM if left of center
-  else if ( (val <= m_dPeakPoint) && (val > (m_dPeakPoint - m_dLeftOffset)) )
+  else if ( (val <= peak) && (val > (peak - LeftOffset)) )
   {
-    double grad = 1.0 / m_dLeftOffset;
+    double grad = 1.0 / LeftOffset;
 
-    return grad * (val - (m_dPeakPoint - m_dLeftOffset));
+    return grad * (val - (peak - LeftOffset));
   }
   //find DOM if right of center and less than center + right offset
-  else if ( (val > m_dPeakPoint) && (val <= m_dPeakPoint+m_dRightOffset) )
+  else if ( (val > peak) && (val <= peak+RightOffset) )
   {
     return 1.0;
   }
@@ -29,4 +38,9 @@ double FuzzySet_RightShoulder::CalculateDOM(double val)const
   {
     return 0;
   }
-}
\ No newline at end of file
+}
+
+void FuzzySet_RightShoulder::Compile(FuzzyProgram& prog)const
+{
+  prog.AddSet(this, FuzzyProgram::right_shoulder, m_dPeakPoint, m_dLeftOffset, m_dRightOffset, m_dRepresentativeValue);
+}
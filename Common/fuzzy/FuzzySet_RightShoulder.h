@@ -39,6 +39,12 @@ public:
 
   //this method calculates the degree of membership for a particular value
   double CalculateDOM(double val)const;
+
+  //the same calculation for a set of this shape with the given parameters.
+  //Also used by FuzzyProgram
+  static double CalculateDOM(double val, double peak, double LeftOffset, double RightOffset);
+
+  void   Compile(FuzzyProgram& prog)const;
 };
 
 
@@ -1,9 +1,18 @@
 #include "FuzzySet_Singleton.h"
+#include "FuzzyProgram.h"
 
 double FuzzySet_Singleton::CalculateDOM(double val)const
 {
-  if ( (val >= m_dMidPoint-m_dLeftOffset) &&
-       (val <= m_dMidPoint+m_dRightOffset) )
+  return CalculateDOM(val, m_dMidPoint, m_dLeftOffset, m_dRightOffset);
+}
+
+double FuzzySet_Singleton::CalculateDOM(double val,
+                                        double peak,
+                                        double LeftOffset,
+                                        double RightOffset)
+{
+  if ( (val >= peak-LeftOffset) &&
+       (val <= peak+RightOffset) )
   {
     return 1.0;
   }
@@ -13,4 +22,9 @@ double FuzzySet_Singleton::CalculateDOM(double val)const
   {
     return 0.0;
   }
-}
\ No newline at end of file
+}
+
+void FuzzySet_Singleton::Compile(FuzzyProgram& prog)const
+{
+  prog.AddSet(this, FuzzyProgram::singleton, m_dMidPoint, m_dLeftOffset, m_dRightOffset, m_dRepresentativeValue);
+}
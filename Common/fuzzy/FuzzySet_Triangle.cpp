@@ -1,33 +1,47 @@
 #include "FuzzySet_Triangle.h"
+#include "FuzzyProgram.h"
 
 
 double FuzzySet_Triangle::CalculateDOM(double val)const
+{
+  return CalculateDOM(val, m_dPeakPoint, m_dLeftOffset, m_dRightOffset);
+}
+
+double FuzzySet_Triangle::CalculateDOM(double val,
+                                       double peak,
+                                       double LeftOffset,
+                                       double RightOffset)
 {
   //test for the case where the triangle's left or right offsets are zero
   //(to prevent divide by zero errors below)
-  if ( (isEqual(m_dRightOffset, 0.0) && (isEqual(m_dPeakPoint, val))) ||
-       (isEqual(m_dLeftOffset, 0.0) && (isEqual(m_dPeakPoint, val))) )
+  if ( (isEqual(RightOffset, 0.0) && (isEqual(peak, val))) ||
+       (isEqual(LeftOffset, 0.0) && (isEqual(peak, val))) )
   {
     return 1.0;
   }
 
   //find DOM if left of center
-  if ( (val <= m_dPeakPoint) && (val >= (m_dPeakPoint - m_dLeftOffset)) )
+  if ( (val <= peak) && (val >= (peak - LeftOffset)) )
   {
-    double grad = 1.0 / m_dLeftOffset;
+    double grad = 1.0 / LeftOffset;
 
-    return grad * (val - (m_dPeakPoint - m_dLeftOffset));
+    return grad * (val - (peak - LeftOffset));
   }
   //find DOM if right of center
-  else if ( (val > m_dPeakPoint) && (val < (m_dPeakPoint + m_dRightOffset)) )
+  else if ( (val > peak) && (val < (peak + RightOffset)) )
   {
-    double grad = 1.0 / -m_dRightOffset;
+    double grad = 1.0 / -RightOffset;
 
-    return grad * (val - m_dPeakPoint) + 1.0;
+    return grad * (val - peak) + 1.0;
   }
   //out of range of this FLV, return zero
   else
   {
     return 0.0;
   }
-}
\ No newline at end of file
+}
+
+void FuzzySet_Triangle::Compile(FuzzyProgram& prog)const
+{
+  prog.AddSet(this, FuzzyProgram::triangle, m_dPeakPoint, m_dLeftOffset, m_dRightOffset, m_dRepresentativeValue);
+}
@@ -0,0 +1,231 @@
+#include "FuzzySurface.h"
+
+#include <cassert>
+#include <math.h>
+
+#include "misc/utils.h"
+#include "FuzzyProgram.h"
+
+
+//the number of points per cell, along each input, at which Bake compares
+//the surface with the program. Near a step the deviation peaks within a
+//small part of a cell, so a couple of points per cell miss most of it
+static const int BakeSamplesPerCell = 8;
+
+//Bake stops doubling the resolution when the deviation has not gone down
+//below this fraction of the least one so far MaxFailures times in a row. As
+//the grid moves the deviation near a step goes up and down so one try is
+//not enough
+static const double MinDeviationDecrease = 0.9;
+static const int    MaxFailures          = 2;
+
+
+//the value of point i of n spread over [min, max]. The last point is max
+//exactly so it is never out of range because of rounding
+static double PointInRange(int i, int n, double min, double max)
+{
+  if (n < 2 || i == n-1) return i == 0 ? min : max;
+
+  return min + i * (max - min) / (n - 1);
+}
+
+//---------------------------- ctor -------------------------------------------
+//-----------------------------------------------------------------------------
+FuzzySurface::FuzzySurface():m_iNumX(0),
+                             m_iNumY(0),
+                             m_dMinX(0),
+                             m_dMinY(0),
+                             m_dScaleX(0),
+                             m_dScaleY(0),
+                             m_dMaxError(0)
+{}
+
+//---------------------------- Sample -----------------------------------------
+//
+//  evaluates the program at each point of a grid of NumSamples points along
+//  each input
+//-----------------------------------------------------------------------------
+void FuzzySurface::Sample(FuzzyProgram& prog, int NumSamples)
+{
+  const int NumInputs = prog.NumInputs();
+
+  m_iNumX = NumSamples;
+  m_iNumY = NumInputs == 2 ? NumSamples : 1;
+
+  m_dMinX = prog.InputMinRange(0);
+  m_dMinY = NumInputs == 2 ? prog.InputMinRange(1) : 0.0;
+
+  const double RangeX = prog.InputMaxRange(0) - m_dMinX;
+  const double RangeY = NumInputs == 2 ? prog.InputMaxRange(1) - m_dMinY : 0.0;
+
+  m_dScaleX = RangeX > 0 ? (m_iNumX - 1) / RangeX : 0.0;
+  m_dScaleY = RangeY > 0 ? (m_iNumY - 1) / RangeY : 0.0;
+
+  std::vector<double> inputs(m_iNumX * m_iNumY * NumInputs);
+
+  for (int y=0; y<m_iNumY; ++y)
+  {
+    for (int x=0; x<m_iNumX; ++x)
+    {
+      double* in = &inputs[(y*m_iNumX + x) * NumInputs];
+
+      in[0] = PointInRange(x, m_iNumX, m_dMinX, prog.InputMaxRange(0));
+
+      if (NumInputs == 2)
+      {
+        in[1] = PointInRange(y, m_iNumY, m_dMinY, prog.InputMaxRange(1));
+      }
+    }
+  }
+
+  m_Values.resize(m_iNumX * m_iNumY);
+
+  prog.Evaluate(&inputs[0], &m_Values[0], m_iNumX * m_iNumY);
+}
+
+//---------------------------- Bake -------------------------------------------
+//-----------------------------------------------------------------------------
+void FuzzySurface::Bake(FuzzyProgram& prog,
+                        int           Resolution,
+                        double        Tolerance,
+                        int           MaxResolution)
+{
+  assert( (prog.NumInputs() == 1 || prog.NumInputs() == 2) && prog.NumOutputs() == 1 &&
+          "<FuzzySurface::Bake>: the program must have one or two inputs and one output");
+
+  int n = MaxOf(2, Resolution);
+
+  //the resolution with the smallest deviation so far
+  int    BestResolution = n;
+  double BestError      = MaxDouble;
+
+  int NumFailures = 0;
+
+  while (true)
+  {
+    Sample(prog, n);
+
+    m_dMaxError = Deviation(prog, BakeSamplesPerCell);
+
+    if (m_dMaxError < MinDeviationDecrease * BestError)
+    {
+      BestResolution = n;
+      BestError      = m_dMaxError;
+      NumFailures    = 0;
+    }
+    else
+    {
+      ++NumFailures;
+    }
+
+    if (m_dMaxError <= Tolerance || 2*n-1 > MaxResolution) break;
+
+    //a finer grid only narrows a step, it does not make it smaller. When
+    //the deviation stops going down it comes from a step, so the smallest
+    //grid which gave the least deviation is kept
+    if (NumFailures == MaxFailures)
+    {
+      Sample(prog, BestResolution);
+
+      m_dMaxError = BestError;
+
+      break;
+    }
+
+    n = 2*n-1;
+  }
+}
+
+//---------------------------- Evaluate ---------------------------------------
+//-----------------------------------------------------------------------------
+double FuzzySurface::Evaluate(double x, double y)const
+{
+  assert(isBaked() && "<FuzzySurface::Evaluate>: the surface has not been baked");
+
+  double fx = (x - m_dMinX) * m_dScaleX;
+
+  Clamp(fx, 0.0, m_iNumX - 1);
+
+  int ix = MinOf((int)fx, m_iNumX - 2);
+
+  double tx = fx - ix;
+
+  if (m_iNumY == 1)
+  {
+    const double* v = &m_Values[ix];
+
+    return v[0] + tx * (v[1] - v[0]);
+  }
+
+  double fy = (y - m_dMinY) * m_dScaleY;
+
+  Clamp(fy, 0.0, m_iNumY - 1);
+
+  int iy = MinOf((int)fy, m_iNumY - 2);
+
+  double ty = fy - iy;
+
+  const double* v0 = &m_Values[iy*m_iNumX + ix];
+  const double* v1 = v0 + m_iNumX;
+
+  double bottom = v0[0] + tx * (v0[1] - v0[0]);
+  double top    = v1[0] + tx * (v1[1] - v1[0]);
+
+  return bottom + ty * (top - bottom);
+}
+
+//---------------------------- Deviation --------------------------------------
+//-----------------------------------------------------------------------------
+double FuzzySurface::Deviation(FuzzyProgram& prog,
+                               int           SamplesPerCell,
+                               double*       pWorstX,
+                               double*       pWorstY,
+                               double*       pMean)const
+{
+  assert(isBaked() && "<FuzzySurface::Deviation>: the surface has not been baked");
+
+  const int NumInputs = prog.NumInputs();
+
+  const int NumX = (m_iNumX - 1) * SamplesPerCell + 1;
+  const int NumY = NumInputs == 2 ? (m_iNumY - 1) * SamplesPerCell + 1 : 1;
+
+  std::vector<double> inputs(NumX * NumInputs);
+  std::vector<double> exact(NumX);
+
+  double worst = 0.0;
+  double total = 0.0;
+
+  //one row of points at a time
+  for (int y=0; y<NumY; ++y)
+  {
+    const double ValY = NumInputs == 2 ? PointInRange(y, NumY, prog.InputMinRange(1), prog.InputMaxRange(1)) : 0.0;
+
+    for (int x=0; x<NumX; ++x)
+    {
+      inputs[x*NumInputs] = PointInRange(x, NumX, prog.InputMinRange(0), prog.InputMaxRange(0));
+
+      if (NumInputs == 2) inputs[x*NumInputs + 1] = ValY;
+    }
+
+    prog.Evaluate(&inputs[0], &exact[0], NumX);
+
+    for (int x=0; x<NumX; ++x)
+    {
+      const double dev = fabs(Evaluate(inputs[x*NumInputs], ValY) - exact[x]);
+
+      total += dev;
+
+      if (dev > worst)
+      {
+        worst = dev;
+
+        if (pWorstX) *pWorstX = inputs[x*NumInputs];
+        if (pWorstY) *pWorstY = ValY;
+      }
+    }
+  }
+
+  if (pMean) *pMean = total / (NumX * NumY);
+
+  return worst;
+}
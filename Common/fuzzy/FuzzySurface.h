@@ -0,0 +1,86 @@
+#ifndef FUZZY_SURFACE_H
+#define FUZZY_SURFACE_H
+//-----------------------------------------------------------------------------
+//
+//  Name:   FuzzySurface.h
+//
+//  Desc:   the response of a FuzzyProgram with one or two inputs and one
+//          output, sampled on a regular grid over the ranges of the inputs.
+//          Evaluate interpolates between the samples (bilinearly for two
+//          inputs), so it costs four table reads whatever the number of
+//          rules.
+//
+//          The result is an approximation. Bake doubles the resolution of
+//          the grid until the largest deviation from the program, measured
+//          at eight points along each input in each cell, is within the
+//          tolerance asked for (or the grid reaches its largest size). A
+//          fuzzy response has kinks and, where only one set of the output
+//          fires or none does, steps. Near a step the deviation does not go
+//          down with the size of the cells, so Bake also stops when it no
+//          longer improves. The surface is then further from the program
+//          than the tolerance, which MaxError tells.
+//
+//-----------------------------------------------------------------------------
+#include <vector>
+
+
+class FuzzyProgram;
+
+
+class FuzzySurface
+{
+private:
+
+  //the number of samples along each input. m_iNumY is 1 for one input
+  int                 m_iNumX;
+  int                 m_iNumY;
+
+  double              m_dMinX;
+  double              m_dMinY;
+
+  //the number of cells per unit of each input
+  double              m_dScaleX;
+  double              m_dScaleY;
+
+  //sample (x, y) is m_Values[y*m_iNumX + x]
+  std::vector<double> m_Values;
+
+  //the largest deviation found by Bake
+  double              m_dMaxError;
+
+  void   Sample(FuzzyProgram& prog, int NumSamples);
+
+public:
+
+  FuzzySurface();
+
+  //samples the program, starting with Resolution samples along each input.
+  //The resolution goes from n to 2n-1 until the deviation is no more than
+  //Tolerance, stops going down or the resolution would exceed MaxResolution
+  void   Bake(FuzzyProgram& prog,
+              int           Resolution,
+              double        Tolerance,
+              int           MaxResolution = 257);
+
+  bool   isBaked()const{return !m_Values.empty();}
+
+  int    Resolution()const{return m_iNumX;}
+  double MaxError()const{return m_dMaxError;}
+
+  //the interpolated output. Inputs outside the ranges are clamped to them
+  double Evaluate(double x, double y = 0.0)const;
+
+  //the largest difference between the program and the surface at the
+  //points dividing each cell into SamplesPerCell parts along each input.
+  //The inputs where it occurs are written to pWorstX and pWorstY and the
+  //mean difference to pMean, if given
+  double Deviation(FuzzyProgram& prog,
+                   int           SamplesPerCell,
+                   double*       pWorstX = 0,
+                   double*       pWorstY = 0,
+                   double*       pMean = 0)const;
+};
+
+
+
+#endif
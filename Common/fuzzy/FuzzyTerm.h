@@ -10,6 +10,9 @@
 //          used as terms in a fuzzy if-then rule base.
 //-----------------------------------------------------------------------------
 
+class FuzzyProgram;
+
+
 class FuzzyTerm
 {  
 public:
@@ -28,6 +31,12 @@ public:
   //method for updating the DOM of a consequent when a rule fires
   virtual void       ORwithDOM(double val)=0;
 
+  //emit the ops doing the same as GetDOM and ORwithDOM. See FuzzyProgram.
+  //The ops of GetDOM leave the DOM on top of the stack, those of ORwithDOM
+  //use the value on top of the stack and leave it there
+  virtual void       CompileGetDOM(FuzzyProgram& prog)const=0;
+  virtual void       CompileORwithDOM(FuzzyProgram& prog)const=0;
+
    
 };
 
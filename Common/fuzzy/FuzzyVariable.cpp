@@ -1,6 +1,6 @@
-#include "fuzzy/fuzzyvariable.h"
-#include "fuzzy/fuzzyoperators.h"
-#include "fuzzy/FuzzySet_triangle.h"
+#include "fuzzy/FuzzyVariable.h"
+#include "fuzzy/FuzzyOperators.h"
+#include "fuzzy/FuzzySet_Triangle.h"
 #include "fuzzy/FuzzySet_LeftShoulder.h"
 #include "fuzzy/FuzzySet_RightShoulder.h"
 #include "fuzzy/FuzzySet_Singleton.h"
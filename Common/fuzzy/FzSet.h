@@ -11,6 +11,7 @@
 //-----------------------------------------------------------------------------
 #include "FuzzyTerm.h"
 #include "FuzzySet.h"
+#include "FuzzyProgram.h"
 
 class FzAND;
 
@@ -35,6 +36,16 @@ public:
   double     GetDOM()const {return m_Set.GetDOM();}
   void       ClearDOM(){m_Set.ClearDOM();}
   void       ORwithDOM(double val){m_Set.ORwithDOM(val);}
+
+  void       CompileGetDOM(FuzzyProgram& prog)const
+  {
+    prog.Emit(FuzzyProgram::op_push, prog.SetHandle(&m_Set));
+  }
+
+  void       CompileORwithDOM(FuzzyProgram& prog)const
+  {
+    prog.Emit(FuzzyProgram::op_or_into, prog.SetHandle(&m_Set));
+  }
 };
 
 
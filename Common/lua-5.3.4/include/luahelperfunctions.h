@@ -112,7 +112,7 @@ inline bool PopLuaBool(lua_State* pL, const char* name)
 
   //check that the variable is the correct type. If it is not throw an
   //exception
-  if (!lua_isstring(pL, 1))
+  if (!lua_isboolean(pL, 1))
   {
     std::string err("<PopLuaBool> Cannot retrieve: ");
 
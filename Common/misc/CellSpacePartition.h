@@ -22,8 +22,8 @@
 #include <list>
 #include <cassert>
 
-#include "2d/Vector2D.h"
-#include "2d/InvertedAABBox2D.h"
+#include "2D/Vector2D.h"
+#include "2D/InvertedAABBox2D.h"
 #include "misc/utils.h"
 
 
@@ -102,6 +102,13 @@ public:
   //next and end methods to iterate through the vector.
   inline void CalculateNeighbors(Vector2D TargetPos, double QueryRadius);
 
+  //as above but the neighbors are written to the given vector instead of
+  //the partition's own. This does not modify the partition so it may be
+  //called by several threads at once
+  inline void CalculateNeighbors(Vector2D             TargetPos,
+                                 double               QueryRadius,
+                                 std::vector<entity>& Neighbors)const;
+
   //returns a reference to the entity at the front of the neighbor vector
   inline entity& begin(){m_curNeighbor = m_Neighbors.begin(); return *m_curNeighbor;}
 
@@ -167,7 +174,7 @@ void CellSpacePartition<entity>::CalculateNeighbors(Vector2D TargetPos,
                                                     double   QueryRadius)
 {
   //create an iterator and set it to the beginning of the neighbor vector
-  std::vector<entity>::iterator curNbor = m_Neighbors.begin();
+  typename std::vector<entity>::iterator curNbor = m_Neighbors.begin();
   
   //create the query box that is the bounding box of the target's query
   //area
@@ -177,7 +184,7 @@ void CellSpacePartition<entity>::CalculateNeighbors(Vector2D TargetPos,
   //iterate through each cell and test to see if its bounding box overlaps
   //with the query box. If it does and it also contains entities then
   //make further proximity tests.
-  std::vector<Cell<entity> >::iterator curCell; 
+  typename std::vector<Cell<entity> >::iterator curCell; 
   for (curCell=m_Cells.begin(); curCell!=m_Cells.end(); ++curCell)
   {
     //test to see if this cell contains members and if it overlaps the
@@ -186,7 +193,7 @@ void CellSpacePartition<entity>::CalculateNeighbors(Vector2D TargetPos,
        !curCell->Members.empty())
     {
       //add any entities found within query radius to the neighbor list
-      std::list<entity>::iterator it = curCell->Members.begin();
+      typename std::list<entity>::iterator it = curCell->Members.begin();
       for (it; it!=curCell->Members.end(); ++it)
       {     
         if (Vec2DDistanceSq((*it)->Pos(), TargetPos) <
@@ -203,6 +210,37 @@ void CellSpacePartition<entity>::CalculateNeighbors(Vector2D TargetPos,
 }
 
 
+//----------------------- CalculateNeighbors ----------------------------
+//------------------------------------------------------------------------
+template<class entity>
+void CellSpacePartition<entity>::CalculateNeighbors(Vector2D             TargetPos,
+                                                    double               QueryRadius,
+                                                    std::vector<entity>& Neighbors)const
+{
+  Neighbors.clear();
+
+  InvertedAABBox2D QueryBox(TargetPos - Vector2D(QueryRadius, QueryRadius),
+                            TargetPos + Vector2D(QueryRadius, QueryRadius));
+
+  typename std::vector<Cell<entity> >::const_iterator curCell; 
+  for (curCell=m_Cells.begin(); curCell!=m_Cells.end(); ++curCell)
+  {
+    if (curCell->BBox.isOverlappedWith(QueryBox) &&
+       !curCell->Members.empty())
+    {
+      typename std::list<entity>::const_iterator it = curCell->Members.begin();
+      for (it; it!=curCell->Members.end(); ++it)
+      {     
+        if (Vec2DDistanceSq((*it)->Pos(), TargetPos) <
+            QueryRadius*QueryRadius)
+        {
+          Neighbors.push_back(*it);
+        }
+      }    
+    }
+  }//next cell
+}
+
 //--------------------------- Empty --------------------------------------
 //
 //  clears the cells of all entities
@@ -210,7 +248,7 @@ void CellSpacePartition<entity>::CalculateNeighbors(Vector2D TargetPos,
 template<class entity>
 void CellSpacePartition<entity>::EmptyCells()
 {
-  std::vector<Cell<entity> >::iterator it = m_Cells.begin();
+  typename std::vector<Cell<entity> >::iterator it = m_Cells.begin();
 
   for (it; it!=m_Cells.end(); ++it)
   {
@@ -278,7 +316,7 @@ inline void CellSpacePartition<entity>::UpdateEntity(const entity&  ent,
 template<class entity>
 inline void CellSpacePartition<entity>::RenderCells()const
 {
-  std::vector<Cell<entity> >::const_iterator curCell;
+  typename std::vector<Cell<entity> >::const_iterator curCell;
   for (curCell=m_Cells.begin(); curCell!=m_Cells.end(); ++curCell)
   {
     curCell->BBox.Render(false);
@@ -13,6 +13,13 @@
 //  Author: Mat Buckland 2001 (fup@ai-junkie.com)
 //
 //------------------------------------------------------------------------
+#ifdef HEADLESS
+
+//no rendering at all. See NullCgdi.h
+#include "misc/NullCgdi.h"
+
+#else
+
 #include <windows.h>
 #include <string>
 #include <vector>
@@ -387,4 +394,6 @@ public:
   }
 };
 
+#endif //HEADLESS
+
 #endif
\ No newline at end of file
@@ -0,0 +1,274 @@
+#ifndef ENTITYGRID_H
+#define ENTITYGRID_H
+//-----------------------------------------------------------------------------
+//
+//  Name:   EntityGrid.h
+//
+//  Desc:   a uniform grid of cells for fast proximity queries on entities
+//          which move every update (bots for example). Unlike the
+//          CellSpacePartition, entities are not moved from cell to cell
+//          as they move: the whole grid is rebuilt from scratch with a call
+//          to Rebuild once per update-step. This is a counting sort of the
+//          entities by cell index into a single array, so it costs
+//          O(entities + cells) and does not allocate once the buffers have
+//          grown to size.
+//
+//          The queries return the entities found in the cells touched by
+//          a line segment or a circle. They are candidates only: the
+//          caller should make its exact test on each of them. Candidates
+//          are returned in the order the entities were given to Rebuild,
+//          so a query gives the same results, in the same order, as a
+//          loop over every entity would.
+//
+//          The results are written into a buffer owned by the grid, which
+//          is overwritten by the next query. The caller may filter it in
+//          place.
+//
+//          The entity type must be a pointer to a class with the methods
+//          Pos() and BRadius()
+//
+//-----------------------------------------------------------------------------
+#include <vector>
+#include <algorithm>
+
+#include "2D/Vector2D.h"
+#include "misc/utils.h"
+
+
+template <class entity>
+class EntityGrid
+{
+private:
+
+  struct Entry
+  {
+    entity Ent;
+
+    //the position of the entity in the sequence given to Rebuild
+    int    Order;
+
+    bool operator<(const Entry& rhs)const{return Order < rhs.Order;}
+  };
+
+  //the width and height of the world space the entities inhabit
+  double              m_dSpaceWidth;
+  double              m_dSpaceHeight;
+
+  int                 m_iNumCellsX;
+  int                 m_iNumCellsY;
+
+  double              m_dCellSizeX;
+  double              m_dCellSizeY;
+
+  //the entities of cell c are m_Entries[m_CellStart[c]] to
+  //m_Entries[m_CellStart[c+1]-1]
+  std::vector<int>    m_CellStart;
+  std::vector<Entry>  m_Entries;
+
+  //the cell of each entity, in the order they were added
+  std::vector<int>    m_EntityCell;
+
+  //the largest bounding radius of the entities in the grid. Queries are
+  //widened by this amount so that an entity overlapping a cell other than
+  //the one holding its center is still found
+  double              m_dMaxRadius;
+
+  //query results
+  std::vector<Entry>  m_Found;
+  std::vector<entity> m_Result;
+
+  int  CellX(double x)const{return Clamped((int)(x / m_dCellSizeX), m_iNumCellsX);}
+  int  CellY(double y)const{return Clamped((int)(y / m_dCellSizeY), m_iNumCellsY);}
+
+  static int Clamped(int i, int NumCells)
+  {
+    if (i < 0)         return 0;
+    if (i >= NumCells) return NumCells-1;
+    return i;
+  }
+
+  //adds the members of the cells [x0, x1] of row y to m_Found
+  void GatherRow(int y, int x0, int x1)
+  {
+    for (int x=x0; x<=x1; ++x)
+    {
+      const int c = y*m_iNumCellsX + x;
+
+      for (int e=m_CellStart[c]; e<m_CellStart[c+1]; ++e)
+      {
+        m_Found.push_back(m_Entries[e]);
+      }
+    }
+  }
+
+  //sorts the candidates into the order they were added and copies them
+  //into the result buffer
+  std::vector<entity>& Finish()
+  {
+    std::sort(m_Found.begin(), m_Found.end());
+
+    m_Result.clear();
+
+    for (unsigned int i=0; i<m_Found.size(); ++i)
+    {
+      m_Result.push_back(m_Found[i].Ent);
+    }
+
+    return m_Result;
+  }
+
+public:
+
+  EntityGrid():m_dSpaceWidth(1),
+               m_dSpaceHeight(1),
+               m_iNumCellsX(1),
+               m_iNumCellsY(1),
+               m_dCellSizeX(1),
+               m_dCellSizeY(1),
+               m_CellStart(2, 0),
+               m_dMaxRadius(0)
+  {}
+
+  //sets the size of the space and the number of cells. The grid is
+  //emptied
+  void Resize(double width, double height, int cellsX, int cellsY)
+  {
+    m_dSpaceWidth  = width;
+    m_dSpaceHeight = height;
+    m_iNumCellsX   = MaxOf(cellsX, 1);
+    m_iNumCellsY   = MaxOf(cellsY, 1);
+    m_dCellSizeX   = m_dSpaceWidth  / m_iNumCellsX;
+    m_dCellSizeY   = m_dSpaceHeight / m_iNumCellsY;
+
+    m_CellStart.assign(m_iNumCellsX*m_iNumCellsY + 1, 0);
+    m_Entries.clear();
+    m_dMaxRadius = 0;
+  }
+
+  //replaces the content of the grid with the entities in [begin, end)
+  template <class iterator>
+  void Rebuild(iterator begin, iterator end)
+  {
+    const int NumCells = m_iNumCellsX*m_iNumCellsY;
+
+    m_EntityCell.clear();
+    m_CellStart.assign(NumCells + 1, 0);
+    m_dMaxRadius = 0;
+
+    //count the entities in each cell
+    for (iterator it=begin; it!=end; ++it)
+    {
+      const int c = CellY((*it)->Pos().y)*m_iNumCellsX + CellX((*it)->Pos().x);
+
+      m_EntityCell.push_back(c);
+
+      ++m_CellStart[c+1];
+
+      if ((*it)->BRadius() > m_dMaxRadius) m_dMaxRadius = (*it)->BRadius();
+    }
+
+    //turn the counts into the index of the first entity of each cell
+    for (int c=0; c<NumCells; ++c)
+    {
+      m_CellStart[c+1] += m_CellStart[c];
+    }
+
+    //and put each entity in its place
+    m_Entries.resize(m_EntityCell.size());
+
+    int order = 0;
+    for (iterator it=begin; it!=end; ++it, ++order)
+    {
+      const int c = m_EntityCell[order];
+
+      //m_CellStart[c] is used as the insertion point and moved back below
+      Entry& e = m_Entries[m_CellStart[c]++];
+
+      e.Ent   = *it;
+      e.Order = order;
+    }
+
+    for (int c=NumCells; c>0; --c)
+    {
+      m_CellStart[c] = m_CellStart[c-1];
+    }
+
+    m_CellStart[0] = 0;
+  }
+
+  //returns the entities that may be closer than radius (plus their own
+  //bounding radius) to pos
+  std::vector<entity>& QueryCircle(Vector2D pos, double radius)
+  {
+    m_Found.clear();
+
+    const double r = radius + m_dMaxRadius;
+
+    const int x0 = CellX(pos.x - r), x1 = CellX(pos.x + r);
+    const int y0 = CellY(pos.y - r), y1 = CellY(pos.y + r);
+
+    for (int y=y0; y<=y1; ++y)
+    {
+      GatherRow(y, x0, x1);
+    }
+
+    return Finish();
+  }
+
+  //returns the entities whose bounding circle may intersect the line
+  //segment From-To. Only the cells the segment passes through (widened by
+  //the largest bounding radius) are visited
+  std::vector<entity>& QuerySegment(Vector2D From, Vector2D To)
+  {
+    m_Found.clear();
+
+    const double pad = m_dMaxRadius;
+
+    const Vector2D d = To - From;
+
+    const int y0 = CellY(MinOf(From.y, To.y) - pad);
+    const int y1 = CellY(MaxOf(From.y, To.y) + pad);
+
+    for (int y=y0; y<=y1; ++y)
+    {
+      //the part of the segment lying in this row of cells (widened by pad)
+      double xmin, xmax;
+
+      if (IsZero(d.y))
+      {
+        xmin = MinOf(From.x, To.x);
+        xmax = MaxOf(From.x, To.x);
+      }
+      else
+      {
+        double t0 = (y * m_dCellSizeY - pad - From.y) / d.y;
+        double t1 = ((y+1) * m_dCellSizeY + pad - From.y) / d.y;
+
+        if (t0 > t1) std::swap(t0, t1);
+
+        //the first and last rows are clamped so they extend to infinity
+        if (y == 0)              {if (d.y > 0) t0 = 0; else t1 = 1;}
+        if (y == m_iNumCellsY-1) {if (d.y > 0) t1 = 1; else t0 = 0;}
+
+        t0 = MaxOf(t0, 0.0);
+        t1 = MinOf(t1, 1.0);
+
+        if (t0 > t1) continue;
+
+        const double xa = From.x + t0*d.x;
+        const double xb = From.x + t1*d.x;
+
+        xmin = MinOf(xa, xb);
+        xmax = MaxOf(xa, xb);
+      }
+
+      GatherRow(y, CellX(xmin - pad), CellX(xmax + pad));
+    }
+
+    return Finish();
+  }
+};
+
+
+
+#endif
@@ -1,8 +1,12 @@
-#include "framecounter.h"
+#include "FrameCounter.h"
 
 
+thread_local FrameCounter* FrameCounter::m_pThreadInstance = 0;
+
 FrameCounter* FrameCounter::Instance()
 {
+  if (m_pThreadInstance) return m_pThreadInstance;
+
   static FrameCounter instance;
 
   return &instance;
@@ -12,6 +12,12 @@ private:
 
   int  m_iFramesElapsed;
 
+  //when set, the instance returned by Instance() for the calling thread
+  //(see WorldContext)
+  static thread_local FrameCounter* m_pThreadInstance;
+
+  friend class WorldContext;
+
   FrameCounter():m_lCount(0), m_iFramesElapsed(0){}
 
   //copy ctor and assignment should be private
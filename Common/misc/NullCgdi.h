@@ -0,0 +1,143 @@
+#ifndef NULL_CGDI_H
+#define NULL_CGDI_H
+//------------------------------------------------------------------------
+//
+//  Name:   NullCgdi.h
+//
+//  Desc:   stand in for the Cgdi class used when HEADLESS is defined.
+//          It has the same interface as the real thing but every method
+//          does nothing, so the game code can keep its rendering calls
+//          and be compiled on platforms without the Windows GDI (a dedicated
+//          server, a batch of simulations run from the command line...)
+//
+//------------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+#include "2D/Vector2D.h"
+
+
+const int NumColors = 15;
+
+//make life easier on the fingers
+#define gdi Cgdi::Instance()
+
+class Cgdi
+{
+public:
+
+  int NumPenColors()const{return NumColors;}
+
+  //enumerate some colors
+  enum
+  {
+    red,
+    blue,
+    green,
+    black,
+    pink,
+    grey,
+    yellow,
+    orange,
+    purple,
+    brown,
+    white,
+    dark_green,
+    light_blue,
+    light_grey,
+    light_pink,
+    hollow
+  };
+
+private:
+
+  Cgdi(){}
+
+  //copy ctor and assignment should be private
+  Cgdi(const Cgdi&);
+  Cgdi& operator=(const Cgdi&);
+
+public:
+
+  static Cgdi* Instance(){static Cgdi instance; return &instance;}
+
+  void BlackPen(){}
+  void WhitePen(){}
+  void RedPen()  {}
+  void GreenPen(){}
+  void BluePen() {}
+  void GreyPen() {}
+  void PinkPen() {}
+  void YellowPen() {}
+  void OrangePen() {}
+  void PurplePen() {}
+  void BrownPen() {}
+
+  void DarkGreenPen() {}
+  void LightBluePen() {}
+  void LightGreyPen() {}
+  void LightPinkPen() {}
+
+  void ThickBlackPen(){}
+  void ThickWhitePen(){}
+  void ThickRedPen()  {}
+  void ThickGreenPen(){}
+  void ThickBluePen() {}
+
+  void BlackBrush(){}
+  void WhiteBrush(){}
+  void HollowBrush(){}
+  void GreenBrush(){}
+  void RedBrush()  {}
+  void BlueBrush()  {}
+  void GreyBrush()  {}
+  void BrownBrush() {}
+  void YellowBrush() {}
+  void LightBlueBrush() {}
+  void DarkGreenBrush() {}
+  void OrangeBrush() {}
+
+  //---------------------------Text
+
+  void TextAtPos(int, int, const std::string&){}
+  void TextAtPos(double, double, const std::string&){}
+  void TextAtPos(Vector2D, const std::string&){}
+
+  void TransparentText(){}
+  void OpaqueText(){}
+
+  void TextColor(int){}
+  void TextColor(int, int, int){}
+
+  //----------------------------pixels
+  void DrawDot(Vector2D, unsigned long){}
+  void DrawDot(int, int, unsigned long){}
+
+  //-------------------------Line Drawing
+
+  void Line(Vector2D, Vector2D){}
+  void Line(int, int, int, int){}
+  void Line(double, double, double, double){}
+
+  void PolyLine(const std::vector<Vector2D>&){}
+
+  void LineWithArrow(Vector2D, Vector2D, double){}
+
+  void Cross(Vector2D, int){}
+
+  //---------------------Geometry drawing methods
+
+  void Rect(int, int, int, int){}
+  void Rect(double, double, double, double){}
+
+  void ClosedShape(const std::vector<Vector2D>&){}
+
+  void Circle(Vector2D, double){}
+  void Circle(double, double, double){}
+  void Circle(int, int, double){}
+
+  void SetPenColor(int){}
+};
+
+
+#endif
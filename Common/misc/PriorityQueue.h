@@ -275,18 +275,42 @@ public:
   const T& peek()const{return m_Heap[1];}
 };
 
+//------------------------- heap policies ------------------------------
+//
+//  the second parameter of IndexedPriorityQLow chooses how it keeps its
+//  items. A d-ary heap is shallower than a binary one, so an item moving
+//  up it, which is what ChangePriority does, makes fewer swaps, while
+//  Pop looks at more children on each level. The radix heap keeps the
+//  items in buckets by the highest bit in which their keys differ from the
+//  last key popped. It only works when every key is a whole number no
+//  smaller than the last key popped, as with Dijkstra's algorithm, or A*
+//  with a consistent heuristic, on a graph whose costs are whole numbers.
+//------------------------------------------------------------------------
+template <int D>
+struct HeapPolicy_Dary
+{
+  enum {Arity = D};
+};
+
+typedef HeapPolicy_Dary<2> HeapPolicy_Binary;
+typedef HeapPolicy_Dary<4> HeapPolicy_4ary;
+
+struct HeapPolicy_Radix {};
+
 //----------------------- IndexedPriorityQLow ---------------------------
 //
 //  Priority queue based on an index into a set of keys. The queue is
-//  maintained as a 2-way heap.
+//  maintained as a d-way heap, 2-way unless the policy says otherwise.
 //
 //  The priority in this implementation is the lowest valued key
 //------------------------------------------------------------------------
-template<class KeyType>
+template<class KeyType, class heap_policy = HeapPolicy_Binary>
 class IndexedPriorityQLow
 {
 private:
 
+  enum {Arity = heap_policy::Arity};
+
   std::vector<KeyType>&  m_vecKeys;
 
   std::vector<int>       m_Heap;
@@ -296,6 +320,10 @@ private:
   int                    m_iSize,
                          m_iMaxSize;
 
+  //the heap starts at 1, so the children of nd are Arity*(nd-1)+2 on
+  static int Parent(int nd){return (nd-2) / Arity + 1;}
+  static int FirstChild(int nd){return Arity*(nd-1) + 2;}
+
   void Swap(int a, int b)
   {
     int temp = m_Heap[a]; m_Heap[a] = m_Heap[b]; m_Heap[b] = temp;
@@ -307,11 +335,11 @@ private:
   void ReorderUpwards(int nd)
   {
     //move up the heap swapping the elements until the heap is ordered
-    while ( (nd>1) && (m_vecKeys[m_Heap[nd/2]] > m_vecKeys[m_Heap[nd]]) )
+    while ( (nd>1) && (m_vecKeys[m_Heap[Parent(nd)]] > m_vecKeys[m_Heap[nd]]) )
     {      
-      Swap(nd/2, nd);
+      Swap(Parent(nd), nd);
 
-      nd /= 2;
+      nd = Parent(nd);
     }
   }
 
@@ -319,14 +347,16 @@ private:
   {
     //move down the heap from node nd swapping the elements until
     //the heap is reordered
-    while (2*nd <= HeapSize)
+    while (FirstChild(nd) <= HeapSize)
     {
-      int child = 2 * nd;
+      int child = FirstChild(nd);
+
+      //set child to the smallest of nd's children
+      const int last = child + Arity - 1 < HeapSize ? child + Arity - 1 : HeapSize;
 
-      //set child to smaller of nd's two children
-      if ((child < HeapSize) && (m_vecKeys[m_Heap[child]] > m_vecKeys[m_Heap[child+1]]))
+      for (int c=child+1; c<=last; ++c)
       {
-        ++child;
+        if (m_vecKeys[m_Heap[child]] > m_vecKeys[m_Heap[c]]) child = c;
       }
 
       //if this nd is larger than its child, swap
@@ -360,6 +390,7 @@ public:
   }
 
   bool empty()const{return (m_iSize==0);}
+  int  size()const{return m_iSize;}
 
   //to insert an item into the queue it gets added to the end of the heap
   //and then the heap is reordered from the bottom up.
@@ -376,6 +407,9 @@ public:
     ReorderUpwards(m_iSize);
   }
 
+  //returns the min item without removing it
+  int Peek()const{assert (m_iSize > 0); return m_Heap[1];}
+
   //to get the min item the first element is exchanged with the lowest
   //in the heap and then the heap is reordered from the top down. 
   int Pop()
@@ -395,5 +429,171 @@ public:
   }
 };
 
+//----------------------- IndexedPriorityQLow ---------------------------
+//
+//  the same queue kept as a radix heap. Bucket 0 holds the items whose
+//  keys equal the last key popped and bucket b those whose keys first
+//  differ from it in bit b-1. An item only ever moves to a lower bucket,
+//  so over its time in the queue it is moved at most once per bucket.
+//  Pop empties the lowest bucket holding anything into the ones below it
+//  when bucket 0 is empty.
+//------------------------------------------------------------------------
+template<class KeyType>
+class IndexedPriorityQLow<KeyType, HeapPolicy_Radix>
+{
+private:
+
+  typedef unsigned long long Radix;
+
+  enum {NumBuckets = 65};
+
+  std::vector<KeyType>&          m_vecKeys;
+
+  //mutable so Peek can bring the min items down to bucket 0
+  mutable std::vector<int>       m_Buckets[NumBuckets];
+
+  //indexed by item. The bucket it is in and where in it
+  mutable std::vector<int>       m_Bucket;
+  mutable std::vector<int>       m_Position;
+
+  mutable Radix                  m_Last;
+
+  int                            m_iSize,
+                                 m_iMaxSize;
+
+  Radix Key(int idx)const
+  {
+    assert (m_vecKeys[idx] >= 0 && (KeyType)(Radix)m_vecKeys[idx] == m_vecKeys[idx] &&
+            "<IndexedPriorityQLow>: radix heap keys must be whole numbers");
+
+    return (Radix)m_vecKeys[idx];
+  }
+
+  //the bucket an item with the key belongs in, 1 more than the index of the
+  //highest bit in which the key differs from the last key popped
+  int BucketOf(Radix key)const
+  {
+    assert (key >= m_Last && "<IndexedPriorityQLow>: a radix heap key has fallen below the last popped");
+
+    Radix diff = key ^ m_Last;
+
+    if (diff == 0) return 0;
+
+    int bucket = 1;
+
+    if (diff >> 32) {diff >>= 32; bucket += 32;}
+    if (diff >> 16) {diff >>= 16; bucket += 16;}
+    if (diff >> 8)  {diff >>= 8;  bucket += 8;}
+    if (diff >> 4)  {diff >>= 4;  bucket += 4;}
+    if (diff >> 2)  {diff >>= 2;  bucket += 2;}
+    if (diff >> 1)  {             bucket += 1;}
+
+    return bucket;
+  }
+
+  void Add(int idx, int bucket)const
+  {
+    m_Bucket[idx]   = bucket;
+    m_Position[idx] = (int)m_Buckets[bucket].size();
+
+    m_Buckets[bucket].push_back(idx);
+  }
+
+  void Remove(int idx)const
+  {
+    std::vector<int>& bucket = m_Buckets[m_Bucket[idx]];
+
+    const int moved = bucket.back();
+
+    bucket[m_Position[idx]] = moved;
+    m_Position[moved]       = m_Position[idx];
+
+    bucket.pop_back();
+  }
+
+  //makes sure the items with the lowest key are in bucket 0
+  void Settle()const
+  {
+    if (!m_Buckets[0].empty()) return;
+
+    int b = 1;
+
+    while (m_Buckets[b].empty()) ++b;
+
+    std::vector<int>& bucket = m_Buckets[b];
+
+    Radix least = Key(bucket[0]);
+
+    for (unsigned int i=1; i<bucket.size(); ++i)
+    {
+      if (Key(bucket[i]) < least) least = Key(bucket[i]);
+    }
+
+    m_Last = least;
+
+    for (unsigned int i=0; i<bucket.size(); ++i)
+    {
+      Add(bucket[i], BucketOf(Key(bucket[i])));
+    }
+
+    bucket.clear();
+  }
+
+public:
+
+  IndexedPriorityQLow(std::vector<KeyType>& keys,
+                      int              MaxSize):m_vecKeys(keys),
+                                                m_Bucket(MaxSize+1, 0),
+                                                m_Position(MaxSize+1, 0),
+                                                m_Last(0),
+                                                m_iSize(0),
+                                                m_iMaxSize(MaxSize)
+  {}
+
+  bool empty()const{return (m_iSize==0);}
+  int  size()const{return m_iSize;}
+
+  void insert(const int idx)
+  {
+    assert (m_iSize+1 <= m_iMaxSize);
+
+    ++m_iSize;
+
+    Add(idx, BucketOf(Key(idx)));
+  }
+
+  int Peek()const
+  {
+    assert (m_iSize > 0);
+
+    Settle();
+
+    return m_Buckets[0].back();
+  }
+
+  int Pop()
+  {
+    const int idx = Peek();
+
+    m_Buckets[0].pop_back();
+
+    --m_iSize;
+
+    return idx;
+  }
+
+  //the key of the item must have fallen
+  void ChangePriority(const int idx)
+  {
+    const int bucket = BucketOf(Key(idx));
+
+    if (bucket == m_Bucket[idx]) return;
+
+    Remove(idx);
+
+    Add(idx, bucket);
+  }
+};
+
 
 #endif
\ No newline at end of file
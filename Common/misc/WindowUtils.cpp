@@ -1,6 +1,6 @@
 #include "misc/WindowUtils.h"
 #include <windows.h>
-#include "2d/Vector2D.h"
+#include "2D/Vector2D.h"
 #include "misc/utils.h"
 #include "misc/Stream_Utility_Functions.h"
 
@@ -2,9 +2,31 @@
 #define WINDOW_UTILS_H
 #pragma warning (disable:4786)
 
-#include <windows.h>
 #include <string>
 
+#ifdef HEADLESS
+
+//without a window there is no keyboard or mouse to query and errors are
+//reported on the standard error stream
+
+#include <iostream>
+
+#include "2D/Vector2D.h"
+
+#define KEYDOWN(vk_code) 0
+
+#define WAS_KEY_PRESSED(vk_code) false
+#define IS_KEY_PRESSED(vk_code) false
+
+inline void ErrorBox(const std::string& msg){std::cerr << "Error: " << msg << std::endl;}
+inline void ErrorBox(const char* msg){std::cerr << "Error: " << msg << std::endl;}
+
+inline Vector2D GetClientCursorPosition(){return Vector2D();}
+
+#else
+
+#include <windows.h>
+
 struct Vector2D;
 
 //macro to detect keypresses
@@ -79,4 +101,6 @@ int  GetWindowWidth(HWND hwnd);
 
 
 
+#endif //HEADLESS
+
 #endif
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "WorkStealingPool.h"
+
+#include <cassert>
+
+
+//the pool (if any) the current thread is a worker of, and its index
+static thread_local WorkStealingPool* tls_pPool = NULL;
+static thread_local unsigned int      tls_iIndex = 0;
+
+
+//----------------------------- ctor ------------------------------------------
+//-----------------------------------------------------------------------------
+WorkStealingPool::WorkStealingPool(unsigned int NumThreads):m_iNumPending(0),
+                                                            m_iNumQueued(0),
+                                                            m_iNextQueue(0),
+                                                            m_bQuit(false)
+{
+  if (NumThreads == 0)
+  {
+    NumThreads = std::thread::hardware_concurrency();
+
+    if (NumThreads == 0) NumThreads = 1;
+  }
+
+  for (unsigned int i=0; i<NumThreads; ++i)
+  {
+    m_Queues.push_back(new WorkQueue());
+  }
+
+  for (unsigned int i=0; i<NumThreads; ++i)
+  {
+    m_Workers.push_back(std::thread(&WorkStealingPool::WorkerLoop, this, i));
+  }
+}
+
+//------------------------------ dtor -----------------------------------------
+//-----------------------------------------------------------------------------
+WorkStealingPool::~WorkStealingPool()
+{
+  Wait();
+
+  {
+    std::lock_guard<std::mutex> lock(m_WakeLock);
+    m_bQuit = true;
+  }
+
+  m_WakeCondition.notify_all();
+
+  for (unsigned int i=0; i<m_Workers.size(); ++i)
+  {
+    m_Workers[i].join();
+  }
+
+  for (unsigned int i=0; i<m_Queues.size(); ++i)
+  {
+    delete m_Queues[i];
+  }
+}
+
+//------------------------------ Submit ---------------------------------------
+//-----------------------------------------------------------------------------
+void WorkStealingPool::Submit(const Task& task)
+{
+  unsigned int index;
+
+  if (tls_pPool == this)
+  {
+    index = tls_iIndex;
+  }
+  else
+  {
+    index = m_iNextQueue++ % m_Queues.size();
+  }
+
+  ++m_iNumPending;
+
+  {
+    std::lock_guard<std::mutex> lock(m_Queues[index]->Lock);
+    m_Queues[index]->Tasks.push_back(task);
+  }
+
+  //the wake lock is taken before notifying so that a worker testing the
+  //queued count cannot miss this task and go to sleep
+  {
+    std::lock_guard<std::mutex> lock(m_WakeLock);
+    ++m_iNumQueued;
+  }
+
+  m_WakeCondition.notify_one();
+}
+
+//----------------------------- ParallelFor -----------------------------------
+//-----------------------------------------------------------------------------
+void WorkStealingPool::ParallelFor(int begin,
+                                   int end,
+                                   int GrainSize,
+                                   const std::function<void(int, int)>& body)
+{
+  if (GrainSize < 1) GrainSize = 1;
+
+  //the chunks of this call not yet completed
+  std::atomic<int> NumRemaining((end - begin + GrainSize - 1) / GrainSize);
+
+  for (int ChunkBegin = begin; ChunkBegin < end; ChunkBegin += GrainSize)
+  {
+    int ChunkEnd = ChunkBegin + GrainSize < end ? ChunkBegin + GrainSize : end;
+
+    Submit([this, &body, &NumRemaining, ChunkBegin, ChunkEnd]
+    {
+      body(ChunkBegin, ChunkEnd);
+
+      if (--NumRemaining == 0)
+      {
+        std::lock_guard<std::mutex> lock(m_DoneLock);
+
+        m_DoneCondition.notify_all();
+      }
+    });
+  }
+
+  while (NumRemaining > 0)
+  {
+    if (!ExecuteQueued())
+    {
+      std::unique_lock<std::mutex> lock(m_DoneLock);
+
+      m_DoneCondition.wait(lock, [&]{ return NumRemaining == 0 || m_iNumQueued > 0; });
+    }
+  }
+}
+
+//-------------------------------- Wait ---------------------------------------
+//
+//  the calling thread steals work until there is none left to take and then
+//  sleeps until the tasks still in flight have completed
+//-----------------------------------------------------------------------------
+void WorkStealingPool::Wait()
+{
+  assert (tls_pPool != this && "<WorkStealingPool::Wait>: called from within a worker");
+
+  while (m_iNumPending > 0)
+  {
+    if (!ExecuteQueued())
+    {
+      std::unique_lock<std::mutex> lock(m_DoneLock);
+
+      m_DoneCondition.wait(lock, [this]{ return m_iNumPending == 0 || m_iNumQueued > 0; });
+    }
+  }
+}
+
+//----------------------------- WorkerLoop ------------------------------------
+//-----------------------------------------------------------------------------
+void WorkStealingPool::WorkerLoop(unsigned int index)
+{
+  tls_pPool  = this;
+  tls_iIndex = index;
+
+  Task task;
+
+  while (true)
+  {
+    if (PopLocal(index, task) || Steal(index, task))
+    {
+      Execute(task);
+
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_WakeLock);
+
+    m_WakeCondition.wait(lock, [this]{ return m_bQuit || m_iNumQueued > 0; });
+
+    if (m_bQuit) return;
+  }
+}
+
+//------------------------------ PopLocal -------------------------------------
+//-----------------------------------------------------------------------------
+bool WorkStealingPool::PopLocal(unsigned int index, Task& task)
+{
+  WorkQueue* q = m_Queues[index];
+
+  std::lock_guard<std::mutex> lock(q->Lock);
+
+  if (q->Tasks.empty()) return false;
+
+  task = q->Tasks.back();
+  q->Tasks.pop_back();
+
+  --m_iNumQueued;
+
+  return true;
+}
+
+//-------------------------------- Steal --------------------------------------
+//-----------------------------------------------------------------------------
+bool WorkStealingPool::Steal(unsigned int thief, Task& task)
+{
+  const unsigned int NumQueues = m_Queues.size();
+
+  //start with the thief's neighbor so that thieves spread out
+  for (unsigned int i=1; i<=NumQueues; ++i)
+  {
+    unsigned int victim = (thief + i) % NumQueues;
+
+    if (victim == thief) continue;
+
+    WorkQueue* q = m_Queues[victim];
+
+    std::lock_guard<std::mutex> lock(q->Lock);
+
+    if (!q->Tasks.empty())
+    {
+      task = q->Tasks.front();
+      q->Tasks.pop_front();
+
+      --m_iNumQueued;
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//------------------------------- Execute -------------------------------------
+//-----------------------------------------------------------------------------
+void WorkStealingPool::Execute(Task& task)
+{
+  task();
+
+  task = Task();
+
+  if (--m_iNumPending == 0)
+  {
+    std::lock_guard<std::mutex> lock(m_DoneLock);
+
+    m_DoneCondition.notify_all();
+  }
+}
+
+//---------------------------- ExecuteQueued ----------------------------------
+//-----------------------------------------------------------------------------
+bool WorkStealingPool::ExecuteQueued()
+{
+  Task task;
+
+  if (tls_pPool == this)
+  {
+    if (!PopLocal(tls_iIndex, task) && !Steal(tls_iIndex, task)) return false;
+  }
+  else
+  {
+    if (!Steal(m_Queues.size(), task)) return false;
+  }
+
+  Execute(task);
+
+  return true;
+}
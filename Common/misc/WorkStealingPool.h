@@ -0,0 +1,111 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+//------------------------------------------------------------------------
+//
+//  Name:   WorkStealingPool.h
+//
+//  Desc:   a fixed size pool of worker threads. Each worker owns a deque
+//          of tasks: it pushes and pops work at the back of its own deque
+//          and, when that runs dry, steals from the front of the other
+//          workers' deques. The thread calling Wait() or ParallelFor()
+//          helps to execute queued tasks until the work it waits for has
+//          completed.
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+
+class WorkStealingPool
+{
+public:
+
+  typedef std::function<void()> Task;
+
+private:
+
+  //one of these per worker. The owner works on the back, thieves on the front
+  struct WorkQueue
+  {
+    std::mutex       Lock;
+    std::deque<Task> Tasks;
+  };
+
+  std::vector<WorkQueue*>   m_Queues;
+
+  std::vector<std::thread>  m_Workers;
+
+  //the number of tasks submitted but not yet completed
+  std::atomic<int>          m_iNumPending;
+
+  //the number of tasks sitting in one of the queues
+  std::atomic<int>          m_iNumQueued;
+
+  //used to distribute tasks submitted from outside the pool
+  std::atomic<unsigned int> m_iNextQueue;
+
+  bool                      m_bQuit;
+
+  //idle workers sleep on this until work is submitted
+  std::mutex                m_WakeLock;
+  std::condition_variable   m_WakeCondition;
+
+  //Wait() sleeps on this until all pending tasks are complete
+  std::mutex                m_DoneLock;
+  std::condition_variable   m_DoneCondition;
+
+  void WorkerLoop(unsigned int index);
+
+  //pops a task from the back of the given queue
+  bool PopLocal(unsigned int index, Task& task);
+
+  //attempts to take a task from the front of any queue other than the
+  //one given. (pass an out of range index to try every queue)
+  bool Steal(unsigned int thief, Task& task);
+
+  //runs a task and does the book keeping
+  void Execute(Task& task);
+
+  //runs one queued task, preferring the calling worker's own deque.
+  //Returns false if there was none to take
+  bool ExecuteQueued();
+
+  //copy ctor and assignment should be private
+  WorkStealingPool(const WorkStealingPool&);
+  WorkStealingPool& operator=(const WorkStealingPool&);
+
+public:
+
+  //a NumThreads of zero creates one worker per hardware thread
+  explicit WorkStealingPool(unsigned int NumThreads = 0);
+
+  ~WorkStealingPool();
+
+  //queues a task for execution. Tasks submitted from within a worker are
+  //pushed onto that worker's own deque
+  void Submit(const Task& task);
+
+  //splits the range [begin, end) into chunks of GrainSize elements and
+  //submits one task per chunk. Each task calls body(ChunkBegin, ChunkEnd).
+  //Returns once every chunk has been processed. Only this call's chunks are
+  //waited for, so it may be called from within a task.
+  void ParallelFor(int begin,
+                   int end,
+                   int GrainSize,
+                   const std::function<void(int, int)>& body);
+
+  //blocks until every submitted task has completed. That includes the task
+  //calling it, so it must not be called from within a worker of the pool
+  void Wait();
+
+  unsigned int NumThreads()const{return m_Workers.size();}
+};
+
+
+
+#endif
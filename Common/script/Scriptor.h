@@ -39,7 +39,7 @@ public:
 
   ~Scriptor(){lua_close(m_pLuaState);}
 
-  void RunScriptFile(char* ScriptName)
+  void RunScriptFile(const char* ScriptName)
   {
      RunLuaScript(m_pLuaState, ScriptName);
   }
@@ -47,27 +47,27 @@ public:
   lua_State* GetState(){return m_pLuaState;}
 
 
-  int GetInt(char* VariableName)
+  int GetInt(const char* VariableName)
   {
     return PopLuaNumber<int>(m_pLuaState, VariableName);
   }
     
-  double GetFloat(char* VariableName)
+  double GetFloat(const char* VariableName)
   {
     return PopLuaNumber<float>(m_pLuaState, VariableName);
   }
 
-  double GetDouble(char* VariableName)
+  double GetDouble(const char* VariableName)
   {
     return PopLuaNumber<double>(m_pLuaState, VariableName);
   }
 
-  std::string GetString(char* VariableName)
+  std::string GetString(const char* VariableName)
   {
     return PopLuaString(m_pLuaState, VariableName);
   }
 
-  bool GetBool(char* VariableName)
+  bool GetBool(const char* VariableName)
   {
     return PopLuaBool(m_pLuaState, VariableName);
   }
@@ -0,0 +1,84 @@
+#include "AgentScheduler.h"
+#include "BaseGameEntity.h"
+#include "MessageDispatcher.h"
+#include "Time/CrudeTimer.h"
+
+#include <chrono>
+#include <thread>
+
+
+//----------------------------- ctor ------------------------------------------
+//-----------------------------------------------------------------------------
+AgentScheduler::AgentScheduler(pacing_mode  mode,
+                               double       TickPeriod,
+                               unsigned int NumThreads):m_Pool(NumThreads),
+                                                        m_Mode(mode),
+                                                        m_dTickPeriod(TickPeriod),
+                                                        m_iGrainSize(256),
+                                                        m_lTicksRun(0),
+                                                        m_dTimeRunning(0)
+{}
+
+//------------------------------- Tick ----------------------------------------
+//
+//  updates every agent in parallel, then routes any messages sent during
+//  the update and any delayed messages that are now due
+//-----------------------------------------------------------------------------
+void AgentScheduler::Tick()
+{
+  //advance the time if the clock is in fixed step mode
+  Clock->Update();
+
+  Dispatch->DeferMessages(true);
+
+  m_Pool.ParallelFor(0, m_Agents.size(), m_iGrainSize, [this](int begin, int end)
+  {
+    for (int i=begin; i<end; ++i)
+    {
+      m_Agents[i]->Update();
+    }
+  });
+
+  Dispatch->DeferMessages(false);
+
+  Dispatch->DispatchDeferredMessages();
+  Dispatch->DispatchDelayedMessages();
+}
+
+//-------------------------------- Run ----------------------------------------
+//-----------------------------------------------------------------------------
+void AgentScheduler::Run(int NumTicks)
+{
+  typedef std::chrono::steady_clock clock;
+
+  const clock::duration period =
+    std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(m_dTickPeriod));
+
+  clock::time_point start    = clock::now();
+  clock::time_point NextTick = start;
+
+  for (int t=0; t<NumTicks; ++t)
+  {
+    Tick();
+
+    ++m_lTicksRun;
+
+    if (m_Mode == real_time)
+    {
+      NextTick += period;
+
+      std::this_thread::sleep_until(NextTick);
+    }
+  }
+
+  m_dTimeRunning += std::chrono::duration<double>(clock::now() - start).count();
+}
+
+//-------------------------- TicksPerSecond -----------------------------------
+//-----------------------------------------------------------------------------
+double AgentScheduler::TicksPerSecond()const
+{
+  if (m_dTimeRunning <= 0) return 0;
+
+  return m_lTicksRun / m_dTimeRunning;
+}
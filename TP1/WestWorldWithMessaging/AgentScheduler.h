@@ -0,0 +1,76 @@
+#ifndef AGENT_SCHEDULER_H
+#define AGENT_SCHEDULER_H
+//------------------------------------------------------------------------
+//
+//  Name:   AgentScheduler.h
+//
+//  Desc:   tick based scheduler for the inhabitants of West World. Each
+//          tick the Update method of every registered agent is run as a
+//          task on a work stealing thread pool. Messages sent during the
+//          parallel update are held back by the dispatcher and delivered
+//          once all the agents have been updated.
+//
+//          In real_time mode a tick lasts at least TickPeriod seconds, in
+//          as_fast_as_possible mode the next tick starts straight away.
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+#include "misc/WorkStealingPool.h"
+
+class BaseGameEntity;
+
+
+class AgentScheduler
+{
+public:
+
+  enum pacing_mode{real_time, as_fast_as_possible};
+
+private:
+
+  WorkStealingPool             m_Pool;
+
+  std::vector<BaseGameEntity*> m_Agents;
+
+  pacing_mode                  m_Mode;
+
+  //the minimum length of a tick in real_time mode (in seconds)
+  double                       m_dTickPeriod;
+
+  //the number of agents updated by a single task
+  int                          m_iGrainSize;
+
+  //book keeping used to report the tick rate of Run
+  long                         m_lTicksRun;
+  double                       m_dTimeRunning;
+
+public:
+
+  //a NumThreads of zero uses one worker per hardware thread
+  AgentScheduler(pacing_mode  mode,
+                 double       TickPeriod,
+                 unsigned int NumThreads = 0);
+
+  //the scheduler does not own the agents
+  void   AddAgent(BaseGameEntity* pAgent){m_Agents.push_back(pAgent);}
+
+  //updates every agent once, then routes the messages they sent
+  void   Tick();
+
+  //runs NumTicks ticks, paced according to the scheduler's mode
+  void   Run(int NumTicks);
+
+  void   SetGrainSize(int size){m_iGrainSize = size;}
+
+  int    NumAgents()const{return m_Agents.size();}
+  int    NumThreads()const{return m_Pool.NumThreads();}
+  long   TicksRun()const{return m_lTicksRun;}
+
+  //the average number of ticks per second over all the calls to Run
+  double TicksPerSecond()const;
+};
+
+
+
+#endif
@@ -27,7 +27,6 @@ void BarFly::Update()
 	SetTextColor(FOREGROUND_RED | FOREGROUND_GREEN);
 
 	m_pStateMachine->Update();
-	Sleep(800);
 }
 
 void BarFly::AddToCoin(int val)
@@ -8,15 +8,6 @@
 #include "Time/CrudeTimer.h"
 #include "EntityNames.h"
 
-#include <iostream>
-using std::cout;
-
-
-#ifdef TEXTOUTPUT
-#include <fstream>
-extern std::ofstream os;
-#define cout os
-#endif
 
 RestAtBarFlyHome* RestAtBarFlyHome::Instance()
 {
@@ -29,7 +20,7 @@ void RestAtBarFlyHome::Enter(BarFly* pBarFly)
 {
 	if(pBarFly->Location() != barFlyHome)
 	{
-		cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Need more alcohol !";
+		pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Need more alcohol !";
 		pBarFly->ChangeLocation(barFlyHome);
 	}
 }
@@ -38,7 +29,7 @@ void RestAtBarFlyHome::Execute(BarFly* pBarFly)
 {
 	//############ seek for money
 	pBarFly->AddToCoin(1);
-	cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Haa a coin ! gettin' close to my absinth ";
+	pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Haa a coin ! gettin' close to my absinth ";
 	if (pBarFly->HaveEnoughtMoney())
 	{
 		pBarFly->GetFSM()->ChangeState(DrinkingAtBar::Instance());
@@ -47,7 +38,7 @@ void RestAtBarFlyHome::Execute(BarFly* pBarFly)
 
 void RestAtBarFlyHome::Exit(BarFly* pBarFly)
 {
-	cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Gonna drink Them all";
+	pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Gonna drink Them all";
 }
 
 bool RestAtBarFlyHome::OnMessage(BarFly* pBarFly, const Telegram& msg)
@@ -68,7 +59,7 @@ void DrinkingAtBar::Enter(BarFly* pBarFly)
 	//he'll change his location
 	if (pBarFly->Location() != saloon)
 	{
-		cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Goin' ta drank all maah ballast";
+		pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Goin' ta drank all maah ballast";
 
 		pBarFly->ChangeLocation(saloon);
 	}
@@ -77,7 +68,7 @@ void DrinkingAtBar::Enter(BarFly* pBarFly)
 void DrinkingAtBar::Execute(BarFly* pBarFly)
 {
 	pBarFly->BuyAndDrinkAbsinth();
-	cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": One more Absinth for me !!!";
+	pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": One more Absinth for me !!!";
 	if (pBarFly->IsPoor())
 	{
 		pBarFly->GetFSM()->ChangeState(RestAtBarFlyHome::Instance());
@@ -88,7 +79,7 @@ void DrinkingAtBar::Exit(BarFly* pBarFly)
 {
 	if (pBarFly->IsPoor())
 	{
-		cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Arh !!! will cam' back";
+		pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Arh !!! will cam' back";
 	}
 }
 
@@ -98,28 +89,28 @@ bool DrinkingAtBar::OnMessage(BarFly* pBarFly, const Telegram& msg)
 	switch (msg.Msg)
 	{
 		case Msg_HiBarFly:
-			cout << "\nMessage handled by " << GetNameOfEntity(pBarFly->ID()) << " at time: "
+			pBarFly->Out() << "\nMessage handled by " << GetNameOfEntity(pBarFly->ID()) << " at time: "
 			<< Clock->GetCurrentTime();
 			SetTextColor(FOREGROUND_RED | FOREGROUND_GREEN);
-			cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Bob !!! Told ya not to cam' back !!";
-			cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Goin' ta panch ya face in da face";
+			pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Bob !!! Told ya not to cam' back !!";
+			pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Goin' ta panch ya face in da face";
 			if (RandFloat() > .5)
 			{
 				Dispatch->DispatchMessage(SEND_MSG_IMMEDIATELY, //time delay
 					pBarFly->ID(),				//ID of sender
-					ent_Miner_Bob,				//ID of recipient
+					HouseholdMember(pBarFly->ID(), ent_Miner_Bob), //ID of recipient
 					Msg_IBeatYou,				//the message
 					NO_ADDITIONAL_INFO);
 				SetTextColor(FOREGROUND_RED | FOREGROUND_GREEN);
-				cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": The absinth is my strenth !!";
+				pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": The absinth is my strenth !!";
 				pBarFly->GetFSM()->ChangeState(DrinkingAtBar::Instance());
 			}
 			else
 			{
-				cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": ARHH !!! How did ya do this not drunk !!";
+				pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": ARHH !!! How did ya do this not drunk !!";
 				Dispatch->DispatchMessage(SEND_MSG_IMMEDIATELY, //time delay
 					pBarFly->ID(),				 //ID of sender
-					ent_Miner_Bob,				 //ID of recipient
+					HouseholdMember(pBarFly->ID(), ent_Miner_Bob), //ID of recipient
 					Msg_YouBeatMe,				 //the message
 					NO_ADDITIONAL_INFO);
 				SetTextColor(FOREGROUND_RED | FOREGROUND_GREEN);
@@ -161,11 +152,11 @@ void AggressiveDrunk::Exit(BarFly* pBarFly)
 {
 	if (pBarFly->Beaten())
 	{
-		cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Arh the alcool got me, not you ...";
+		pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": Arh the alcool got me, not you ...";
 	}
 	else
 	{
-		cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": And don' cam' back !!!";
+		pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": And don' cam' back !!!";
 	}
 }
 
@@ -185,7 +176,7 @@ void Hospital::Enter(BarFly* pBarFly)
 {
 	if (pBarFly->Location() != hospital)
 	{
-		cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": I have no money for this, don't ya dare healin' me !";
+		pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": I have no money for this, don't ya dare healin' me !";
 		pBarFly->ChangeLocation(hospital);
 		pBarFly->SetCoinFound(0);
 	}
@@ -199,7 +190,7 @@ void Hospital::Execute(BarFly* pBarFly)
 
 void Hospital::Exit(BarFly* pBarFly)
 {
-	cout << "\n" << GetNameOfEntity(pBarFly->ID()) << ": I have no money for this, don't ya dare healin' me !";
+	pBarFly->Out() << "\n" << GetNameOfEntity(pBarFly->ID()) << ": I have no money for this, don't ya dare healin' me !";
 }
 
 bool Hospital::OnMessage(BarFly* pBarFly, const Telegram& msg)
@@ -1,5 +1,14 @@
 #include "BaseGameEntity.h"
+#include "Locations.h"
 #include <cassert>
+#include <iostream>
+using std::cout;
+
+
+#ifdef TEXTOUTPUT
+extern std::ofstream os;
+#define cout os
+#endif
 
 
 
@@ -23,3 +32,12 @@ void BaseGameEntity::SetID(int val)
     
   m_iNextValidID = m_ID + 1;
 }
+
+//------------------------------- Out -----------------------------------------
+//-----------------------------------------------------------------------------
+std::ostream& BaseGameEntity::Out()
+{
+  if (m_bSilent) return m_NullSink;
+
+  return cout;
+}
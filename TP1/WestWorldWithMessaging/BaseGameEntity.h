@@ -11,6 +11,7 @@
 //------------------------------------------------------------------------
 #include <string>
 #include <fstream>
+#include <ostream>
 #include "GUI.h"
 
 #include "messaging/Telegram.h"
@@ -30,6 +31,12 @@ private:
   //this value is updated
   static int  m_iNextValidID;
 
+  //a silenced entity writes its chatter here instead. Each entity has a sink
+  //of its own, so entities updated on different threads never share one
+  std::ostream m_NullSink;
+
+  bool         m_bSilent;
+
   //this must be called within the constructor to make sure the ID is set
   //correctly. It verifies that the value passed to the method is greater
   //or equal to the next valid ID, before setting the ID and incrementing
@@ -38,7 +45,7 @@ private:
 
 public:
 
-  BaseGameEntity(int id)
+  BaseGameEntity(int id):m_NullSink(NULL), m_bSilent(false)
   {
     SetID(id);
   }
@@ -53,6 +60,11 @@ public:
   virtual bool  HandleMessage(const Telegram& msg)=0;
 
   int           ID()const{return m_ID;}  
+
+  //the stream the entity reports what it is doing to
+  std::ostream& Out();
+
+  void          SetSilent(bool silent){m_bSilent = silent;}
 };
 
 
@@ -11,12 +11,23 @@ enum
 
   ent_Swain,
 
-  ent_BarFly
+  ent_BarFly,
+
+  household_size
 };
 
+//the inhabitants live in households of one of each of the above, with IDs
+//running on from the household's first, which is a multiple of
+//household_size. This returns the ID of the given member (one of the names
+//above) of the household the entity with the given ID lives in
+inline int HouseholdMember(int id, int member)
+{
+  return id - id % household_size + member;
+}
+
 inline std::string GetNameOfEntity(int n)
 {
-  switch(n)
+  switch(n % household_size)
   {
   case ent_Miner_Bob:
 
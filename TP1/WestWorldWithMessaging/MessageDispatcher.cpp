@@ -7,6 +7,7 @@
 #include "EntityNames.h"
 
 #include <iostream>
+#include <algorithm>
 using std::cout;
 
 using std::set;
@@ -39,7 +40,7 @@ void MessageDispatcher::Discharge(BaseGameEntity* pReceiver,
   if (!pReceiver->HandleMessage(telegram))
   {
     //telegram could not be handled
-    cout << "Message not handled";
+    pReceiver->Out() << "Message not handled";
   }
 }
 
@@ -55,6 +56,16 @@ void MessageDispatcher::DispatchMessage(double  delay,
                                         int    msg,
                                         void*  ExtraInfo)
 {
+  //hold the message back if the agents are being updated in parallel
+  if (m_bDeferring)
+  {
+    std::lock_guard<std::mutex> lock(m_DeferredLock);
+
+    m_Deferred.push_back(Telegram(delay, sender, receiver, msg, ExtraInfo));
+
+    return;
+  }
+
   SetTextColor(BACKGROUND_RED|FOREGROUND_RED|FOREGROUND_GREEN|FOREGROUND_BLUE);
 
   //get pointers to the sender and receiver
@@ -75,7 +86,7 @@ void MessageDispatcher::DispatchMessage(double  delay,
   //if there is no delay, route telegram immediately                       
   if (delay <= 0.0f)                                                        
   {
-    cout << "\nInstant telegram dispatched at time: " << Clock->GetCurrentTime()
+    pSender->Out() << "\nInstant telegram dispatched at time: " << Clock->GetCurrentTime()
          << " by " << GetNameOfEntity(pSender->ID()) << " for " << GetNameOfEntity(pReceiver->ID()) 
          << ". Msg is "<< MsgToStr(msg);
 
@@ -93,7 +104,7 @@ void MessageDispatcher::DispatchMessage(double  delay,
     //and put it in the queue
     PriorityQ.insert(telegram);   
 
-    cout << "\nDelayed telegram from " << GetNameOfEntity(pSender->ID()) << " recorded at time " 
+    pSender->Out() << "\nDelayed telegram from " << GetNameOfEntity(pSender->ID()) << " recorded at time " 
             << Clock->GetCurrentTime() << " for " << GetNameOfEntity(pReceiver->ID())
             << ". Msg is "<< MsgToStr(msg);
             
@@ -126,7 +137,7 @@ void MessageDispatcher::DispatchDelayedMessages()
     //find the recipient
     BaseGameEntity* pReceiver = EntityMgr->GetEntityFromID(telegram.Receiver);
 
-    cout << "\nQueued telegram ready for dispatch: Sent to " 
+    pReceiver->Out() << "\nQueued telegram ready for dispatch: Sent to " 
          << GetNameOfEntity(pReceiver->ID()) << ". Msg is " << MsgToStr(telegram.Msg);
 
     //send the telegram to the recipient
@@ -137,5 +148,32 @@ void MessageDispatcher::DispatchDelayedMessages()
   }
 }
 
+//---------------------- DispatchDeferredMessages ------------------------
+//
+//  sends any messages held back while deferring was switched on. Messages
+//  are sorted by sender so that each sender's messages keep their order
+//  and the overall order is the same whatever the number of threads
+//------------------------------------------------------------------------
+static bool SenderIsLess(const Telegram& t1, const Telegram& t2)
+{
+  return t1.Sender < t2.Sender;
+}
 
+void MessageDispatcher::DispatchDeferredMessages()
+{
+  std::vector<Telegram> deferred;
+
+  {
+    std::lock_guard<std::mutex> lock(m_DeferredLock);
+
+    deferred.swap(m_Deferred);
+  }
 
+  std::stable_sort(deferred.begin(), deferred.end(), SenderIsLess);
+
+  std::vector<Telegram>::const_iterator it = deferred.begin();
+  for (it; it != deferred.end(); ++it)
+  {
+    DispatchMessage(it->DispatchTime, it->Sender, it->Receiver, it->Msg, it->ExtraInfo);
+  }
+}
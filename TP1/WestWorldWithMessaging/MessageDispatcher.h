@@ -13,7 +13,8 @@
 #pragma warning (disable:4786)
 
 #include <set>
-
+#include <vector>
+#include <mutex>
 
 #include "misc/ConsoleUtils.h"
 #include "messaging/Telegram.h"
@@ -38,12 +39,19 @@ private:
   //of duplicates. Messages are sorted by their dispatch time.
   std::set<Telegram> PriorityQ;
 
+  //while agents are updated in parallel (see AgentScheduler) messages are
+  //not routed straight away. They are stored here, with the requested delay
+  //in the DispatchTime field, and sent once the parallel update has finished
+  std::vector<Telegram> m_Deferred;
+  bool                  m_bDeferring;
+  std::mutex            m_DeferredLock;
+
   //this method is utilized by DispatchMessage or DispatchDelayedMessages.
   //This method calls the message handling member function of the receiving
   //entity, pReceiver, with the newly created telegram
   void Discharge(BaseGameEntity* pReceiver, const Telegram& msg);
 
-  MessageDispatcher(){}
+  MessageDispatcher():m_bDeferring(false){}
 
   //copy ctor and assignment should be private
   MessageDispatcher(const MessageDispatcher&);
@@ -64,6 +72,15 @@ public:
   //send out any delayed messages. This method is called each time through   
   //the main game loop.
   void DispatchDelayedMessages();
+
+  //when switched on, any message sent is held back until
+  //DispatchDeferredMessages is called. This makes it safe for several
+  //threads to send messages at the same time
+  void DeferMessages(bool bDefer){m_bDeferring = bDefer;}
+
+  //sends the held back messages in order of sender ID so that the result
+  //does not depend on which thread sent a message first
+  void DispatchDeferredMessages();
 };
 
 
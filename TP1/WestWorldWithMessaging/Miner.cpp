@@ -27,7 +27,6 @@ void Miner::Update()
 	m_iThirst += 1;
 
 	m_pStateMachine->Update();
-	Sleep(800);
 }
 
 
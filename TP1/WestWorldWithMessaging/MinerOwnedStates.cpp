@@ -8,15 +8,6 @@
 #include "Time/CrudeTimer.h"
 #include "EntityNames.h"
 
-#include <iostream>
-using std::cout;
-
-
-#ifdef TEXTOUTPUT
-#include <fstream>
-extern std::ofstream os;
-#define cout os
-#endif
 
 
 //------------------------------------------------------------------------methods for EnterMineAndDigForNugget
@@ -34,7 +25,7 @@ void EnterMineAndDigForNugget::Enter(Miner* pMiner)
   //change location to the gold mine
   if (pMiner->Location() != goldmine)
   {
-    cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Walkin' to the goldmine";
+    pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Walkin' to the goldmine";
 
     pMiner->ChangeLocation(goldmine);
   }
@@ -51,7 +42,7 @@ void EnterMineAndDigForNugget::Execute(Miner* pMiner)
 
   pMiner->IncreaseFatigue();
 
-  cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Pickin' up a nugget";
+  pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Pickin' up a nugget";
 
   //if enough gold mined, go and put it in the bank
   if (pMiner->PocketsFull())
@@ -68,7 +59,7 @@ void EnterMineAndDigForNugget::Execute(Miner* pMiner)
 
 void EnterMineAndDigForNugget::Exit(Miner* pMiner)
 {
-  cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " 
+  pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " 
        << "Ah'm leavin' the goldmine with mah pockets full o' sweet gold";
 }
 
@@ -93,7 +84,7 @@ void VisitBankAndDepositGold::Enter(Miner* pMiner)
   //on entry the miner makes sure he is located at the bank
   if (pMiner->Location() != bank)
   {
-    cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Goin' to the bank. Yes siree";
+    pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Goin' to the bank. Yes siree";
 
     pMiner->ChangeLocation(bank);
   }
@@ -107,13 +98,13 @@ void VisitBankAndDepositGold::Execute(Miner* pMiner)
     
   pMiner->SetGoldCarried(0);
 
-  cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " 
+  pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " 
        << "Depositing gold. Total savings now: "<< pMiner->Wealth();
 
   //wealthy enough to have a well earned rest?
   if (pMiner->Wealth() >= ComfortLevel)
   {
-    cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " 
+    pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " 
          << "WooHoo! Rich enough for now. Back home to mah li'lle lady";
       
     pMiner->GetFSM()->ChangeState(GoHomeAndSleepTilRested::Instance());      
@@ -129,7 +120,7 @@ void VisitBankAndDepositGold::Execute(Miner* pMiner)
 
 void VisitBankAndDepositGold::Exit(Miner* pMiner)
 {
-  cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Leavin' the bank";
+  pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Leavin' the bank";
 }
 
 
@@ -151,7 +142,7 @@ void GoHomeAndSleepTilRested::Enter(Miner* pMiner)
 {
   if (pMiner->Location() != shack)
   {
-    cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Walkin' home";
+    pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Walkin' home";
 
     pMiner->ChangeLocation(shack); 
 
@@ -160,14 +151,14 @@ void GoHomeAndSleepTilRested::Enter(Miner* pMiner)
 	{
 		Dispatch->DispatchMessage(SEND_MSG_IMMEDIATELY, //time delay
 			pMiner->ID(),        //ID of sender
-			ent_Elsa,            //ID of recipient
+			HouseholdMember(pMiner->ID(), ent_Elsa), //ID of recipient
 			Msg_HiHoneyImHome,   //the message
 			NO_ADDITIONAL_INFO);
 	}
 	else
 	{
 		pMiner->SetBeaten(false);
-		cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Healin' myself ...";
+		pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Healin' myself ...";
 	}
   }
 }
@@ -177,7 +168,7 @@ void GoHomeAndSleepTilRested::Execute(Miner* pMiner)
 	//looks for the swain
 	Dispatch->DispatchMessage(SEND_MSG_IMMEDIATELY, //time delay
 		pMiner->ID(),				//ID of sender
-		ent_Swain,				//ID of recipient
+		HouseholdMember(pMiner->ID(), ent_Swain), //ID of recipient
 		Msg_IsThereSomeoneInTheCloset,				//the message
 		NO_ADDITIONAL_INFO);
 	SetTextColor(FOREGROUND_RED | FOREGROUND_INTENSITY);
@@ -185,7 +176,7 @@ void GoHomeAndSleepTilRested::Execute(Miner* pMiner)
   //if miner is not fatigued start to dig for nuggets again.
   if (!pMiner->Fatigued())
   {
-     cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " 
+     pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " 
           << "All mah fatigue has drained away. Time to find more gold!";
 
      pMiner->GetFSM()->ChangeState(EnterMineAndDigForNugget::Instance());
@@ -196,7 +187,7 @@ void GoHomeAndSleepTilRested::Execute(Miner* pMiner)
     //sleep
     pMiner->DecreaseFatigue();
 
-    cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "ZZZZ... ";
+    pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "ZZZZ... ";
   } 
 }
 
@@ -213,12 +204,12 @@ bool GoHomeAndSleepTilRested::OnMessage(Miner* pMiner, const Telegram& msg)
    {
    case Msg_StewReady:
 
-     cout << "\nMessage handled by " << GetNameOfEntity(pMiner->ID()) 
+     pMiner->Out() << "\nMessage handled by " << GetNameOfEntity(pMiner->ID()) 
      << " at time: " << Clock->GetCurrentTime();
 
      SetTextColor(FOREGROUND_RED|FOREGROUND_INTENSITY);
 
-     cout << "\n" << GetNameOfEntity(pMiner->ID()) 
+     pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) 
           << ": Okay Hun, ahm a comin'!";
 
      pMiner->GetFSM()->ChangeState(EatStew::Instance());
@@ -227,12 +218,12 @@ bool GoHomeAndSleepTilRested::OnMessage(Miner* pMiner, const Telegram& msg)
 
    case Msg_YesThereIsSwain:
 
-	   cout << "\nMessage handled by " << GetNameOfEntity(pMiner->ID())
+	   pMiner->Out() << "\nMessage handled by " << GetNameOfEntity(pMiner->ID())
 		   << " at time: " << Clock->GetCurrentTime();
 
 	   SetTextColor(FOREGROUND_RED | FOREGROUND_INTENSITY);
 
-	   cout << "\n" << GetNameOfEntity(pMiner->ID())
+	   pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID())
 		   << ": I'll kill you swain !";
 
 	   return true;
@@ -257,7 +248,7 @@ void QuenchThirst::Enter(Miner* pMiner)
   {    
     pMiner->ChangeLocation(saloon);
 
-    cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Boy, ah sure is thusty! Walking to the saloon";
+    pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Boy, ah sure is thusty! Walking to the saloon";
   }
 }
 
@@ -265,11 +256,11 @@ void QuenchThirst::Execute(Miner* pMiner)
 {
   pMiner->BuyAndDrinkAWhiskey();
 
-  cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "That's mighty fine sippin' liquer";
+  pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "That's mighty fine sippin' liquer";
 
   Dispatch->DispatchMessage(SEND_MSG_IMMEDIATELY, //time delay
 	  pMiner->ID(),				//ID of sender
-	  ent_BarFly,				//ID of recipient
+	  HouseholdMember(pMiner->ID(), ent_BarFly), //ID of recipient
 	  Msg_HiBarFly,				//the message
 	  NO_ADDITIONAL_INFO);
   SetTextColor(FOREGROUND_RED | FOREGROUND_INTENSITY);
@@ -281,11 +272,11 @@ void QuenchThirst::Exit(Miner* pMiner)
 { 
 	if (!pMiner->Beaten())
 	{
-		cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Leaving the saloon, feelin' good";
+		pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Leaving the saloon, feelin' good";
 	}
 	else
 	{
-		cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "needin' some rest now";
+		pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "needin' some rest now";
 	}
 }
 
@@ -296,18 +287,18 @@ bool QuenchThirst::OnMessage(Miner* pMiner, const Telegram& msg)
 	switch (msg.Msg)
 	{
 		case Msg_IBeatYou:
-			cout << "\nMessage handled by " << GetNameOfEntity(pMiner->ID()) << " at time: "
+			pMiner->Out() << "\nMessage handled by " << GetNameOfEntity(pMiner->ID()) << " at time: "
 			<< Clock->GetCurrentTime();
 			SetTextColor(FOREGROUND_RED | FOREGROUND_INTENSITY);
 			pMiner->SetBeaten(true);
-			cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": Arh di'nt see ya !!! Why are yout this strong ?!!";
+			pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": Arh di'nt see ya !!! Why are yout this strong ?!!";
 			pMiner->GetFSM()->ChangeState(GoHomeAndSleepTilRested::Instance());
 
 		case Msg_YouBeatMe:
-			cout << "\nMessage handled by " << GetNameOfEntity(pMiner->ID()) << " at time: "
+			pMiner->Out() << "\nMessage handled by " << GetNameOfEntity(pMiner->ID()) << " at time: "
 			<< Clock->GetCurrentTime();
 			SetTextColor(FOREGROUND_RED | FOREGROUND_INTENSITY);
-			cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": Take This!!! And never came back !!";
+			pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": Take This!!! And never came back !!";
 			pMiner->GetFSM()->ChangeState(EnterMineAndDigForNugget::Instance());
 	}
   return false;
@@ -325,19 +316,19 @@ EatStew* EatStew::Instance()
 
 void EatStew::Enter(Miner* pMiner)
 {
-  cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Smells Reaaal goood Elsa!";
+  pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Smells Reaaal goood Elsa!";
 }
 
 void EatStew::Execute(Miner* pMiner)
 {
-  cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Tastes real good too!";
+  pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Tastes real good too!";
 
   pMiner->GetFSM()->RevertToPreviousState();
 }
 
 void EatStew::Exit(Miner* pMiner)
 { 
-  cout << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Thankya li'lle lady. Ah better get back to whatever ah wuz doin'";
+  pMiner->Out() << "\n" << GetNameOfEntity(pMiner->ID()) << ": " << "Thankya li'lle lady. Ah better get back to whatever ah wuz doin'";
 }
 
 
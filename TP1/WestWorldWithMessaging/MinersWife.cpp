@@ -27,5 +27,4 @@ void MinersWife::Update()
 	SetTextColor(FOREGROUND_GREEN | FOREGROUND_INTENSITY);
 
 	m_pStateMachine->Update();
-	Sleep(800);
 }
\ No newline at end of file
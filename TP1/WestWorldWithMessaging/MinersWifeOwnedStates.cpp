@@ -7,14 +7,6 @@
 #include "MessageTypes.h"
 #include "EntityNames.h"
 
-#include <iostream>
-using std::cout;
-
-#ifdef TEXTOUTPUT
-#include <fstream>
-extern std::ofstream os;
-#define cout os
-#endif
 
 //-----------------------------------------------------------------------Global state
 
@@ -45,12 +37,12 @@ bool WifesGlobalState::OnMessage(MinersWife* wife, const Telegram& msg)
   {
   case Msg_HiHoneyImHome:
    {
-       cout << "\nMessage handled by " << GetNameOfEntity(wife->ID()) << " at time: " 
+       wife->Out() << "\nMessage handled by " << GetNameOfEntity(wife->ID()) << " at time: " 
        << Clock->GetCurrentTime();
 
      SetTextColor(FOREGROUND_GREEN|FOREGROUND_INTENSITY);
 
-     cout << "\n" << GetNameOfEntity(wife->ID()) << 
+     wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << 
           ": Hi honey. Let me make you some of mah fine country stew";
 
      wife->GetFSM()->ChangeState(CookStew::Instance());
@@ -75,7 +67,7 @@ DoHouseWork* DoHouseWork::Instance()
 
 void DoHouseWork::Enter(MinersWife* wife)
 {
-  cout << "\n" << GetNameOfEntity(wife->ID()) << ": Time to do some more housework!";
+  wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": Time to do some more housework!";
 }
 
 
@@ -85,19 +77,19 @@ void DoHouseWork::Execute(MinersWife* wife)
   {
   case 0:
 
-    cout << "\n" << GetNameOfEntity(wife->ID()) << ": Moppin' the floor";
+    wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": Moppin' the floor";
 
     break;
 
   case 1:
 
-    cout << "\n" << GetNameOfEntity(wife->ID()) << ": Washin' the dishes";
+    wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": Washin' the dishes";
 
     break;
 
   case 2:
 
-    cout << "\n" << GetNameOfEntity(wife->ID()) << ": Makin' the bed";
+    wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": Makin' the bed";
 
     break;
   }
@@ -124,20 +116,20 @@ VisitBathroom* VisitBathroom::Instance()
 
 void VisitBathroom::Enter(MinersWife* wife)
 {  
-  cout << "\n" << GetNameOfEntity(wife->ID()) << ": Walkin' to the can. Need to powda mah pretty li'lle nose"; 
+  wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": Walkin' to the can. Need to powda mah pretty li'lle nose"; 
 }
 
 
 void VisitBathroom::Execute(MinersWife* wife)
 {
-  cout << "\n" << GetNameOfEntity(wife->ID()) << ": Ahhhhhh! Sweet relief!";
+  wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": Ahhhhhh! Sweet relief!";
 
   wife->GetFSM()->RevertToPreviousState();
 }
 
 void VisitBathroom::Exit(MinersWife* wife)
 {
-  cout << "\n" << GetNameOfEntity(wife->ID()) << ": Leavin' the Jon";
+  wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": Leavin' the Jon";
 }
 
 
@@ -162,7 +154,7 @@ void CookStew::Enter(MinersWife* wife)
   //if not already cooking put the stew in the oven
   if (!wife->Cooking())
   {
-    cout << "\n" << GetNameOfEntity(wife->ID()) << ": Putting the stew in the oven";
+    wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": Putting the stew in the oven";
   
     //send a delayed message myself so that I know when to take the stew
     //out of the oven
@@ -179,14 +171,14 @@ void CookStew::Enter(MinersWife* wife)
 
 void CookStew::Execute(MinersWife* wife)
 {
-  cout << "\n" << GetNameOfEntity(wife->ID()) << ": Fussin' over food";
+  wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": Fussin' over food";
 }
 
 void CookStew::Exit(MinersWife* wife)
 {
   SetTextColor(FOREGROUND_GREEN|FOREGROUND_INTENSITY);
   
-  cout << "\n" << GetNameOfEntity(wife->ID()) << ": Puttin' the stew on the table";
+  wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": Puttin' the stew on the table";
 }
 
 
@@ -198,16 +190,16 @@ bool CookStew::OnMessage(MinersWife* wife, const Telegram& msg)
   {
     case Msg_StewReady:
     {
-      cout << "\nMessage received by " << GetNameOfEntity(wife->ID()) <<
+      wife->Out() << "\nMessage received by " << GetNameOfEntity(wife->ID()) <<
            " at time: " << Clock->GetCurrentTime();
 
       SetTextColor(FOREGROUND_GREEN|FOREGROUND_INTENSITY);
-      cout << "\n" << GetNameOfEntity(wife->ID()) << ": StewReady! Lets eat";
+      wife->Out() << "\n" << GetNameOfEntity(wife->ID()) << ": StewReady! Lets eat";
 
       //let hubby know the stew is ready
       Dispatch->DispatchMessage(SEND_MSG_IMMEDIATELY,
                                 wife->ID(),
-                                ent_Miner_Bob,
+                                HouseholdMember(wife->ID(), ent_Miner_Bob),
                                 Msg_StewReady,
                                 NO_ADDITIONAL_INFO);
 
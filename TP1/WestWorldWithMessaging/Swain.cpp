@@ -26,7 +26,6 @@ void Swain::Update()
 	m_Horny += 1;
 
 	m_pStateMachine->Update();
-	Sleep(800);
 }
 
 void Swain::HornyUp(const int val)
@@ -8,15 +8,6 @@
 #include "Time/CrudeTimer.h"
 #include "EntityNames.h"
 
-#include <iostream>
-using std::cout;
-
-
-#ifdef TEXTOUTPUT
-#include <fstream>
-extern std::ofstream os;
-#define cout os
-#endif
 
 //---------------------------------------- methods for AtSwainHome
 AtSwainHome* AtSwainHome::Instance()
@@ -42,7 +33,7 @@ void AtSwainHome::Execute(Swain* pSwain)
 
 	pSwain->IncreaseFatigue();
 
-	cout << "\n" << GetNameOfEntity(pSwain->ID()) << ": " << "Gettin' some rest";
+	pSwain->Out() << "\n" << GetNameOfEntity(pSwain->ID()) << ": " << "Gettin' some rest";
 
 	if (pSwain->HornyFull())
 	{
@@ -58,7 +49,7 @@ void AtSwainHome::Execute(Swain* pSwain)
 
 void AtSwainHome::Exit(Swain* pSwain)
 {
-	cout << "\n" << GetNameOfEntity(pSwain->ID()) << ": "
+	pSwain->Out() << "\n" << GetNameOfEntity(pSwain->ID()) << ": "
 		<< "Taahm t' rin' a bell";
 }
 
@@ -81,7 +72,7 @@ void CheatingAtMinerHome::Enter(Swain* pSwain)
 {
 	if (pSwain->Location() != shack)
 	{
-		cout << "\n" << GetNameOfEntity(pSwain->ID()) << ": " << "Ya welcome me an ah will be welcomin' t' yae";
+		pSwain->Out() << "\n" << GetNameOfEntity(pSwain->ID()) << ": " << "Ya welcome me an ah will be welcomin' t' yae";
 
 		pSwain->ChangeLocation(shack);
 	}
@@ -95,7 +86,7 @@ void CheatingAtMinerHome::Execute(Swain* pSwain)
 	pSwain->SetHorny(0);
 
 	pSwain->GetFSM()->ChangeState(AtSwainHome::Instance());
-	cout << "\n" << GetNameOfEntity(pSwain->ID()) << ": " << "Ah need t' flee, so her button won't sees me";
+	pSwain->Out() << "\n" << GetNameOfEntity(pSwain->ID()) << ": " << "Ah need t' flee, so her button won't sees me";
 }
 
 
@@ -113,16 +104,16 @@ bool CheatingAtMinerHome::OnMessage(Swain* pSwain, const Telegram& msg)
 	{
 	case Msg_IsThereSomeoneInTheCloset:
 
-		cout << "\nMessage handled by " << GetNameOfEntity(pSwain->ID())
+		pSwain->Out() << "\nMessage handled by " << GetNameOfEntity(pSwain->ID())
 			<< " at time: " << Clock->GetCurrentTime();
 
 	SetTextColor(FOREGROUND_BLUE | FOREGROUND_INTENSITY);
-		cout << "\n" << GetNameOfEntity(pSwain->ID())
+		pSwain->Out() << "\n" << GetNameOfEntity(pSwain->ID())
 			<< ": They said to make love not war !";
 
 		Dispatch->DispatchMessage(SEND_MSG_IMMEDIATELY, //time delay
 			pSwain->ID(),				//ID of sender
-			ent_Miner_Bob,				//ID of recipient
+			HouseholdMember(pSwain->ID(), ent_Miner_Bob), //ID of recipient
 			Msg_YesThereIsSwain,				//the message
 			NO_ADDITIONAL_INFO);
 		SetTextColor(FOREGROUND_RED | FOREGROUND_INTENSITY);
@@ -152,7 +143,7 @@ void Dead::Enter(Swain* pSwain)
 		pSwain->ChangeLocation(shack);
 	}
 	SetTextColor(FOREGROUND_BLUE | FOREGROUND_INTENSITY);
-	cout << "\n" << GetNameOfEntity(pSwain->ID())
+	pSwain->Out() << "\n" << GetNameOfEntity(pSwain->ID())
 		<< ": Look like am alive no-mwr";
 }
 
@@ -184,7 +175,7 @@ void AtSwainHomeSleeping::Enter(Swain* pSwain)
 {
 	if (pSwain->Location() != swainHome)
 	{
-		cout << "\n" << GetNameOfEntity(pSwain->ID()) << ": " << "Gettin' balmy";
+		pSwain->Out() << "\n" << GetNameOfEntity(pSwain->ID()) << ": " << "Gettin' balmy";
 
 		pSwain->ChangeLocation(swainHome);
 	}
@@ -1,4 +1,6 @@
 #include <fstream>
+#include <string>
+#include <vector>
 #include <time.h>
 
 #include "Locations.h"
@@ -11,10 +13,77 @@
 #include "misc/ConsoleUtils.h"
 #include "EntityNames.h"
 #include "GUI.h"
+#include "AgentScheduler.h"
+#include "Time/CrudeTimer.h"
 
 std::ofstream os;
 
-int main()
+
+//------------------------------ RunHeadless ----------------------------------
+//
+//  creates NumAgents agents, rounded up to whole households of one of each
+//  kind of inhabitant (see EntityNames.h), runs NumTicks ticks as fast as possible with the agents silenced and
+//  reports the number of ticks per second
+//-----------------------------------------------------------------------------
+int RunHeadless(int NumAgents, int NumTicks, int NumThreads)
+{
+  std::vector<BaseGameEntity*> agents;
+
+  //the agents only send messages within their household, so every member
+  //of one must be there
+  NumAgents += (household_size - NumAgents % household_size) % household_size;
+
+  for (int id=0; id<NumAgents; ++id)
+  {
+    BaseGameEntity* pAgent = NULL;
+
+    switch(id % household_size)
+    {
+    case ent_Miner_Bob: pAgent = new Miner(id); break;
+    case ent_Elsa:      pAgent = new MinersWife(id); break;
+    case ent_Swain:     pAgent = new Swain(id); break;
+    case ent_BarFly:    pAgent = new BarFly(id); break;
+    }
+
+    //the agents keep their chatter to themselves while the simulation runs
+    pAgent->SetSilent(true);
+
+    agents.push_back(pAgent);
+
+    EntityMgr->RegisterEntity(pAgent);
+  }
+
+  AgentScheduler scheduler(AgentScheduler::as_fast_as_possible, 0, NumThreads);
+
+  //each tick stands for the same 800ms it lasts in real time mode, however
+  //fast the ticks are actually run
+  Clock->UseFixedStep(0.8);
+
+  for (unsigned int a=0; a<agents.size(); ++a)
+  {
+    scheduler.AddAgent(agents[a]);
+  }
+
+  scheduler.Run(NumTicks);
+
+  std::cout << "\n" << scheduler.NumAgents() << " agents, "
+            << scheduler.NumThreads() << " threads, "
+            << scheduler.TicksRun() << " ticks: "
+            << scheduler.TicksPerSecond() << " ticks per second" << std::endl;
+
+  for (unsigned int a=0; a<agents.size(); ++a)
+  {
+    EntityMgr->RemoveEntity(agents[a]);
+
+    delete agents[a];
+  }
+
+  return 0;
+}
+
+
+//usage: WestWorldWithMessaging [headless NumAgents NumTicks [NumThreads]]
+int main(int argc, char* argv[])
 {
 
 //define this to send output to a text file (see locations.h)
@@ -25,6 +94,11 @@ int main()
   //seed random number generator
   srand((unsigned) time(NULL));
 
+  if (argc >= 4 && std::string(argv[1]) == "headless")
+  {
+    return RunHeadless(atoi(argv[2]), atoi(argv[3]), argc >= 5 ? atoi(argv[4]) : 0);
+  }
+
   //create a miner
   Miner* Bob = new Miner(ent_Miner_Bob);
 
@@ -43,60 +117,15 @@ int main()
   EntityMgr->RegisterEntity(JeanErnestain);
   EntityMgr->RegisterEntity(Bernard);
 
-  //Create a mutex shared between the threads
-  sf::Mutex protector;
-  
-  //Create one thread for each entity
-  sf::Thread BobThread([&] {
-	  for (int i = 0; i < 30; ++i)
-	  {
-			protector.lock();
-			Bob->Update();
-			Dispatch->DispatchDelayedMessages();
-			protector.unlock();
-			Sleep(800);
-	  }
-  });
-  sf::Thread ElsaThread([&] {
-	  for (int i = 0; i < 30; ++i)
-	  {
-		  protector.lock();
-		  Elsa->Update();
-		  protector.unlock();
-		  Sleep(800);
-	  }
-  });
-  sf::Thread JeanThread([&] {
-	  for (int i = 0; i < 30; ++i)
-	  {
-		  protector.lock();
-		  JeanErnestain->Update();
-		  protector.unlock();
-		  Sleep(800);
-	  }
-  });
-  sf::Thread BernardThread([&]{ 
-	  for (int i = 0; i < 30; ++i)
-	  {
-		  protector.lock();
-		  Bernard->Update();
-		  protector.unlock();
-		  Sleep(800);
-	  }
-  });
-  
-
-  //Launch the threads
-  BobThread.launch();
-  ElsaThread.launch();
-  JeanThread.launch();
-  BernardThread.launch();
-
-  //Wait for all of the threads to finish
-  BobThread.wait();
-  ElsaThread.wait();
-  JeanThread.wait();
-  BernardThread.wait();
+  //update the agents once every 800ms on a pool of worker threads
+  AgentScheduler scheduler(AgentScheduler::real_time, 0.8);
+
+  scheduler.AddAgent(Bob);
+  scheduler.AddAgent(Elsa);
+  scheduler.AddAgent(JeanErnestain);
+  scheduler.AddAgent(Bernard);
+
+  scheduler.Run(30);
 
   //tidy up
   delete Bob;
@@ -20,6 +20,10 @@ NumCellsY = 10
 --how long the graves remain on screen
 GraveLifetime = 5
 
+--while a door is shut the costs of the navgraph edges through it are
+--multiplied by this, so paths go round shut doors when there is a way round
+Door_ClosedEdgeCostFactor = 4
+
 
 -------------------------[[ bot parameters ]]----------------------------------
 -------------------------------------------------------------------------------
@@ -53,6 +57,15 @@ Bot_VisionUpdateFreq = 4
 --note that a frequency of -1 will disable the feature and a frequency of zero
 --will ensure the feature is updated every bot update
 
+--when true the thinking above (except the triggers) is handed out by a single
+--scheduler which spreads the work of all the bots evenly over the updates,
+--rather than by randomly seeded regulators which may line up
+AI_UseScheduler = true
+
+--the microseconds of thinking the scheduler allows per update. Thinking which
+--does not fit is put off to the next update. 0 for no limit
+AI_FrameBudget = 0
+
 
 --the bot's field of view (in degrees)
 Bot_FOV = 180
@@ -74,6 +87,15 @@ HitFlashTime = 0.2
 --how long (in seconds) a bot's sensory memory persists
 Bot_MemorySpan = 5
 
+--an exploring bot gives up on a destination if the way there is more than
+--this many times the straight-line distance
+Bot_ExploreMaxDetour = 4
+
+--precise path smoothing pulls the path tight through the room the walls
+--leave around each edge, found when the map is loaded, instead of tracing
+--against the walls between every pair of edges
+Bot_SmoothPathsWithFunnel = true
+
 --goal tweakers
 Bot_HealthGoalTweaker     = 1.0
 Bot_ShotgunGoalTweaker    = 1.0
@@ -119,6 +141,20 @@ Weapon_RespawnDelay  = 15
 -------------------------[[ weapon parameters ]]-------------------------------
 -------------------------------------------------------------------------------
 
+--when true the fuzzy rules giving the desirability of each weapon are sampled
+--into a lookup table when the first weapon of a type is made, and the
+--desirability is interpolated from it. Faster but approximate
+Weapon_UseFuzzySurfaces = false
+
+--the number of samples along each input the tables start with, and the
+--largest deviation from the rules allowed. The number of samples is nearly
+--doubled until the deviation is within the tolerance, stops going down (the
+--rules of some weapons give steps) or the number reaches 257. A weapon whose
+--table is still further from its rules than the tolerance goes on using the
+--rules. Run raven_fuzzysurfaces to see the deviation of each weapon
+Weapon_FuzzySurfaceResolution = 33
+Weapon_FuzzySurfaceTolerance  = 1.0
+
 Blaster_FiringFreq       = 3
 Blaster_MaxSpeed		 = 5
 Blaster_DefaultRounds    = 0 --not used, a blaster always has ammo
@@ -1,14 +1,17 @@
 #include "Raven_Bot.h"
+
+#include <chrono>
+
 #include "misc/Cgdi.h"
 #include "misc/utils.h"
 #include "2D/Transformations.h"
-#include "2D/Geometry.h"
+#include "2D/geometry.h"
 #include "lua/Raven_Scriptor.h"
 #include "Raven_Game.h"
 #include "navigation/Raven_PathPlanner.h"
 #include "Raven_SteeringBehaviors.h"
 #include "Raven_UserOptions.h"
-#include "time/Regulator.h"
+#include "Time/Regulator.h"
 #include "Raven_WeaponSystem.h"
 #include "Raven_SensoryMemory.h"
 
@@ -18,6 +21,7 @@
 
 #include "goals/Raven_Goal_Types.h"
 #include "goals/Goal_Think.h"
+#include "goals/Raven_FeatureCache.h"
 
 
 #include "Debug/DebugConsole.h"
@@ -26,31 +30,41 @@
 Raven_Bot::Raven_Bot(Raven_Game* world,Vector2D pos, int entityType):
 
   MovingEntity(pos,
-               script->GetDouble("Bot_Scale"),
+               script->Params().Bot_Scale,
                Vector2D(0,0),
-               script->GetDouble("Bot_MaxSpeed"),
+               script->Params().Bot_MaxSpeed,
                Vector2D(1,0),
-               script->GetDouble("Bot_Mass"),
-               Vector2D(script->GetDouble("Bot_Scale"),script->GetDouble("Bot_Scale")),
-               script->GetDouble("Bot_MaxHeadTurnRate"),
-               script->GetDouble("Bot_MaxForce")),
+               script->Params().Bot_Mass,
+               Vector2D(script->Params().Bot_Scale,script->Params().Bot_Scale),
+               script->Params().Bot_MaxHeadTurnRate,
+               script->Params().Bot_MaxForce),
                  
-                 m_iMaxHealth(script->GetInt("Bot_MaxHealth")),
-                 m_iHealth(script->GetInt("Bot_MaxHealth")),
+                 m_iMaxHealth(script->Params().Bot_MaxHealth),
+                 m_iHealth(script->Params().Bot_MaxHealth),
                  m_pPathPlanner(NULL),
                  m_pSteering(NULL),
                  m_pWorld(world),
                  m_pBrain(NULL),
-                 m_iNumUpdatesHitPersistant((int)(FrameRate * script->GetDouble("HitFlashTime"))),
+                 m_pGoalArena(NULL),
+                 m_pFeatures(NULL),
+                 m_iNumUpdatesHitPersistant((int)(FrameRate * script->Params().HitFlashTime)),
                  m_bHit(false),
                  m_iScore(0),
+                 m_iNumShotsFired(0),
+                 m_iNumHits(0),
+                 m_iNumItemsPickedUp(0),
+                 m_iSlot(-1),
                  m_Status(spawning),
                  m_bPossessed(false),
-                 m_dFieldOfView(DegsToRads(script->GetDouble("Bot_FOV"))),
+                 m_dFieldOfView(DegsToRads(script->Params().Bot_FOV)),
 				 m_bLeader(false),
-				 m_pTeamTarget(nullptr)
+				 m_pTeamTarget(nullptr),
+                 m_iThinkTasks(0),
+                 m_iThinkTasksRun(0)
            
 {
+  for (int t=0; t<NumThinkTasks; ++t) m_dThinkTaskTime[t] = 0;
+
   SetEntityType(entityType);
 
   SetUpVertexBuffer();
@@ -65,24 +79,26 @@ Raven_Bot::Raven_Bot(Raven_Game* world,Vector2D pos, int entityType):
   m_pSteering = new Raven_Steering(world, this);
 
   //create the regulators
-  m_pWeaponSelectionRegulator = new Regulator(script->GetDouble("Bot_WeaponSelectionFrequency"));
-  m_pGoalArbitrationRegulator =  new Regulator(script->GetDouble("Bot_GoalAppraisalUpdateFreq"));
-  m_pTargetSelectionRegulator = new Regulator(script->GetDouble("Bot_TargetingUpdateFreq"));
-  m_pTriggerTestRegulator = new Regulator(script->GetDouble("Bot_TriggerUpdateFreq"));
-  m_pVisionUpdateRegulator = new Regulator(script->GetDouble("Bot_VisionUpdateFreq"));
+  m_pWeaponSelectionRegulator = new Regulator(script->Params().Bot_WeaponSelectionFrequency);
+  m_pGoalArbitrationRegulator =  new Regulator(script->Params().Bot_GoalAppraisalUpdateFreq);
+  m_pTargetSelectionRegulator = new Regulator(script->Params().Bot_TargetingUpdateFreq);
+  m_pTriggerTestRegulator = new Regulator(script->Params().Bot_TriggerUpdateFreq);
+  m_pVisionUpdateRegulator = new Regulator(script->Params().Bot_VisionUpdateFreq);
 
   //create the goal queue
-  m_pBrain = new Goal_Think(this);
+  m_pFeatures = new Raven_FeatureCache(this);
+  m_pGoalArena = new GoalArena();
+  m_pBrain = new (*m_pGoalArena) Goal_Think(this);
 
   //create the targeting system
   m_pTargSys = new Raven_TargetingSystem(this);
 
   m_pWeaponSys = new Raven_WeaponSystem(this,
-                                        script->GetDouble("Bot_ReactionTime"),
-                                        script->GetDouble("Bot_AimAccuracy"),
-                                        script->GetDouble("Bot_AimPersistance"));
+                                        script->Params().Bot_ReactionTime,
+                                        script->Params().Bot_AimAccuracy,
+                                        script->Params().Bot_AimPersistance);
 
-  m_pSensoryMem = new Raven_SensoryMemory(this, script->GetDouble("Bot_MemorySpan"));
+  m_pSensoryMem = new Raven_SensoryMemory(this, script->Params().Bot_MemorySpan);
 }
 
 //-------------------------------- dtor ---------------------------------------
@@ -92,6 +108,8 @@ Raven_Bot::~Raven_Bot()
   debug_con << "deleting raven bot (id = " << ID() << ")" << "";
   
   delete m_pBrain;
+  delete m_pGoalArena;
+  delete m_pFeatures;
   delete m_pPathPlanner;
   delete m_pSteering;
   delete m_pWeaponSelectionRegulator;
@@ -122,6 +140,104 @@ void Raven_Bot::Spawn(Vector2D pos)
 //
 void Raven_Bot::Update()
 {
+  PollRegulators();
+  Think();
+  Act();
+}
+
+//---------------------------- PollRegulators ---------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Bot::PollRegulators()
+{
+  m_iThinkTasks = 0;
+
+  //if the bot is under user control it does not think for itself
+  if (isPossessed()) return;
+
+  if (m_pTargetSelectionRegulator->isReady()) m_iThinkTasks |= think_target_selection;
+  if (m_pGoalArbitrationRegulator->isReady()) m_iThinkTasks |= think_goal_arbitration;
+  if (m_pVisionUpdateRegulator->isReady())    m_iThinkTasks |= think_vision_update;
+  if (m_pWeaponSelectionRegulator->isReady()) m_iThinkTasks |= think_weapon_selection;
+}
+
+//---------------------------- SetThinkTasks ----------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Bot::SetThinkTasks(int tasks)
+{
+  //if the bot is under user control it does not think for itself
+  m_iThinkTasks = isPossessed() ? 0 : tasks;
+}
+
+//the microseconds elapsed since start
+static double MicrosecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+//--------------------------------- Think -------------------------------------
+//
+//  runs the decision making tasks selected by PollRegulators or
+//  SetThinkTasks and records the time each one took
+//-----------------------------------------------------------------------------
+void Raven_Bot::Think()
+{
+  typedef std::chrono::steady_clock clock;
+
+  for (int t=0; t<NumThinkTasks; ++t) m_dThinkTaskTime[t] = 0;
+
+  //examine all the opponents in the bots sensory memory and select one
+  //to be the current target
+  if (m_iThinkTasks & think_target_selection)
+  {      
+    clock::time_point start = clock::now();
+
+    m_pTargSys->Update();
+
+    m_dThinkTaskTime[ThinkTaskIndex(think_target_selection)] = MicrosecondsSince(start);
+  }
+
+  //appraise and arbitrate between all possible high level goals
+  if (m_iThinkTasks & think_goal_arbitration)
+  {
+    clock::time_point start = clock::now();
+
+    m_pBrain->Arbitrate(); 
+
+    m_dThinkTaskTime[ThinkTaskIndex(think_goal_arbitration)] = MicrosecondsSince(start);
+  }
+
+  //update the sensory memory with any visual stimulus
+  if (m_iThinkTasks & think_vision_update)
+  {
+    clock::time_point start = clock::now();
+
+    m_pSensoryMem->UpdateVision();
+
+    m_dThinkTaskTime[ThinkTaskIndex(think_vision_update)] = MicrosecondsSince(start);
+  }
+
+  //select the appropriate weapon to use from the weapons currently in
+  //the inventory
+  if (m_iThinkTasks & think_weapon_selection)
+  {       
+    clock::time_point start = clock::now();
+
+    m_pWeaponSys->SelectWeapon();       
+
+    m_dThinkTaskTime[ThinkTaskIndex(think_weapon_selection)] = MicrosecondsSince(start);
+  }
+
+  m_iThinkTasksRun = m_iThinkTasks;
+  m_iThinkTasks    = 0;
+}
+
+//---------------------------------- Act --------------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Bot::Act()
+{
+  //a team leader tells its team about the target it has just selected
+  m_pTargSys->NotifyTeamOfTarget();
+
   //process the currently active goal. Note this is required even if the bot
   //is under user control. This is because a goal is created whenever a user 
   //clicks on an area of the map that necessitates a path planning request.
@@ -133,32 +249,6 @@ void Raven_Bot::Update()
   //if the bot is under AI control but not scripted
   if (!isPossessed())
   {           
-    //examine all the opponents in the bots sensory memory and select one
-    //to be the current target
-    if (m_pTargetSelectionRegulator->isReady())
-    {      
-      m_pTargSys->Update();
-    }
-
-    //appraise and arbitrate between all possible high level goals
-    if (m_pGoalArbitrationRegulator->isReady())
-    {
-       m_pBrain->Arbitrate(); 
-    }
-
-    //update the sensory memory with any visual stimulus
-    if (m_pVisionUpdateRegulator->isReady())
-    {
-      m_pSensoryMem->UpdateVision();
-    }
-  
-    //select the appropriate weapon to use from the weapons currently in
-    //the inventory
-    if (m_pWeaponSelectionRegulator->isReady())
-    {       
-      m_pWeaponSys->SelectWeapon();       
-    }
-
     //this method aims the bot's current weapon at the current target
     //and takes a shot if a shot is possible
     m_pWeaponSys->TakeAimAndShoot();
@@ -369,7 +459,7 @@ void Raven_Bot::ReduceHealth(unsigned int val)
 
   m_bHit = true;
 
-  m_iNumUpdatesHitPersistant = (int)(FrameRate * script->GetDouble("HitFlashTime"));
+  m_iNumUpdatesHitPersistant = (int)(FrameRate * script->Params().HitFlashTime);
 }
 
 //--------------------------- Possess -----------------------------------------
@@ -716,7 +806,7 @@ void Raven_Bot::SetUpVertexBuffer()
                                      Vector2D(-3,-8)};
 
   m_dBoundingRadius = 0.0;
-  double scale = script->GetDouble("Bot_Scale");
+  double scale = script->Params().Bot_Scale;
   
   for (int vtx=0; vtx<NumBotVerts; ++vtx)
   {
@@ -13,7 +13,7 @@
 #include <iosfwd>
 #include <map>
 
-#include "game/MovingEntity.h"
+#include "Game/MovingEntity.h"
 #include "misc/utils.h"
 #include "Raven_TargetingSystem.h"
 
@@ -25,6 +25,8 @@ class Raven_Weapon;
 struct Telegram;
 class Raven_Bot;
 class Goal_Think;
+class GoalArena;
+class Raven_FeatureCache;
 class Raven_WeaponSystem;
 class Raven_SensoryMemory;
 
@@ -33,6 +35,22 @@ class Raven_SensoryMemory;
 
 class Raven_Bot : public MovingEntity
 {
+public:
+
+  //the decision making tasks of Think. Task i is bit (1 << i)
+  enum
+  {
+    think_target_selection = 1 << 0,
+    think_goal_arbitration = 1 << 1,
+    think_vision_update    = 1 << 2,
+    think_weapon_selection = 1 << 3,
+
+    NumThinkTasks = 4
+  };
+
+  //the index i of the think task given by its bit
+  static constexpr int ThinkTaskIndex(int task){return task > 1 ? 1 + ThinkTaskIndex(task >> 1) : 0;}
+
 protected:
 
   enum Status{alive, dead, spawning};
@@ -48,6 +66,12 @@ protected:
   //this object handles the arbitration and processing of high level goals
   Goal_Think*                        m_pBrain;
 
+  //the memory the brain and its subgoals are created in
+  GoalArena*                         m_pGoalArena;
+
+  //the features the brain's goal evaluators read
+  Raven_FeatureCache*                m_pFeatures;
+
   //this is a class that acts as the bots sensory memory. Whenever this
   //bot sees or hears an opponent, a record of the event is updated in the 
   //memory.
@@ -82,6 +106,17 @@ protected:
 
   //each time this bot kills another this value is incremented
   int                                m_iScore;
+
+  //match statistics: the number of projectiles this bot has fired, how
+  //many of them damaged an opponent and the number of items picked up
+  int                                m_iNumShotsFired;
+  int                                m_iNumHits;
+  int                                m_iNumItemsPickedUp;
+
+  //the index given to this bot by the game. The slots are numbered from 0
+  //and are reused when a bot is removed, so they can be used to index
+  //arrays holding one element per bot (see Raven_SensoryMemory)
+  int                                m_iSlot;
   
   //the direction the bot is facing (and therefore the direction of aim). 
   //Note that this may not be the same as the bot's heading, which always
@@ -126,6 +161,15 @@ protected:
   // Question F
   Raven_Bot*						m_pTeamTarget;
 
+  //the decision making tasks to be run by the next call to Think. Set by
+  //PollRegulators or SetThinkTasks
+  int                                m_iThinkTasks;
+
+  //the tasks the last call to Think ran, and the time in microseconds each
+  //one took, indexed by ThinkTaskIndex
+  int                                m_iThinkTasksRun;
+  double                             m_dThinkTaskTime[NumThinkTasks];
+
 
 public:
   
@@ -135,6 +179,26 @@ public:
   //the usual suspects
   virtual void         Render();
   void         Update();
+
+  //Update is split into three steps so that the decision making of all the
+  //bots can be run in parallel (see Raven_Game::Update):
+  //
+  //  PollRegulators decides which decision making tasks are due this
+  //  update-step. It draws random numbers so it must be called serially.
+  //  When the game schedules the thinking of all its bots (see
+  //  FrameScheduler) it gives the tasks with SetThinkTasks instead.
+  //
+  //  Think selects a target, arbitrates between goals, updates the
+  //  sensory memory and selects a weapon. It only reads the rest of the
+  //  world and writes to this bot, so the bots may think concurrently.
+  //
+  //  Act processes the goals, moves the bot and fires its weapon. Anything
+  //  affecting the other bots (projectiles, messages) happens here, so it
+  //  must be called serially.
+  void         PollRegulators();
+  void         SetThinkTasks(int tasks);
+  void         Think();
+  void         Act();
   bool         HandleMessage(const Telegram& msg);
   void         Write(std::ostream&  os)const{/*not implemented*/}
   void         Read (std::ifstream& is){/*not implemented*/}
@@ -153,6 +217,21 @@ public:
   int           Score()const{return m_iScore;}
   void          IncrementScore(){++m_iScore;}
 
+  int           NumShotsFired()const{return m_iNumShotsFired;}
+  int           NumHits()const{return m_iNumHits;}
+  int           NumItemsPickedUp()const{return m_iNumItemsPickedUp;}
+  void          IncrementShotsFired(){++m_iNumShotsFired;}
+  void          IncrementHits(){++m_iNumHits;}
+  void          IncrementItemsPickedUp(){++m_iNumItemsPickedUp;}
+
+  int           Slot()const{return m_iSlot;}
+
+  //the think tasks the last call to Think ran, and the time the task i took
+  //in microseconds. 0 if it was not run
+  int           ThinkTasksRun()const{return m_iThinkTasksRun;}
+  double        ThinkTaskTime(int i)const{return m_dThinkTaskTime[i];}
+  void          SetSlot(int slot){m_iSlot = slot;}
+
   Vector2D      Facing()const{return m_vFacing;}
   double        FieldOfView()const{return m_dFieldOfView;}
 
@@ -221,6 +300,8 @@ public:
   Raven_Steering* const              GetSteering(){return m_pSteering;}
   Raven_PathPlanner* const           GetPathPlanner(){return m_pPathPlanner;}
   Goal_Think* const                  GetBrain(){return m_pBrain;}
+  GoalArena&                         GetGoalArena(){return *m_pGoalArena;}
+  Raven_FeatureCache* const          GetFeatures(){return m_pFeatures;}
   const Raven_TargetingSystem* const GetTargetSys()const{return m_pTargSys;}
   Raven_TargetingSystem* const       GetTargetSys(){return m_pTargSys;}
   Raven_Bot* const                   GetTargetBot()const{return m_pTargSys->GetTarget();}
@@ -1,10 +1,12 @@
 #include "Raven_Door.h"
-#include "Messaging/telegram.h"
+#include "Messaging/Telegram.h"
 #include "misc/Stream_Utility_Functions.h"
 #include <algorithm>
 #include "Raven_Messages.h"
 #include "Raven_Map.h"
-#include "2d/wall2d.h"
+#include "2D/Wall2D.h"
+#include "2D/geometry.h"
+#include "lua/Raven_Scriptor.h"
 
 //---------------------------- ctor -------------------------------------------
 //-----------------------------------------------------------------------------
@@ -13,6 +15,7 @@ Raven_Door::Raven_Door(Raven_Map* pMap,
 
                                   BaseGameEntity(GetValueFromStream<int>(is)),
                                   m_Status(closed),
+                                  m_pMap(pMap),
                                   m_iNumTicksStayOpen(60)                   //MGC!
 {
   Read(is);
@@ -25,6 +28,10 @@ Raven_Door::Raven_Door(Raven_Map* pMap,
   //create the walls that make up the door's geometry
   m_pWall1 = pMap->AddWall(m_vP1+perp, m_vP2+perp);
   m_pWall2 = pMap->AddWall(m_vP2-perp, m_vP1-perp);
+
+  //the door starts shut. The map gives the edges through it their costs
+  //for a shut door once it has made its tables of costs
+  FindEdges();
 }
 
 //---------------------------- dtor -------------------------------------------
@@ -52,6 +59,8 @@ void Raven_Door::Update()
       if (m_iNumTicksCurrentlyOpen-- < 0)
       {
         m_Status = closing;
+
+        SetEdgeCosts(false);
       }
     }
   }
@@ -70,6 +79,8 @@ void Raven_Door::ChangePosition(Vector2D newP1, Vector2D newP2)
 
   m_pWall2->SetFrom(m_vP2 - m_vtoP2Norm.Perp());
   m_pWall2->SetTo(m_vP1 - m_vtoP2Norm.Perp());
+
+  m_pMap->WallsMoved();
 }
 
 //---------------------------- Open -------------------------------------------
@@ -83,6 +94,8 @@ void Raven_Door::Open()
 
       m_iNumTicksCurrentlyOpen = m_iNumTicksStayOpen;
 
+      SetEdgeCosts(true);
+
       return;
       
     }
@@ -120,6 +133,53 @@ void Raven_Door::Close()
   }
 }
 
+//------------------------------ FindEdges ------------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Door::FindEdges()
+{
+  const Raven_Map::NavGraph& graph = m_pMap->GetNavGraph();
+
+  Raven_Map::NavGraph::ConstNodeIterator NodeItr(graph);
+  for (const Raven_Map::NavGraph::NodeType* pN=NodeItr.begin();
+       !NodeItr.end();
+       pN=NodeItr.next())
+  {
+    Raven_Map::NavGraph::ConstEdgeIterator EdgeItr(graph, pN->Index());
+    for (const Raven_Map::NavGraph::EdgeType* pE=EdgeItr.begin();
+         !EdgeItr.end();
+         pE=EdgeItr.next())
+    {
+      //one way is enough
+      if (pE->From() > pE->To()) continue;
+
+      if (LineIntersection2D(graph.GetNode(pE->From()).Pos(),
+                             graph.GetNode(pE->To()).Pos(),
+                             m_vP1,
+                             m_vP2))
+      {
+        DoorEdge edge = {pE->From(), pE->To(), pE->Cost()};
+
+        m_Edges.push_back(edge);
+      }
+    }
+  }
+}
+
+//----------------------------- SetEdgeCosts ----------------------------------
+//
+//  a shut door makes the edges through it dearer rather than cutting them,
+//  so a bot with no other way still goes to the door (and can open it)
+//-----------------------------------------------------------------------------
+void Raven_Door::SetEdgeCosts(bool bOpen)
+{
+  const double factor = bOpen ? 1.0 : script->Params().Door_ClosedEdgeCostFactor;
+
+  for (unsigned int e=0; e<m_Edges.size(); ++e)
+  {
+    m_pMap->SetEdgeCost(m_Edges[e].From, m_Edges[e].To, m_Edges[e].OpenCost * factor);
+  }
+}
+
 //-------------------------- AddSwitch ----------------------------------------
 //
 //  adds the id of a trigger for the door to notify when operating
@@ -13,8 +13,8 @@
 //-----------------------------------------------------------------------------
 #include <vector>
 #include <iosfwd>
-#include "2d/vector2d.h"
-#include "game/BaseGameEntity.h"
+#include "2D/Vector2D.h"
+#include "Game/BaseGameEntity.h"
 
 
 
@@ -33,6 +33,9 @@ protected:
 
   door_status                m_Status;
 
+  //the map the door's walls belong to
+  Raven_Map*                 m_pMap;
+
   //a sliding door is created from two walls, back to back.These walls must
   //be added to a map's geometry in order for an agent to detect them
   Wall2D*                    m_pWall1;
@@ -60,9 +63,23 @@ protected:
   //the door's current size
   double     m_dCurrentSize;
 
+  //the navgraph edges which cross the door and their costs when it is open.
+  //Each edge is kept one way only; the map sets the costs of both
+  struct DoorEdge
+  {
+    int     From;
+    int     To;
+    double  OpenCost;
+  };
+
+  std::vector<DoorEdge>      m_Edges;
+
   void  Open();
   void  Close();
-  
+
+  //finds the navgraph edges crossing the door
+  void  FindEdges();
+
   void ChangePosition(Vector2D newP1, Vector2D newP2);
  
 public:
@@ -80,6 +97,9 @@ public:
   //adds the ID of a switch
   void AddSwitch(unsigned int id);
 
+  //gives the edges crossing the door their costs for the door open or shut
+  void SetEdgeCosts(bool bOpen);
+
   std::vector<unsigned int> GetSwitchIDs()const{return m_Switches;}
 };
 
@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------
+//
+//  Name:   Raven_FuzzySurfaces.cpp
+//
+//  Desc:   command line tool checking the lookup tables the weapons'
+//          desirability rules are baked into (see Weapon_UseFuzzySurfaces
+//          in Params.lua). For each weapon it bakes a surface, then
+//          compares it with the rules at SamplesPerCell points per cell
+//          along each input and reports the size of the table, the
+//          deviation found while baking, the largest deviation found by
+//          the comparison and where it is, the mean deviation, and the time
+//          an evaluation takes with the rules and with the table. A table
+//          baked further from the rules than the tolerance is not used by
+//          the game, which keeps evaluating the rules of that weapon.
+//
+//          the exit code is 2 when a table the game would use deviates by
+//          more than the tolerance.
+//
+//          usage: raven_fuzzysurfaces [resolution] [tolerance] [SamplesPerCell]
+//
+//          the resolution and tolerance default to the ones in Params.lua,
+//          SamplesPerCell to 8.
+//
+//          must be run from the directory holding Params.lua
+//
+//------------------------------------------------------------------------
+#include <cstdlib>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "lua/Raven_Scriptor.h"
+#include "fuzzy/FuzzySurface.h"
+#include "armory/Weapon_RocketLauncher.h"
+#include "armory/Weapon_RailGun.h"
+#include "armory/Weapon_ShotGun.h"
+#include "armory/Weapon_Blaster.h"
+#include "armory/Weapon_Grenade.h"
+#include "armory/Weapon_Blade.h"
+
+
+//the number of evaluations timed per weapon
+static const int NumTimedEvaluations = 100000;
+
+
+//------------------------------- TimeEvaluations -----------------------------
+//
+//  the average microseconds an evaluation takes with the rules and with the
+//  surface, over inputs spread across their ranges
+//-----------------------------------------------------------------------------
+static void TimeEvaluations(FuzzyProgram&       prog,
+                            const FuzzySurface& surface,
+                            double&             ProgramTime,
+                            double&             SurfaceTime)
+{
+  typedef std::chrono::steady_clock clock;
+
+  const int NumInputs = prog.NumInputs();
+
+  std::vector<double> inputs(NumTimedEvaluations * NumInputs);
+
+  for (int i=0; i<NumTimedEvaluations; ++i)
+  {
+    for (int in=0; in<NumInputs; ++in)
+    {
+      inputs[i*NumInputs + in] = RandInRange(prog.InputMinRange(in), prog.InputMaxRange(in));
+    }
+  }
+
+  double sum = 0;
+
+  clock::time_point start = clock::now();
+
+  for (int i=0; i<NumTimedEvaluations; ++i)
+  {
+    double out;
+
+    prog.Evaluate(&inputs[i*NumInputs], &out);
+
+    sum += out;
+  }
+
+  ProgramTime = std::chrono::duration<double, std::micro>(clock::now() - start).count() / NumTimedEvaluations;
+
+  start = clock::now();
+
+  for (int i=0; i<NumTimedEvaluations; ++i)
+  {
+    const double* in = &inputs[i*NumInputs];
+
+    sum += surface.Evaluate(in[0], NumInputs > 1 ? in[1] : 0.0);
+  }
+
+  SurfaceTime = std::chrono::duration<double, std::micro>(clock::now() - start).count() / NumTimedEvaluations;
+
+  //keeps the loops from being optimized away
+  if (sum == -1) std::cout << sum;
+}
+
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    const int    resolution     = argc > 1 ? atoi(argv[1]) : script->Params().Weapon_FuzzySurfaceResolution;
+    const double tolerance      = argc > 2 ? atof(argv[2]) : script->Params().Weapon_FuzzySurfaceTolerance;
+    const int    SamplesPerCell = argc > 3 ? atoi(argv[3]) : 8;
+
+    std::cout << "resolution " << resolution << ", tolerance " << tolerance
+              << ", " << SamplesPerCell << " samples per cell" << std::endl;
+
+    struct {const char* Name; Raven_Weapon::AddFuzzyRulesFunc AddFuzzyRules;} weapons[] =
+    {
+      {"blaster",         Blaster::AddFuzzyRules},
+      {"shotgun",         ShotGun::AddFuzzyRules},
+      {"rail gun",        RailGun::AddFuzzyRules},
+      {"rocket launcher", RocketLauncher::AddFuzzyRules},
+      {"grenade",         Grenade::AddFuzzyRules},
+      {"blade",           Blade::AddFuzzyRules}
+    };
+
+    bool bWithinTolerance = true;
+
+    for (unsigned int w=0; w<sizeof(weapons)/sizeof(weapons[0]); ++w)
+    {
+      FuzzyModule fm;
+
+      FuzzyProgram prog = weapons[w].AddFuzzyRules(fm);
+
+      FuzzySurface surface;
+
+      surface.Bake(prog, resolution, tolerance);
+
+      double WorstX = 0, WorstY = 0, mean = 0;
+
+      const double deviation = surface.Deviation(prog, SamplesPerCell, &WorstX, &WorstY, &mean);
+
+      double ProgramTime, SurfaceTime;
+
+      TimeEvaluations(prog, surface, ProgramTime, SurfaceTime);
+
+      std::cout << weapons[w].Name << ": " << surface.Resolution();
+
+      if (prog.NumInputs() > 1) std::cout << "x" << surface.Resolution();
+
+      std::cout << " samples, deviation " << surface.MaxError() << " when baked, "
+                << deviation << " at (" << WorstX;
+
+      if (prog.NumInputs() > 1) std::cout << ", " << WorstY;
+
+      std::cout << "), mean " << mean << ", " << ProgramTime << "us per evaluation with the rules, "
+                << SurfaceTime << "us with the table";
+
+      const bool bUsed = surface.MaxError() <= tolerance;
+
+      std::cout << (bUsed ? "" : " (not used, the rules are kept)") << std::endl;
+
+      if (bUsed && deviation > tolerance) bWithinTolerance = false;
+    }
+
+    return bWithinTolerance ? 0 : 2;
+  }
+
+  catch (const std::runtime_error& err)
+  {
+    std::cerr << err.what() << std::endl;
+
+    return 1;
+  }
+}
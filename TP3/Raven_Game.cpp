@@ -1,19 +1,21 @@
 #include "Raven_Game.h"
 #include "Raven_ObjectEnumerations.h"
+#include "constants.h"
 #include "misc/WindowUtils.h"
 #include "misc/Cgdi.h"
 #include "Raven_SteeringBehaviors.h"
 #include "lua/Raven_Scriptor.h"
 #include "navigation/Raven_PathPlanner.h"
-#include "game/EntityManager.h"
-#include "2d/WallIntersectionTests.h"
+#include "Game/EntityManager.h"
+#include "2D/WallIntersectionTests.h"
 #include "Raven_Map.h"
 #include "Raven_Door.h"
 #include "Raven_UserOptions.h"
-#include "Time/PrecisionTimer.h"
+#include "Time/CrudeTimer.h"
+#include "Time/FrameScheduler.h"
 #include "Raven_SensoryMemory.h"
 #include "Raven_WeaponSystem.h"
-#include "messaging/MessageDispatcher.h"
+#include "Messaging/MessageDispatcher.h"
 #include "Raven_Messages.h"
 #include "GraveMarkers.h"
 
@@ -28,6 +30,11 @@
 #include "goals/Goal_Think.h"
 #include "goals/Raven_Goal_Types.h"
 
+#include "Game/WorldContext.h"
+#include "misc/WorkStealingPool.h"
+
+#include <algorithm>
+
 //uncomment to write object creation/deletion to debug console
 //#define  LOG_CREATIONAL_STUFF
 
@@ -38,6 +45,8 @@ Raven_Game::Raven_Game():m_pSelectedBot(NULL),
                          m_bPaused(false),
                          m_bRemoveABot(false),
                          m_pMap(NULL),
+                         m_pThinkPool(NULL),
+                         m_pThinkScheduler(NULL),
                          m_pPathManager(NULL),
                          m_pGraveMarkers(NULL),
 						 teamMode(false),
@@ -45,7 +54,7 @@ Raven_Game::Raven_Game():m_pSelectedBot(NULL),
 						 nextTeamToAdd(type_bot_red_team)
 {
   //load in the default map
-  LoadMap(script->GetString("StartMap"));
+  LoadMap(script->Params().StartMap);
 }
 
 
@@ -55,6 +64,7 @@ Raven_Game::~Raven_Game()
 {
   Clear();
   delete m_pPathManager;
+  delete m_pThinkScheduler;
   delete m_pMap;
   
   delete m_pGraveMarkers;
@@ -72,7 +82,7 @@ void Raven_Game::Clear()
 #endif
 
   //delete the bots
-  std::list<Raven_Bot*>::iterator it = m_Bots.begin();
+  std::vector<Raven_Bot*>::iterator it = m_Bots.begin();
   for (it; it != m_Bots.end(); ++it)
   {
 #ifdef LOG_CREATIONAL_STUFF
@@ -83,20 +93,23 @@ void Raven_Game::Clear()
     delete *it;
   }
 
-  //delete any active projectiles
-  std::list<Raven_Projectile*>::iterator curW = m_Projectiles.begin();
-  for (curW; curW != m_Projectiles.end(); ++curW)
-  {
-#ifdef LOG_CREATIONAL_STUFF
-    debug_con << "deleting projectile id: " << (*curW)->ID() << "";
-#endif
-
-    delete *curW;
-  }
+  //destroy any active projectiles
+  m_Bolts.Clear();
+  m_Rockets.Clear();
+  m_Slugs.Clear();
+  m_Pellets.Clear();
+  m_Grenades.Clear();
+  m_BladeStrikes.Clear();
 
   //clear the containers
-  m_Projectiles.clear();
   m_Bots.clear();
+  m_BotSlots.clear();
+
+  for (int t=0; t<MaxTeams; ++t)
+  {
+    m_TeamMembers[t].clear();
+  }
+  m_Noises.clear();
 
   m_pSelectedBot = NULL;
 
@@ -112,6 +125,10 @@ void Raven_Game::Update()
   //don't update if the user has paused the game
   if (m_bPaused) return;
 
+  //advance the game time by one tick (only has an effect when the clock
+  //is in fixed step mode)
+  Clock->Update();
+
   m_pGraveMarkers->Update();
 
   //get any player keyboard input
@@ -127,29 +144,37 @@ void Raven_Game::Update()
     (*curDoor)->Update();
   }
 
-  //update any current projectiles
-  std::list<Raven_Projectile*>::iterator curW = m_Projectiles.begin();
-  while (curW != m_Projectiles.end())
+  //the doors change the costs of the edges through them as they open and
+  //shut. The bots' path planners are told so their searches can be mended
+  if (!m_pMap->GetChangedEdges().empty())
   {
-    //test for any dead projectiles and remove them if necessary
-    if (!(*curW)->isDead())
+    std::vector<Raven_Bot*>::iterator curBot = m_Bots.begin();
+    for (curBot; curBot != m_Bots.end(); ++curBot)
     {
-      (*curW)->Update();
-
-      ++curW;
+      (*curBot)->GetPathPlanner()->EdgeCostsChanged(m_pMap->GetChangedEdges());
     }
-    else
-    {    
-      delete *curW;
 
-      curW = m_Projectiles.erase(curW);
-    }   
+    m_pMap->ClearChangedEdges();
   }
+
+  //sort the bots into the grid used by the projectiles, then update any
+  //current projectiles
+  m_BotGrid.Rebuild(m_Bots.begin(), m_Bots.end());
+
+  UpdateProjectiles();
   
-  //update the bots
+  //update the bots. This is done in three passes: the first handles the
+  //spawning and dead bots and decides what the living ones think about
+  //(asking the scheduler or their regulators), then the living bots do
+  //their thinking (in parallel if possible) and finally each of them acts
+  //on its decisions, in roster order
   bool bSpawnPossible = true;
+
+  if (m_pThinkScheduler) m_pThinkScheduler->BeginFrame();
+
+  m_ThinkingBots.clear();
   
-  std::list<Raven_Bot*>::iterator curBot = m_Bots.begin();
+  std::vector<Raven_Bot*>::iterator curBot = m_Bots.begin();
   for (curBot; curBot != m_Bots.end(); ++curBot)
   {
     //if this bot's status is 'respawning' attempt to resurrect it from
@@ -173,10 +198,45 @@ void Raven_Game::Update()
     //if this bot is alive update it.
     else if ( (*curBot)->isAlive())
     {
-      (*curBot)->Update();
+      if (m_pThinkScheduler)
+      {
+        (*curBot)->SetThinkTasks(m_pThinkScheduler->DueTasks((*curBot)->Slot()));
+      }
+      else
+      {
+        (*curBot)->PollRegulators();
+      }
+
+      m_ThinkingBots.push_back(*curBot);
     }  
   } 
 
+  ThinkBots();
+
+  //let the scheduler know how long the thinking took. A possessed bot does
+  //not run the tasks due, so only the tasks actually run are recorded
+  if (m_pThinkScheduler)
+  {
+    for (unsigned int b=0; b<m_ThinkingBots.size(); ++b)
+    {
+      for (int t=0; t<Raven_Bot::NumThinkTasks; ++t)
+      {
+        if (m_ThinkingBots[b]->ThinkTasksRun() & (1 << t))
+        {
+          m_pThinkScheduler->RecordCost(t, m_ThinkingBots[b]->ThinkTaskTime(t));
+        }
+      }
+    }
+  }
+
+  for (unsigned int b=0; b<m_ThinkingBots.size(); ++b)
+  {
+    m_ThinkingBots[b]->Act();
+  }
+
+  //let the bots hear the shots fired this update-step
+  PropagateNoises();
+
   //update the triggers
   m_pMap->UpdateTriggerSystem(m_Bots);
 
@@ -188,18 +248,14 @@ void Raven_Game::Update()
     {
 		if (teamMode) {
 			for (int i = type_bot_red_team; i < type_bot_red_team + teamNumber; ++i) {
-				Raven_Bot* member = GetTeamMembers(i).back();
-
-				for (auto pBot = m_Bots.crbegin(); pBot != m_Bots.rend(); ++pBot) {
-					if (member == *pBot) {
-						if (*pBot == m_pSelectedBot) m_pSelectedBot = 0;
-						NotifyAllBotsOfRemoval(*pBot);
-						delete *pBot;
-						m_Bots.remove(*pBot);
-
-						break;
-					}
-				}
+				if (GetTeamMembers(i).empty()) continue;
+
+				Raven_Bot* pBot = GetTeamMembers(i).back();
+
+				if (pBot == m_pSelectedBot) m_pSelectedBot = 0;
+				NotifyAllBotsOfRemoval(pBot);
+				RemoveFromRoster(pBot);
+				delete pBot;
 			}
 		}
 		else {
@@ -207,8 +263,8 @@ void Raven_Game::Update()
 
 			if (pBot == m_pSelectedBot) m_pSelectedBot = 0;
 			NotifyAllBotsOfRemoval(pBot);
-			delete m_Bots.back();
-			m_Bots.remove(pBot);
+			RemoveFromRoster(pBot);
+			delete pBot;
 			pBot = 0;
 		}
     }
@@ -238,7 +294,7 @@ bool Raven_Game::AttemptToAddBot(Raven_Bot* pBot)
     Vector2D pos = m_pMap->GetRandomSpawnPoint();
 
     //check to see if it's occupied
-    std::list<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
+    std::vector<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
 
     bool bAvailable = true;
 
@@ -273,7 +329,7 @@ void Raven_Game::AddBots(unsigned int NumBotsToAdd, int entityType)
 		Vector2D leaderPos;
 		//create a bot. (its position is irrelevant at this point because it will
 		//not be rendered until it is spawned)
-		std::list<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
+		std::vector<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
 		for (curBot; curBot != m_Bots.end(); ++curBot)
 		{
 			if ((*curBot)->isLeader() && (*curBot)->EntityType() == entityType)
@@ -294,7 +350,7 @@ void Raven_Game::AddBots(unsigned int NumBotsToAdd, int entityType)
 		rb->GetSteering()->WallAvoidanceOn();
 		rb->GetSteering()->SeparationOn();
 
-		m_Bots.push_back(rb);
+		AddToRoster(rb);
 
 		//register the bot with the entity manager
 		EntityMgr->RegisterEntity(rb);
@@ -313,7 +369,7 @@ void Raven_Game::AddBots(unsigned int NumBotsToAdd, int entityType)
 //-----------------------------------------------------------------------------
 void Raven_Game::NotifyAllBotsOfRemoval(Raven_Bot* pRemovedBot)const
 {
-    std::list<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
+    std::vector<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
     for (curBot; curBot != m_Bots.end(); ++curBot)
     {
       Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
@@ -324,6 +380,63 @@ void Raven_Game::NotifyAllBotsOfRemoval(Raven_Bot* pRemovedBot)const
 
     }
 }
+//----------------------------- AddToRoster -----------------------------------
+//
+//  the bot is given the lowest free slot so the slots stay densely packed
+//-----------------------------------------------------------------------------
+void Raven_Game::AddToRoster(Raven_Bot* pBot)
+{
+  m_Bots.push_back(pBot);
+
+  const int team = pBot->EntityType() - type_bot_red_team;
+
+  if (team >= 0 && team < MaxTeams)
+  {
+    m_TeamMembers[team].push_back(pBot);
+  }
+
+  unsigned int slot = 0;
+
+  while (slot < m_BotSlots.size() && m_BotSlots[slot]) ++slot;
+
+  if (slot == m_BotSlots.size())
+  {
+    m_BotSlots.push_back(pBot);
+  }
+  else
+  {
+    m_BotSlots[slot] = pBot;
+  }
+
+  pBot->SetSlot(slot);
+
+  if (m_pThinkScheduler) m_pThinkScheduler->AddClient(slot);
+}
+
+//--------------------------- RemoveFromRoster --------------------------------
+//
+//  the remaining bots keep their order (and their slot)
+//-----------------------------------------------------------------------------
+void Raven_Game::RemoveFromRoster(Raven_Bot* pBot)
+{
+  m_Bots.erase(std::find(m_Bots.begin(), m_Bots.end(), pBot));
+
+  const int team = pBot->EntityType() - type_bot_red_team;
+
+  if (team >= 0 && team < MaxTeams)
+  {
+    std::vector<Raven_Bot*>& members = m_TeamMembers[team];
+
+    members.erase(std::find(members.begin(), members.end(), pBot));
+  }
+
+  m_BotSlots[pBot->Slot()] = NULL;
+
+  if (m_pThinkScheduler) m_pThinkScheduler->RemoveClient(pBot->Slot());
+
+  pBot->SetSlot(-1);
+}
+
 //-------------------------------RemoveBot ------------------------------------
 //
 //  removes the last bot to be added from the game
@@ -333,13 +446,68 @@ void Raven_Game::RemoveBot()
   m_bRemoveABot = true;
 }
 
+//------------------------------ ThinkBots ------------------------------------
+//
+//  a bot's Think only reads the world and writes to the bot itself so the
+//  bots can think in any order, on any number of threads, with the same
+//  results. The worker threads are bound to the calling thread's world
+//  while they work on it
+//-----------------------------------------------------------------------------
+void Raven_Game::ThinkBots()
+{
+  //the number of bots given to a thread at a time
+  const int GrainSize = 4;
+
+  if (!m_pThinkPool || (int)m_ThinkingBots.size() <= GrainSize)
+  {
+    for (unsigned int b=0; b<m_ThinkingBots.size(); ++b)
+    {
+      m_ThinkingBots[b]->Think();
+    }
+
+    return;
+  }
+
+  WorldContext* pWorld = WorldContext::Current();
+
+  m_pThinkPool->ParallelFor(0, (int)m_ThinkingBots.size(), GrainSize,
+                            [this, pWorld](int begin, int end)
+  {
+    const bool bBind = pWorld && !pWorld->isCurrent();
+
+    if (bBind) pWorld->MakeCurrent();
+
+    for (int b=begin; b<end; ++b)
+    {
+      m_ThinkingBots[b]->Think();
+    }
+
+    if (bBind) pWorld->Release();
+  });
+}
+
+//------------------------- UpdateProjectiles ---------------------------------
+//
+//  the projectiles are updated a type at a time. Each pool calls the
+//  Update method of its own type directly
+//-----------------------------------------------------------------------------
+void Raven_Game::UpdateProjectiles()
+{
+  m_Bolts.Update();
+  m_Rockets.Update();
+  m_Slugs.Update();
+  m_Pellets.Update();
+  m_Grenades.Update();
+  m_BladeStrikes.Update();
+}
+
 //--------------------------- AddBolt -----------------------------------------
 //-----------------------------------------------------------------------------
 void Raven_Game::AddBolt(Raven_Bot* shooter, Vector2D target)
 {
-  Raven_Projectile* rp = new Bolt(shooter, target);
+  Raven_Projectile* rp = m_Bolts.Create(shooter, target);
 
-  m_Projectiles.push_back(rp);
+  shooter->IncrementShotsFired();
   
   #ifdef LOG_CREATIONAL_STUFF
   debug_con << "Adding a bolt " << rp->ID() << " at pos " << rp->Pos() << "";
@@ -349,9 +517,9 @@ void Raven_Game::AddBolt(Raven_Bot* shooter, Vector2D target)
 //------------------------------ AddRocket --------------------------------
 void Raven_Game::AddRocket(Raven_Bot* shooter, Vector2D target)
 {
-  Raven_Projectile* rp = new Rocket(shooter, target);
+  Raven_Projectile* rp = m_Rockets.Create(shooter, target);
 
-  m_Projectiles.push_back(rp);
+  shooter->IncrementShotsFired();
   
   #ifdef LOG_CREATIONAL_STUFF
   debug_con << "Adding a rocket " << rp->ID() << " at pos " << rp->Pos() << "";
@@ -361,9 +529,9 @@ void Raven_Game::AddRocket(Raven_Bot* shooter, Vector2D target)
 //------------------------- AddRailGunSlug -----------------------------------
 void Raven_Game::AddRailGunSlug(Raven_Bot* shooter, Vector2D target)
 {
-  Raven_Projectile* rp = new Slug(shooter, target);
+  Raven_Projectile* rp = m_Slugs.Create(shooter, target);
 
-  m_Projectiles.push_back(rp);
+  shooter->IncrementShotsFired();
   
   #ifdef LOG_CREATIONAL_STUFF
   debug_con << "Adding a rail gun slug" << rp->ID() << " at pos " << rp->Pos() << "";
@@ -373,9 +541,9 @@ void Raven_Game::AddRailGunSlug(Raven_Bot* shooter, Vector2D target)
 //------------------------- AddShotGunPellet -----------------------------------
 void Raven_Game::AddShotGunPellet(Raven_Bot* shooter, Vector2D target)
 {
-  Raven_Projectile* rp = new Pellet(shooter, target);
+  Raven_Projectile* rp = m_Pellets.Create(shooter, target);
 
-  m_Projectiles.push_back(rp);
+  shooter->IncrementShotsFired();
   
   #ifdef LOG_CREATIONAL_STUFF
   debug_con << "Adding a shotgun shell " << rp->ID() << " at pos " << rp->Pos() << "";
@@ -385,9 +553,9 @@ void Raven_Game::AddShotGunPellet(Raven_Bot* shooter, Vector2D target)
 //------------------------------ AddGrenade --------------------------------
 void Raven_Game::AddGrenade(Raven_Bot* shooter, Vector2D target)
 {
-	Raven_Projectile* rp = new Grenade_Projectile(shooter, target);
+	Raven_Projectile* rp = m_Grenades.Create(shooter, target);
 
-	m_Projectiles.push_back(rp);
+	shooter->IncrementShotsFired();
 
 #ifdef LOG_CREATIONAL_STUFF
 	debug_con << "Adding a grenade " << rp->ID() << " at pos " << rp->Pos() << "";
@@ -401,15 +569,68 @@ void Raven_Game::AddBladeStrike(Raven_Bot* swordsman, Vector2D target)
 	Vector2D direction = target - swordsman->Pos();
 	direction.Normalize();
 
-	Raven_Projectile* rp = new Blade_Strike(swordsman, script->GetDouble("Blade_Range") * direction + swordsman->Pos());
+	Raven_Projectile* rp = m_BladeStrikes.Create(swordsman, script->Params().Blade_Range * direction + swordsman->Pos());
 
-	m_Projectiles.push_back(rp);
+	swordsman->IncrementShotsFired();
 
 #ifdef LOG_CREATIONAL_STUFF
 	debug_con << "Adding a blade strike " << rp->ID() << " at pos " << rp->Pos() << "";
 #endif
 }
 
+//------------------------------ AddNoise -------------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Game::AddNoise(Raven_Bot* pSource, double range)
+{
+  Noise noise;
+
+  noise.pSource = pSource;
+  noise.vPos    = pSource->Pos();
+  noise.dRange  = range;
+
+  m_Noises.push_back(noise);
+}
+
+//--------------------------- PropagateNoises ---------------------------------
+//
+//  the noises made this update-step are resolved in one pass: the bot grid
+//  is brought up to date with the positions the bots moved to, then each
+//  noise sends a Msg_GunshotSound to every living bot in its range
+//-----------------------------------------------------------------------------
+void Raven_Game::PropagateNoises()
+{
+  if (m_Noises.empty()) return;
+
+  m_BotGrid.Rebuild(m_Bots.begin(), m_Bots.end());
+
+  for (unsigned int n=0; n<m_Noises.size(); ++n)
+  {
+    const Noise& noise = m_Noises[n];
+
+    const std::vector<Raven_Bot*>& near = m_BotGrid.QueryCircle(noise.vPos, noise.dRange);
+
+    for (unsigned int b=0; b<near.size(); ++b)
+    {
+      Raven_Bot* pBot = near[b];
+
+      if (!pBot->isAlive()) continue;
+
+      const double range = noise.dRange + pBot->BRadius();
+
+      if (Vec2DDistanceSq(noise.vPos, pBot->Pos()) < range*range)
+      {
+        Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
+                                SENDER_ID_IRRELEVANT,
+                                pBot->ID(),
+                                Msg_GunshotSound,
+                                noise.pSource);
+      }
+    }
+  }
+
+  m_Noises.clear();
+}
+
 
 //----------------------------- GetBotAtPosition ------------------------------
 //
@@ -419,7 +640,7 @@ void Raven_Game::AddBladeStrike(Raven_Bot* swordsman, Vector2D target)
 //-----------------------------------------------------------------------------
 Raven_Bot* Raven_Game::GetBotAtPosition(Vector2D CursorPos)const
 {
-  std::list<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
+  std::vector<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
 
   for (curBot; curBot != m_Bots.end(); ++curBot)
   {
@@ -435,6 +656,20 @@ Raven_Bot* Raven_Game::GetBotAtPosition(Vector2D CursorPos)const
   return NULL;
 }
 
+//--------------------------- GetBotFromID ------------------------------------
+//-----------------------------------------------------------------------------
+Raven_Bot* Raven_Game::GetBotFromID(int id)const
+{
+  std::vector<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
+
+  for (curBot; curBot != m_Bots.end(); ++curBot)
+  {
+    if ((*curBot)->ID() == id) return *curBot;
+  }
+
+  return NULL;
+}
+
 //-------------------------------- LoadMap ------------------------------------
 //
 //  sets up the game environment from map file
@@ -448,10 +683,28 @@ bool Raven_Game::LoadMap(const std::string& filename)
   delete m_pMap;
   delete m_pGraveMarkers;
   delete m_pPathManager;
+  delete m_pThinkScheduler;
 
   //in with the new
-  m_pGraveMarkers = new GraveMarkers(script->GetDouble("GraveLifetime"));
-  m_pPathManager = new PathManager<Raven_PathPlanner>(script->GetInt("MaxSearchCyclesPerUpdateStep"));
+  m_pGraveMarkers = new GraveMarkers(script->Params().GraveLifetime);
+  m_pPathManager = new PathManager<Raven_PathPlanner>(script->Params().MaxSearchCyclesPerUpdateStep);
+  m_pThinkScheduler = NULL;
+
+  if (script->Params().AI_UseScheduler)
+  {
+    m_pThinkScheduler = new FrameScheduler(FrameRate);
+
+    //in the order of the think tasks of Raven_Bot
+    m_pThinkScheduler->AddTask(script->Params().Bot_TargetingUpdateFreq);
+    m_pThinkScheduler->AddTask(script->Params().Bot_GoalAppraisalUpdateFreq);
+    m_pThinkScheduler->AddTask(script->Params().Bot_VisionUpdateFreq);
+    m_pThinkScheduler->AddTask(script->Params().Bot_WeaponSelectionFrequency);
+
+    m_pThinkScheduler->SetBudget(script->Params().AI_FrameBudget);
+  }
+
+  Raven_WeaponSystem::BakeFuzzySurfaces();
+
   m_pMap = new Raven_Map();
 
   //make sure the entity manager is reset
@@ -461,7 +714,12 @@ bool Raven_Game::LoadMap(const std::string& filename)
   //load the new map data
   if (m_pMap->LoadMap(filename))
   { 
-	  int nbBots = script->GetInt("NumBots");
+    m_BotGrid.Resize(m_pMap->GetSizeX(),
+                     m_pMap->GetSizeY(),
+                     script->Params().NumCellsX,
+                     script->Params().NumCellsY);
+
+	  int nbBots = script->Params().NumBots;
 
 	  for (int i = type_bot_red_team; i < type_bot_red_team + teamNumber; ++i) {
 		  AddBots(1, i);
@@ -505,21 +763,18 @@ void Raven_Game::Movement(Vector2D direction)
 	}
 }
 
-std::vector<Raven_Bot*> Raven_Game::GetTeamMembers(int entity_type)
+const std::vector<Raven_Bot*>& Raven_Game::GetTeamMembers(int entity_type)const
 {
-	std::vector<Raven_Bot *> teamMembers;
+	const int team = entity_type - type_bot_red_team;
 
-	for (Raven_Bot *bot : m_Bots) {
-		if (bot->EntityType() == entity_type) {
-			teamMembers.push_back(bot);
-		}
-	}
-	return teamMembers;
+	if (team < 0 || team >= MaxTeams) return m_NoTeamMembers;
+
+	return m_TeamMembers[team];
 }
 
-void Raven_Game::ClickRightMouseButton(POINTS p)
+void Raven_Game::ClickRightMouseButton(Vector2D p)
 {
-  Raven_Bot* pBot = GetBotAtPosition(POINTStoVector(p));
+  Raven_Bot* pBot = GetBotAtPosition(p);
 
   //if there is no selected bot just return;
   if (!pBot && m_pSelectedBot == NULL) return;
@@ -552,25 +807,25 @@ void Raven_Game::ClickRightMouseButton(POINTS p)
     //movement command will be queued
     if (IS_KEY_PRESSED('Q'))
     {
-      m_pSelectedBot->GetBrain()->QueueGoal_MoveToPosition(POINTStoVector(p));
+      m_pSelectedBot->GetBrain()->QueueGoal_MoveToPosition(p);
     }
     else
     {
       //clear any current goals
       m_pSelectedBot->GetBrain()->RemoveAllSubgoals();
 
-      m_pSelectedBot->GetBrain()->AddGoal_MoveToPosition(POINTStoVector(p));
+      m_pSelectedBot->GetBrain()->AddGoal_MoveToPosition(p);
     }
   }
 }
 
 //---------------------- ClickLeftMouseButton ---------------------------------
 //-----------------------------------------------------------------------------
-void Raven_Game::ClickLeftMouseButton(POINTS p)
+void Raven_Game::ClickLeftMouseButton(Vector2D p)
 {
   if (m_pSelectedBot && m_pSelectedBot->isPossessed())
   {
-    m_pSelectedBot->FireWeapon(POINTStoVector(p));
+    m_pSelectedBot->FireWeapon(p);
   }
 }
 
@@ -675,7 +930,7 @@ Raven_Game::GetAllBotsInFOV(const Raven_Bot* pBot)const
 {
   std::vector<Raven_Bot*> VisibleBots;
 
-  std::list<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
+  std::vector<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
   for (curBot; curBot != m_Bots.end(); ++curBot)
   {
     //make sure time is not wasted checking against the same bot or against a
@@ -806,7 +1061,7 @@ void Raven_Game::Render()
   else
   {
     //render all the entities
-    std::list<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
+    std::vector<Raven_Bot*>::const_iterator curBot = m_Bots.begin();
     for (curBot; curBot != m_Bots.end(); ++curBot)
     {
       if ((*curBot)->isAlive())
@@ -817,11 +1072,12 @@ void Raven_Game::Render()
   }
   
   //render any projectiles
-  std::list<Raven_Projectile*>::const_iterator curW = m_Projectiles.begin();
-  for (curW; curW != m_Projectiles.end(); ++curW)
-  {
-    (*curW)->Render();
-  }
+  m_Bolts.Render();
+  m_Rockets.Render();
+  m_Slugs.Render();
+  m_Pellets.Render();
+  m_Grenades.Render();
+  m_BladeStrikes.Render();
 
  // gdi->TextAtPos(300, WindowHeight - 70, "Num Current Searches: " + ttos(m_pPathManager->GetNumActiveSearches()));
 
@@ -897,7 +1153,7 @@ void Raven_Game::Render()
 void Raven_Game::BalanceTeams() {
 	int maxSizeTeam = (int)GetTeamMembers(type_bot_red_team).size();
 	for (int i = type_bot_red_team + 1; i < type_bot_red_team + teamNumber; ++i) {
-		std::vector<Raven_Bot *> team = GetTeamMembers(i);
+		const std::vector<Raven_Bot *>& team = GetTeamMembers(i);
 
 		if ((int)team.size() > maxSizeTeam) {
 			maxSizeTeam = team.size();
@@ -905,7 +1161,7 @@ void Raven_Game::BalanceTeams() {
 	}
 
 	for (int i = type_bot_red_team; i < type_bot_red_team + teamNumber; ++i) {
-		std::vector<Raven_Bot *> team = GetTeamMembers(i);
+		const std::vector<Raven_Bot *>& team = GetTeamMembers(i);
 		
 		if ((int) team.size() < maxSizeTeam) {
 			AddBots(maxSizeTeam - (int)team.size(), i);
@@ -928,28 +1184,25 @@ void Raven_Game::ChangeGameMode() {
 
 void Raven_Game::DecreaseTeamNumber() { 
 	if (teamMode) {
-		teamNumber = max(2, teamNumber - 1);
+		teamNumber = MaxOf(2, teamNumber - 1);
+
+		//the team list shrinks as its members are removed
+		const std::vector<Raven_Bot*>& members = GetTeamMembers(type_bot_red_team + teamNumber);
 
-		if (!m_Bots.empty())
+		while (!members.empty())
 		{
-			for (Raven_Bot *member : GetTeamMembers(type_bot_red_team + teamNumber)) {
-				for (Raven_Bot *pBot : m_Bots) {
-					if (member == pBot) {
-						if (pBot == m_pSelectedBot) m_pSelectedBot = 0;
-						NotifyAllBotsOfRemoval(pBot);
-						delete pBot;
-						m_Bots.remove(pBot);
-
-						break;
-					}
-				}
-			}
+			Raven_Bot* pBot = members.back();
+
+			if (pBot == m_pSelectedBot) m_pSelectedBot = 0;
+			NotifyAllBotsOfRemoval(pBot);
+			RemoveFromRoster(pBot);
+			delete pBot;
 		}
 	}
 }
 void Raven_Game::IncreaseTeamNumber() { 
 	if (teamMode) {
-		teamNumber = min(4, teamNumber + 1);
+		teamNumber = MinOf(4, teamNumber + 1);
 
 		BalanceTeams();
 	}
@@ -18,19 +18,29 @@
 #include <string>
 #include <list>
 
-#include "graph/SparseGraph.h"
+#include "Graph/SparseGraph.h"
 #include "Raven_ObjectEnumerations.h"
-#include "2d/Wall2D.h"
+#include "2D/Wall2D.h"
 #include "misc/utils.h"
-#include "game/EntityFunctionTemplates.h"
+#include "Game/EntityFunctionTemplates.h"
 #include "Raven_Bot.h"
-#include "navigation/pathmanager.h"
+#include "navigation/PathManager.h"
+#include "misc/EntityGrid.h"
+#include "armory/ProjectilePool.h"
+#include "armory/Projectile_Rocket.h"
+#include "armory/Projectile_Pellet.h"
+#include "armory/Projectile_Slug.h"
+#include "armory/Projectile_Bolt.h"
+#include "armory/Projectile_Grenade.h"
+#include "armory/Projectile_Blade_Strike.h"
 
 
 class BaseGameEntity;
 class Raven_Projectile;
 class Raven_Map;
 class GraveMarkers;
+class WorkStealingPool;
+class FrameScheduler;
 
 
 
@@ -41,16 +51,64 @@ private:
   //the current game map
   Raven_Map*                       m_pMap;
  
-  //a list of all the bots that are inhabiting the map
-  std::list<Raven_Bot*>            m_Bots;
+  //all the bots that are inhabiting the map, in the order they were added
+  std::vector<Raven_Bot*>          m_Bots;
+
+  //the bots indexed by slot (see Raven_Bot::Slot). The slot of a removed
+  //bot holds NULL until it is given to a new bot
+  std::vector<Raven_Bot*>          m_BotSlots;
+
+  //the members of each team, in the order they were added. Team t is
+  //m_TeamMembers[t - type_bot_red_team]
+  enum {MaxTeams = 4};
+
+  std::vector<Raven_Bot*>          m_TeamMembers[MaxTeams];
+
+  //returned for an entity type which is not a team
+  const std::vector<Raven_Bot*>    m_NoTeamMembers;
+
+  //the bots sorted into a grid of cells by position. Rebuilt every update
+  //before the projectiles are moved, it is used for the projectile hit
+  //tests and the explosions
+  EntityGrid<Raven_Bot*>           m_BotGrid;
 
   //the user may select a bot to control manually. This is a pointer to that
   //bot
   Raven_Bot*                       m_pSelectedBot;
   
-  //this list contains any active projectiles (slugs, rockets,
-  //shotgun pellets, etc)
-  std::list<Raven_Projectile*>     m_Projectiles;
+  //the active projectiles (slugs, rockets, shotgun pellets, etc), one pool
+  //per type
+  ProjectilePool<Bolt>               m_Bolts;
+  ProjectilePool<Rocket>             m_Rockets;
+  ProjectilePool<Slug>               m_Slugs;
+  ProjectilePool<Pellet>             m_Pellets;
+  ProjectilePool<Grenade_Projectile> m_Grenades;
+  ProjectilePool<Blade_Strike>       m_BladeStrikes;
+
+  //a noise made by a bot (a gunshot) during the current update-step
+  struct Noise
+  {
+    Raven_Bot* pSource;
+
+    //where the noise was made and how far it can be heard
+    Vector2D   vPos;
+    double     dRange;
+  };
+
+  //the noises made this update-step. They are all heard at the end of the
+  //update-step by the bots in range
+  std::vector<Noise>               m_Noises;
+
+  //the bots alive at the start of the current update-step, in roster order
+  std::vector<Raven_Bot*>          m_ThinkingBots;
+
+  //when set, the bots think in parallel on the threads of this pool
+  WorkStealingPool*                m_pThinkPool;
+
+  //when set, this decides which of the think tasks of each bot are run
+  //each update-step, in place of the bots' own regulators. The clients are
+  //the bot slots
+  FrameScheduler*                  m_pThinkScheduler;
 
   //this class manages all the path planning requests
   PathManager<Raven_PathPlanner>*  m_pPathManager;
@@ -73,6 +131,16 @@ private:
   //this iterates through each trigger, testing each one against each bot
   void  UpdateTriggers();
 
+  //updates the projectiles of each type in turn, recycling the dead ones
+  void  UpdateProjectiles();
+
+  //calls Think on each of m_ThinkingBots, in parallel if there is a pool
+  void  ThinkBots();
+
+  //tells every bot in range of a noise made this update-step who made it,
+  //then empties the noise buffer
+  void  PropagateNoises();
+
   //deletes all entities, empties all containers and creates a new navgraph 
   void  Clear();
 
@@ -86,6 +154,13 @@ private:
   void NotifyAllBotsOfRemoval(Raven_Bot* pRemovedBot)const;
 
   void BalanceTeams();
+
+  //adds the bot to the roster, its team and gives it the lowest free slot
+  void AddToRoster(Raven_Bot* pBot);
+
+  //takes the bot out of the roster and its team and frees its slot. The
+  //bot is not deleted
+  void RemoveFromRoster(Raven_Bot* pBot);
   
 public:
   
@@ -96,6 +171,16 @@ public:
   void Render();
   void Update();
 
+  //the bots will do their decision making on the threads of the given pool
+  //(NULL to go back to doing it on the calling thread). The results are
+  //the same whatever the number of threads. The pool must not be used for
+  //anything else while the game is updated
+  void SetThinkPool(WorkStealingPool* pool){m_pThinkPool = pool;}
+
+  //NULL when the bots use their own regulators (see AI_UseScheduler in
+  //Params.lua)
+  FrameScheduler* const GetThinkScheduler(){return m_pThinkScheduler;}
+
   //loads an environment from a file
   bool LoadMap(const std::string& FileName); 
 
@@ -107,6 +192,10 @@ public:
   void AddBolt(Raven_Bot* shooter, Vector2D target);
   void AddBladeStrike(Raven_Bot *swordsman, Vector2D target);
 
+  //records a noise (a gunshot) made by pSource which can be heard by the
+  //bots closer than range
+  void AddNoise(Raven_Bot* pSource, double range);
+
   //removes the last bot to be added
   void RemoveBot();
 
@@ -139,6 +228,15 @@ public:
   //method returns NULL
   Raven_Bot*  GetBotAtPosition(Vector2D CursorPos)const;
 
+  //returns the bot with the given ID or NULL if there is no such bot
+  Raven_Bot*  GetBotFromID(int id)const;
+
+  //returns the bot in the given slot or NULL if the slot is free
+  Raven_Bot*  GetBotFromSlot(int slot)const{return m_BotSlots[slot];}
+
+  //one more than the highest slot given to a bot
+  int         GetNumBotSlots()const{return (int)m_BotSlots.size();}
+
 
   void        TogglePause(){m_bPaused = !m_bPaused;}
   
@@ -146,11 +244,11 @@ public:
   //The method checks to see if a bot is beneath the cursor. If so, the bot
   //is recorded as selected.If the cursor is not over a bot then any selected
   // bot/s will attempt to move to that position.
-  void        ClickRightMouseButton(POINTS p);
+  void        ClickRightMouseButton(Vector2D p);
 
   //this method is called when the user clicks the left mouse button. If there
   //is a possessed bot, this fires the weapon, else does nothing
-  void        ClickLeftMouseButton(POINTS p);
+  void        ClickLeftMouseButton(Vector2D p);
 
   //when called will release any possessed bot from user control
   void        ExorciseAnyPossessedBot();
@@ -164,11 +262,12 @@ public:
   
   const Raven_Map* const                   GetMap()const{return m_pMap;}
   Raven_Map* const                         GetMap(){return m_pMap;}
-  const std::list<Raven_Bot*>&             GetAllBots()const{return m_Bots;}
+  const std::vector<Raven_Bot*>&           GetAllBots()const{return m_Bots;}
+  EntityGrid<Raven_Bot*>&                  GetBotGrid(){return m_BotGrid;}
   PathManager<Raven_PathPlanner>* const    GetPathManager(){return m_pPathManager;}
   int                                      GetNumBots()const{return m_Bots.size();}
 
-  void Raven_Game::Movement(Vector2D direction);
+  void Movement(Vector2D direction);
 
   void  TagRaven_BotsWithinViewRange(BaseGameEntity* pRaven_Bot, double range)
               {TagNeighbors(pRaven_Bot, m_Bots, range);}  
@@ -189,7 +288,9 @@ public:
 	  return nextTeam;
   }
 
-  std::vector<Raven_Bot*> GetTeamMembers(int entity_type);
+  //the bots of the team (given by its entity type) in the order they were
+  //added
+  const std::vector<Raven_Bot*>& GetTeamMembers(int entity_type)const;
 };
 
 
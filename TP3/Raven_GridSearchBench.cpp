@@ -0,0 +1,196 @@
+//------------------------------------------------------------------------
+//
+//  Name:   Raven_GridSearchBench.cpp
+//
+//  Desc:   command line tool comparing jump point search (see
+//          GridJumpPointSearch.h) with A* on grids made by
+//          GraphHelper_CreateGrid.
+//
+//          for each wall density it makes a GridSize x GridSize grid,
+//          removes that share of its cells at random, and runs both
+//          searches between NumSearches pairs of cells. It reports the
+//          microseconds and the nodes expanded a search takes, and checks
+//          that GraphHelper_FindGridLayout finds the grid's layout, which
+//          jump point search is then told, and that it finds a path
+//          whenever A* does, that the path costs the same and that it only
+//          follows edges of the graph.
+//
+//          the exit code is 2 when the searches disagree.
+//
+//          usage: raven_gridsearchbench [GridSize] [NumSearches]
+//
+//          GridSize defaults to 128 and NumSearches to 200.
+//
+//------------------------------------------------------------------------
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include "misc/utils.h"
+#include "Graph/SparseGraph.h"
+#include "Graph/GraphNodeTypes.h"
+#include "Graph/GraphEdgeTypes.h"
+#include "Graph/HandyGraphFunctions.h"
+#include "Graph/GridJumpPointSearch.h"
+
+
+typedef std::chrono::steady_clock clock_type;
+
+typedef SparseGraph<NavGraphNode<>, NavGraphEdge> GridGraph;
+
+
+//------------------------------- PathCost ------------------------------------
+//
+//  the cost of following the path along the graph's edges, or -1 if two
+//  nodes following each other are not joined
+//-----------------------------------------------------------------------------
+static double PathCost(const GridGraph& G, const std::list<int>& path)
+{
+  double cost = 0;
+
+  std::list<int>::const_iterator from = path.begin();
+
+  for (std::list<int>::const_iterator to=from; ++to != path.end(); from=to)
+  {
+    if (!G.isEdgePresent(*from, *to)) return -1;
+
+    cost += G.GetEdge(*from, *to).Cost();
+  }
+
+  return cost;
+}
+
+//------------------------------ CompareSearches ------------------------------
+//
+//  runs both searches between the pairs of cells and reports the time and
+//  expansions a search takes. Returns false if they disagree
+//-----------------------------------------------------------------------------
+static bool CompareSearches(GridGraph&                              grid,
+                            const GridLayout&                       layout,
+                            const std::vector<std::pair<int, int> >& pairs)
+{
+  double AStarTime = 0, JPSTime = 0;
+  long   AStarExpanded = 0, JPSExpanded = 0;
+
+  bool bSame = true;
+  int  NumPaths = 0;
+
+  for (unsigned int p=0; p<pairs.size(); ++p)
+  {
+    const int source = pairs[p].first;
+    const int target = pairs[p].second;
+
+    clock_type::time_point start = clock_type::now();
+
+    Graph_SearchAStar<GridGraph, Heuristic_Euclid> AStar(grid, source, target);
+
+    AStarTime += std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+
+    start = clock_type::now();
+
+    Graph_SearchJPS<GridGraph> JPS(grid, layout, source, target);
+
+    JPSTime += std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+
+    //A* adds an edge to its tree for each node it expands but the source
+    std::vector<const GridGraph::EdgeType*> spt = AStar.GetSPT();
+
+    for (unsigned int nd=0; nd<spt.size(); ++nd)
+    {
+      if (spt[nd]) ++AStarExpanded;
+    }
+
+    ++AStarExpanded;
+
+    JPSExpanded += JPS.NumNodesExpanded();
+
+    std::list<int> AStarPath = AStar.GetPathToTarget();
+    std::list<int> JPSPath   = JPS.GetPathToTarget();
+
+    if (AStarPath.empty() != JPSPath.empty()) {bSame = false; continue;}
+
+    if (JPSPath.empty()) continue;
+
+    ++NumPaths;
+
+    if (fabs(AStar.GetCostToTarget() - JPS.GetCostToTarget()) > 1e-6 ||
+        fabs(PathCost(grid, JPSPath) - JPS.GetCostToTarget()) > 1e-6 ||
+        JPSPath.front() != source)
+    {
+      bSame = false;
+    }
+  }
+
+  const int n = (int)pairs.size();
+
+  std::cout << "  " << NumPaths << " of " << n << " pairs joined" << std::endl
+            << "  A*:  " << AStarTime / n << "us per search, "
+            << AStarExpanded / n << " nodes expanded" << std::endl
+            << "  JPS: " << JPSTime / n << "us per search, "
+            << JPSExpanded / n << " nodes expanded"
+            << (bSame ? "" : ", SEARCHES DISAGREE") << std::endl;
+
+  return bSame;
+}
+
+
+int main(int argc, char* argv[])
+{
+  const int GridSize    = argc > 1 ? atoi(argv[1]) : 128;
+  const int NumSearches = argc > 2 ? atoi(argv[2]) : 200;
+
+  const int densities[] = {0, 10, 25};
+
+  bool bOk = true;
+
+  for (unsigned int d=0; d<sizeof(densities)/sizeof(densities[0]); ++d)
+  {
+    GridGraph grid(false);
+
+    GraphHelper_CreateGrid(grid, GridSize*10, GridSize*10, GridSize, GridSize);
+
+    srand(1);
+
+    for (int nd=0; nd<grid.NumNodes(); ++nd)
+    {
+      if (RandInt(0, 99) < densities[d]) grid.RemoveNode(nd);
+    }
+
+    //pairs of cells which are not walls
+    std::vector<std::pair<int, int> > pairs;
+
+    while ((int)pairs.size() < NumSearches)
+    {
+      const int source = RandInt(0, grid.NumNodes()-1);
+      const int target = RandInt(0, grid.NumNodes()-1);
+
+      if (grid.isNodePresent(source) && grid.isNodePresent(target))
+      {
+        pairs.push_back(std::make_pair(source, target));
+      }
+    }
+
+    std::cout << GridSize << "x" << GridSize << " grid, "
+              << densities[d] << "% walls:" << std::endl;
+
+    //the layout is found once per grid, and the searches told it
+    GridLayout layout;
+
+    clock_type::time_point start = clock_type::now();
+
+    const bool bGrid = GraphHelper_FindGridLayout(grid, layout);
+
+    std::cout << "  layout " << (bGrid ? "found" : "NOT FOUND") << " in "
+              << std::chrono::duration<double, std::micro>(clock_type::now() - start).count()
+              << "us" << std::endl;
+
+    if (!bGrid) {bOk = false; continue;}
+
+    bOk &= CompareSearches(grid, layout, pairs);
+  }
+
+  return bOk ? 0 : 2;
+}
@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------
+//
+//  Name:   Raven_Headless.cpp
+//
+//  Desc:   command line entry point of the headless build. Loads a map,
+//          adds bots until there are NumBots of them and updates the game
+//          NumTicks times as fast as the machine allows. The game clock is
+//          put in fixed step mode so each tick represents 1/FrameRate of a
+//          second whatever the real speed of the simulation.
+//
+//          usage: raven_headless <map> <NumBots> <NumTicks> [seed] [threads]
+//
+//          with threads > 1 the bots do their thinking on that many
+//          threads. The game plays out the same whatever the number.
+//
+//          the median, 99th percentile and longest update times and the
+//          path manager's statistics are reported at the end. See
+//          AI_UseScheduler and AI_FrameBudget in Params.lua for the
+//          scheduling of the bots' thinking.
+//
+//          must be run from the directory holding Params.lua
+//
+//------------------------------------------------------------------------
+#include <cstdlib>
+#include <ctime>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+#include "constants.h"
+#include "Raven_Game.h"
+#include "Raven_Bot.h"
+#include "navigation/Raven_PathPlanner.h"
+#include "Time/CrudeTimer.h"
+#include "Time/FrameScheduler.h"
+#include "misc/WorkStealingPool.h"
+
+
+int main(int argc, char* argv[])
+{
+  if (argc < 4)
+  {
+    std::cerr << "usage: " << argv[0] << " <map> <NumBots> <NumTicks> [seed] [threads]" << std::endl;
+
+    return 1;
+  }
+
+  const std::string map   = argv[1];
+  const int NumBots       = atoi(argv[2]);
+  const int NumTicks      = atoi(argv[3]);
+  const unsigned int seed = argc > 4 ? (unsigned int)atoi(argv[4]) : (unsigned int)time(NULL);
+  const int NumThreads    = argc > 5 ? atoi(argv[5]) : 1;
+
+  srand(seed);
+
+  Clock->UseFixedStep(1.0 / FrameRate);
+
+  try
+  {
+    Raven_Game game;
+
+    if (!game.LoadMap(map)) return 1;
+
+    std::unique_ptr<WorkStealingPool> pool;
+
+    if (NumThreads > 1)
+    {
+      pool.reset(new WorkStealingPool(NumThreads));
+
+      game.SetThinkPool(pool.get());
+    }
+
+    if (game.GetNumBots() < NumBots)
+    {
+      for (int i=game.GetNumBots(); i<NumBots; ++i)
+      {
+        game.AddBots(1, game.GetNextTeam());
+      }
+    }
+
+    typedef std::chrono::steady_clock clock;
+
+    //the time each update took, in microseconds
+    std::vector<double> FrameTimes;
+
+    FrameTimes.reserve(NumTicks);
+
+    int NumDeferred = 0;
+
+    clock::time_point start = clock::now();
+
+    for (int tick=0; tick<NumTicks; ++tick)
+    {
+      clock::time_point FrameStart = clock::now();
+
+      game.Update();
+
+      FrameTimes.push_back(std::chrono::duration<double, std::micro>(clock::now() - FrameStart).count());
+
+      if (game.GetThinkScheduler()) NumDeferred += game.GetThinkScheduler()->NumDeferred();
+    }
+
+    double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    std::cout << map << ": " << game.GetNumBots() << " bots, " << NumTicks << " ticks in "
+              << seconds << "s (" << (seconds > 0 ? NumTicks / seconds : 0) << " ticks per second)"
+              << std::endl;
+
+    if (!FrameTimes.empty())
+    {
+      std::sort(FrameTimes.begin(), FrameTimes.end());
+
+      const int n = (int)FrameTimes.size();
+
+      std::cout << "frame time: p50 " << FrameTimes[n / 2] << "us, p99 "
+                << FrameTimes[MinOf(n - 1, n * 99 / 100)] << "us, max "
+                << FrameTimes[n - 1] << "us";
+
+      if (game.GetThinkScheduler())
+      {
+        std::cout << " (think tasks scheduled, " << NumDeferred << " put off)";
+      }
+
+      std::cout << std::endl;
+    }
+
+    const PathManager<Raven_PathPlanner>::Statistics& stats = game.GetPathManager()->GetStats();
+
+    std::cout << "path searches: " << stats.NumSearches << " (" << stats.NumFailed << " failed), "
+              << stats.NumNodesExpanded << " nodes expanded in " << stats.NumCycles
+              << " cycles, longest " << stats.MostCycles << " cycles" << std::endl;
+
+    std::vector<Raven_Bot*>::const_iterator curBot = game.GetAllBots().begin();
+    for (curBot; curBot != game.GetAllBots().end(); ++curBot)
+    {
+      std::cout << "bot " << (*curBot)->ID() << ": " << (*curBot)->Score() << " kills" << std::endl;
+    }
+  }
+
+  catch (const std::runtime_error& err)
+  {
+    std::cerr << err.what() << std::endl;
+
+    return 1;
+  }
+
+  return 0;
+}
@@ -1,23 +1,24 @@
 #include "Raven_Map.h"
 #include "Raven_ObjectEnumerations.h"
 #include "misc/Cgdi.h"
+#include "misc/WindowUtils.h"
 #include "Graph/HandyGraphFunctions.h"
+#include "2D/WallIntersectionTests.h"
 #include "Raven_Door.h"
-#include "game/EntityManager.h"
+#include "Game/EntityManager.h"
 #include "constants.h"
 #include "lua/Raven_Scriptor.h"
 
 #include "triggers/Trigger_HealthGiver.h"
 #include "triggers/Trigger_WeaponGiver.h"
 #include "triggers/Trigger_OnButtonSendMsg.h"
-#include "triggers/Trigger_SoundNotify.h"
 
 #include "Raven_UserOptions.h"
 
 
 //uncomment to write object creation/deletion to debug console
 #define  LOG_CREATIONAL_STUFF
-#include "debug/DebugConsole.h"
+#include "Debug/DebugConsole.h"
 
 
 //----------------------------- ctor ------------------------------------------
@@ -26,7 +27,8 @@ Raven_Map::Raven_Map():m_pNavGraph(NULL),
                        m_pSpacePartition(NULL),
                        m_iSizeY(0),
                        m_iSizeX(0),
-                       m_dCellSpaceNeighborhoodRange(0)
+                       m_dCellSpaceNeighborhoodRange(0),
+                       m_iWallEpoch(0)
 {
 }
 //------------------------------ dtor -----------------------------------------
@@ -46,6 +48,16 @@ void Raven_Map::Clear()
   //delete the triggers
   m_TriggerSystem.Clear();
 
+  m_GiverTables.clear();
+
+  std::map<int, ItemFieldRecord>::iterator curField;
+  for (curField = m_ItemFields.begin(); curField != m_ItemFields.end(); ++curField)
+  {
+    delete curField->second.pField;
+  }
+
+  m_ItemFields.clear();
+
   //delete the doors
   std::vector<Raven_Door*>::iterator curDoor = m_Doors.begin();
   for (curDoor; curDoor != m_Doors.end(); ++curDoor)
@@ -77,6 +89,8 @@ void Raven_Map::Clear()
 void Raven_Map::AddWall(std::ifstream& in)
 {
   m_Walls.push_back(new Wall2D(in));
+
+  WallsMoved();
 }
 
 Wall2D* Raven_Map::AddWall(Vector2D from, Vector2D to)
@@ -85,6 +99,8 @@ Wall2D* Raven_Map::AddWall(Vector2D from, Vector2D to)
 
   m_Walls.push_back(w);
 
+  WallsMoved();
+
   return w;
 }
 
@@ -227,6 +243,13 @@ bool Raven_Map::LoadMap(const std::string& filename)
   //load in the map size and adjust the client window accordingly
   in >> m_iSizeX >> m_iSizeY;
 
+  //the triggers are sorted into cells so a bot is only tried against the
+  //triggers near it
+  m_TriggerSystem.Partition(m_iSizeX,
+                            m_iSizeY,
+                            script->Params().NumCellsX,
+                            script->Params().NumCellsY);
+
 #ifdef LOG_CREATIONAL_STUFF
     debug_con << "Partitioning navgraph nodes..." << "";
 #endif
@@ -235,6 +258,7 @@ bool Raven_Map::LoadMap(const std::string& filename)
   PartitionNavGraph();
 
 
+#ifndef HEADLESS
   //get the handle to the game window and resize the client area to accommodate
   //the map
   extern char* g_szApplicationName;
@@ -242,6 +266,7 @@ bool Raven_Map::LoadMap(const std::string& filename)
   HWND hwnd = FindWindow(g_szWindowClassName, g_szApplicationName);
   const int ExtraHeightRqdToDisplayInfo = 50;
   ResizeWindow(hwnd, m_iSizeX, m_iSizeY+ExtraHeightRqdToDisplayInfo);
+#endif
 
 #ifdef LOG_CREATIONAL_STUFF
     debug_con << "Loading map..." << "";
@@ -313,9 +338,29 @@ bool Raven_Map::LoadMap(const std::string& filename)
     debug_con << filename << " loaded okay" << "";
 #endif
 
+  //the doors are shut now and only shrink as they open, so the clearances
+  //found with them shut hold while they move
+  CalculateEdgeClearances();
+
    //calculate the cost lookup table
   m_PathCosts = CreateAllPairsCostsTable(*m_pNavGraph);
 
+  CreateGiverTables();
+
+  //the tables above hold the costs with every door open. The doors start
+  //shut, which the item fields and the path planners go by
+  std::vector<Raven_Door*>::iterator curDoor;
+  for (curDoor = m_Doors.begin(); curDoor != m_Doors.end(); ++curDoor)
+  {
+    (*curDoor)->SetEdgeCosts(false);
+  }
+
+  CreateItemFields();
+
+  //nothing has been planned yet so there is no one to tell of the doors'
+  //costs
+  ClearChangedEdges();
+
   return true;
 }
 
@@ -323,6 +368,23 @@ bool Raven_Map::LoadMap(const std::string& filename)
 
 
 
+//------------------------------- SetEdgeCost ---------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Map::SetEdgeCost(int from, int to, double cost)
+{
+  m_pNavGraph->SetEdgeCost(from, to, cost);
+  m_pNavGraph->SetEdgeCost(to, from, cost);
+
+  std::map<int, ItemFieldRecord>::iterator curField;
+  for (curField = m_ItemFields.begin(); curField != m_ItemFields.end(); ++curField)
+  {
+    curField->second.pField->EdgeCostChanged(from, to);
+    curField->second.pField->EdgeCostChanged(to, from);
+  }
+
+  m_ChangedEdges.push_back(std::make_pair(from, to));
+}
+
 //------------- CalculateCostToTravelBetweenNodes -----------------------------
 //
 //  Uses the pre-calculated lookup table to determine the cost of traveling
@@ -338,6 +400,229 @@ Raven_Map::CalculateCostToTravelBetweenNodes(int nd1, int nd2)const
   return m_PathCosts[nd1][nd2];
 }
 
+//---------------------------- CalculateClearance -----------------------------
+//-----------------------------------------------------------------------------
+double Raven_Map::CalculateClearance(Vector2D from, Vector2D to)const
+{
+  return DistanceToWalls(from, to, m_Walls);
+}
+
+//------------------------- CalculateEdgeClearances ---------------------------
+//-----------------------------------------------------------------------------
+void Raven_Map::CalculateEdgeClearances()
+{
+  for (int nd=0; nd<m_pNavGraph->NumNodes(); ++nd)
+  {
+    if (!m_pNavGraph->isNodePresent(nd)) continue;
+
+    NavGraph::EdgeIterator EdgeItr(*m_pNavGraph, nd);
+    for (NavGraph::EdgeType* pE=EdgeItr.begin(); !EdgeItr.end(); pE=EdgeItr.next())
+    {
+      pE->SetClearance(CalculateClearance(m_pNavGraph->GetNode(pE->From()).Pos(),
+                                          m_pNavGraph->GetNode(pE->To()).Pos()));
+    }
+  }
+}
+
+//---------------------------- CreateGiverTables ------------------------------
+//
+//  sorts the givers of each type by their cost from each graph node
+//-----------------------------------------------------------------------------
+void Raven_Map::CreateGiverTables()
+{
+  m_GiverTables.clear();
+
+  TriggerSystem::TriggerList::const_iterator curTrg;
+  for (curTrg = GetTriggers().begin(); curTrg != GetTriggers().end(); ++curTrg)
+  {
+    if ((*curTrg)->GraphNodeIndex() != invalid_node_index)
+    {
+      m_GiverTables[(*curTrg)->EntityType()].Givers.push_back(*curTrg);
+    }
+  }
+
+  const int NumNodes = m_pNavGraph->NumNodes();
+
+  std::map<int, GiverTable>::iterator curTable;
+  for (curTable = m_GiverTables.begin(); curTable != m_GiverTables.end(); ++curTable)
+  {
+    GiverTable& table = curTable->second;
+
+    const int NumGivers = (int)table.Givers.size();
+
+    table.MembershipEpoch = m_TriggerSystem.GetTypeRecord(curTable->first)->MembershipEpoch;
+
+    table.Order.resize(NumNodes * NumGivers);
+
+    std::vector<std::pair<double, int> > costs(NumGivers);
+
+    for (int nd=0; nd<NumNodes; ++nd)
+    {
+      for (int g=0; g<NumGivers; ++g)
+      {
+        costs[g] = std::make_pair(m_PathCosts[nd][table.Givers[g]->GraphNodeIndex()], g);
+      }
+
+      std::sort(costs.begin(), costs.end());
+
+      for (int g=0; g<NumGivers; ++g)
+      {
+        table.Order[nd*NumGivers + g] = costs[g].second;
+      }
+    }
+  }
+}
+
+//--------------------- CalculateCostToClosestActiveGiver ---------------------
+//
+//  walks the givers nearest first and stops at the first active one. If
+//  givers of the type have been registered or removed since the table was
+//  made every active giver is looked at instead
+//-----------------------------------------------------------------------------
+double
+Raven_Map::CalculateCostToClosestActiveGiver(int nd, int GiverType)const
+{
+  const TriggerSystem::TypeRecord* pRecord = m_TriggerSystem.GetTypeRecord(GiverType);
+
+  if (!pRecord || pRecord->Active.empty()) return -1;
+
+  double ClosestSoFar = MaxDouble;
+
+  std::map<int, GiverTable>::const_iterator table = m_GiverTables.find(GiverType);
+
+  if (table != m_GiverTables.end() &&
+      table->second.MembershipEpoch == pRecord->MembershipEpoch)
+  {
+    const int NumGivers = (int)table->second.Givers.size();
+
+    const int* order = &table->second.Order[nd*NumGivers];
+
+    for (int g=0; g<NumGivers; ++g)
+    {
+      TriggerType* pGiver = table->second.Givers[order[g]];
+
+      if (pGiver->isActive())
+      {
+        ClosestSoFar = CalculateCostToTravelBetweenNodes(nd, pGiver->GraphNodeIndex());
+
+        break;
+      }
+    }
+  }
+
+  else
+  {
+    for (unsigned int g=0; g<pRecord->Active.size(); ++g)
+    {
+      double cost = CalculateCostToTravelBetweenNodes(nd, pRecord->Active[g]->GraphNodeIndex());
+
+      if (cost < ClosestSoFar)
+      {
+        ClosestSoFar = cost;
+      }
+    }
+  }
+
+  //return a negative value if no active giver of the type found
+  if (isEqual(ClosestSoFar, MaxDouble)) return -1;
+
+  return ClosestSoFar;
+}
+
+
+
+
+//---------------------------- CreateItemFields -------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Map::CreateItemFields()
+{
+  std::map<int, GiverTable>::const_iterator curTable;
+  for (curTable = m_GiverTables.begin(); curTable != m_GiverTables.end(); ++curTable)
+  {
+    ItemFieldRecord& record = m_ItemFields[curTable->first];
+
+    record.pField          = new ItemField(*m_pNavGraph);
+    record.ActivityEpoch   = 0;
+    record.MembershipEpoch = 0;
+  }
+
+  UpdateItemFields();
+}
+
+//---------------------------- UpdateItemFields -------------------------------
+//
+//  a field is told only of the givers which have changed since it was last
+//  updated. If givers of the type have been registered or removed it is
+//  made again from the active ones
+//-----------------------------------------------------------------------------
+void Raven_Map::UpdateItemFields()
+{
+  std::map<int, ItemFieldRecord>::iterator curField;
+  for (curField = m_ItemFields.begin(); curField != m_ItemFields.end(); ++curField)
+  {
+    ItemFieldRecord& record = curField->second;
+
+    const TriggerSystem::TypeRecord* pTypeRecord = m_TriggerSystem.GetTypeRecord(curField->first);
+
+    if (!pTypeRecord || record.ActivityEpoch == pTypeRecord->ActivityEpoch) continue;
+
+    const std::vector<TriggerType*>& active = pTypeRecord->Active;
+
+    if (record.MembershipEpoch != pTypeRecord->MembershipEpoch)
+    {
+      record.pField->Clear();
+      record.Sources.clear();
+    }
+
+    //remove the givers which are no longer active
+    for (unsigned int s=0; s<record.Sources.size();)
+    {
+      if (std::find(active.begin(), active.end(), record.Sources[s]) == active.end())
+      {
+        record.pField->RemoveSource(record.Sources[s]->GraphNodeIndex());
+
+        record.Sources[s] = record.Sources.back();
+        record.Sources.pop_back();
+      }
+      else
+      {
+        ++s;
+      }
+    }
+
+    //and add those which have become active
+    for (unsigned int a=0; a<active.size(); ++a)
+    {
+      if (active[a]->GraphNodeIndex() == invalid_node_index) continue;
+
+      if (std::find(record.Sources.begin(), record.Sources.end(), active[a]) == record.Sources.end())
+      {
+        record.pField->AddSource(active[a]->GraphNodeIndex());
+
+        record.Sources.push_back(active[a]);
+      }
+    }
+
+    record.ActivityEpoch   = pTypeRecord->ActivityEpoch;
+    record.MembershipEpoch = pTypeRecord->MembershipEpoch;
+  }
+}
+
+//------------------------------ GetItemField ---------------------------------
+//-----------------------------------------------------------------------------
+const Raven_Map::ItemField* Raven_Map::GetItemField(int GiverType)const
+{
+  std::map<int, ItemFieldRecord>::const_iterator field = m_ItemFields.find(GiverType);
+
+  if (field == m_ItemFields.end()) return NULL;
+
+  const TriggerSystem::TypeRecord* pTypeRecord = m_TriggerSystem.GetTypeRecord(GiverType);
+
+  if (!pTypeRecord || field->second.ActivityEpoch != pTypeRecord->ActivityEpoch) return NULL;
+
+  return field->second.pField;
+}
+
 
 
 
@@ -349,8 +634,8 @@ void Raven_Map::PartitionNavGraph()
 
   m_pSpacePartition = new CellSpacePartition<NavGraph::NodeType*>(m_iSizeX,
                                                                   m_iSizeY,
-                                                                  script->GetInt("NumCellsX"),
-                                                                  script->GetInt("NumCellsY"),
+                                                                  script->Params().NumCellsX,
+                                                                  script->Params().NumCellsY,
                                                                   m_pNavGraph->NumNodes());
 
   //add the graph nodes to the space partition
@@ -361,23 +646,16 @@ void Raven_Map::PartitionNavGraph()
   }   
 }
 
-//---------------------------- AddSoundTrigger --------------------------------
-//
-//  given the bot that has made a sound, this method adds a SoundMade trigger
-//-----------------------------------------------------------------------------
-void Raven_Map::AddSoundTrigger(Raven_Bot* pSoundSource, double range)
-{
-  m_TriggerSystem.Register(new Trigger_SoundNotify(pSoundSource, range));
-}
-
 //----------------------- UpdateTriggerSystem ---------------------------------
 //
 //  givena container of entities in the world this method updates them against
 //  all the triggers
 //-----------------------------------------------------------------------------
-void Raven_Map::UpdateTriggerSystem(std::list<Raven_Bot*>& bots)
+void Raven_Map::UpdateTriggerSystem(std::vector<Raven_Bot*>& bots)
 {
   m_TriggerSystem.Update(bots);
+
+  UpdateItemFields();
 }
 
 //------------------------- GetRandomNodeLocation -----------------------------
@@ -441,4 +719,6 @@ Trigger_WeaponCache *Raven_Map::GetWeaponCache(int teamCache) const {
 			return wc;
 		}
 	}
+
+	return NULL;
 }
@@ -16,15 +16,17 @@
 #include <vector>
 #include <string>
 #include <list>
-#include "graph/SparseGraph.h"
-#include "2d/Wall2D.h"
-#include "triggers/Trigger.h"
+#include <map>
+#include "Graph/SparseGraph.h"
+#include "2D/Wall2D.h"
+#include "Triggers/Trigger.h"
 #include "Raven_Bot.h"
 #include "Graph/GraphEdgeTypes.h"
 #include "Graph/GraphNodeTypes.h"
+#include "Graph/GraphDistanceField.h"
 #include "misc/CellSpacePartition.h"
-#include "triggers/TriggerSystem.h"
-#include "triggers\Trigger_WeaponCache.h"
+#include "Triggers/TriggerSystem.h"
+#include "triggers/Trigger_WeaponCache.h"
 
 class BaseGameEntity;
 class Raven_Door;
@@ -39,13 +41,22 @@ public:
   typedef CellSpacePartition<NavGraph::NodeType*>   CellSpace;
 
   typedef Trigger<Raven_Bot>                        TriggerType;
-  typedef TriggerSystem<TriggerType>                TriggerSystem;
+  typedef ::TriggerSystem<TriggerType>              TriggerSystem;
+
+  typedef GraphDistanceField<NavGraph>              ItemField;
   
 private:
  
   //the walls that comprise the current map's architecture. 
   std::vector<Wall2D*>                m_Walls;
 
+  //incremented each time a wall is added or moved
+  unsigned int                       m_iWallEpoch;
+
+  //the graph edges whose costs have been changed since the path planners
+  //were last told
+  std::vector<std::pair<int, int> >  m_ChangedEdges;
+
   //trigger are objects that define a region of space. When a raven bot
   //enters that area, it 'triggers' an event. That event may be anything
   //from increasing a bot's health to opening a door or requesting a lift.
@@ -73,10 +84,51 @@ private:
   
   void  PartitionNavGraph();
 
+  //tells each navgraph edge its distance to the nearest wall
+  void  CalculateEdgeClearances();
+
   //this will hold a pre-calculated lookup table of the cost to travel from
   //one node to any other.
   std::vector<std::vector<double> >  m_PathCosts;
 
+  //the givers of a type of item and, for each graph node, the order of
+  //the givers by the cost of travelling to them from the node. The givers
+  //node n sees are Givers[Order[n*Givers.size() + i]], nearest first. It
+  //holds for the givers registered when the table was made, as told by
+  //MembershipEpoch
+  struct GiverTable
+  {
+    std::vector<TriggerType*>  Givers;
+    std::vector<int>           Order;
+    unsigned int               MembershipEpoch;
+  };
+
+  //by type of item, for the types of trigger twinned with a graph node
+  std::map<int, GiverTable>          m_GiverTables;
+
+  void  CreateGiverTables();
+
+  //the cost from each graph node to the nearest active giver of a type of
+  //item, and the way there. Sources holds the givers the field was last
+  //given, which are the active ones as long as ActivityEpoch is the
+  //activity epoch of the type
+  struct ItemFieldRecord
+  {
+    ItemField*                 pField;
+    std::vector<TriggerType*>  Sources;
+    unsigned int               ActivityEpoch;
+    unsigned int               MembershipEpoch;
+  };
+
+  //by type of item, for the same types as m_GiverTables
+  std::map<int, ItemFieldRecord>     m_ItemFields;
+
+  void  CreateItemFields();
+
+  //tells each field of the givers activated or deactivated since it was
+  //last updated
+  void  UpdateItemFields();
+
   std::vector<Trigger_WeaponCache *> weaponCaches;
 
 
@@ -105,17 +157,43 @@ public:
   //used by objects such as doors to add walls to the environment)
   Wall2D* AddWall(Vector2D from, Vector2D to);
 
-  void    AddSoundTrigger(Raven_Bot* pSoundSource, double range);
+  //called by the doors when they move their walls. Whatever is worked out
+  //from the walls and kept, such as the node closest to a bot, must then be
+  //worked out again
+  void          WallsMoved(){++m_iWallEpoch;}
+  unsigned int  GetWallEpoch()const{return m_iWallEpoch;}
+
+  //sets the cost of the graph edge between two nodes, both ways. The
+  //item fields are mended at once; the path planners are told by the game
+  //(see GetChangedEdges). The all-pairs cost table and the giver tables are
+  //not made again: they hold the costs with every door open
+  void          SetEdgeCost(int from, int to, double cost);
+
+  const std::vector<std::pair<int, int> >& GetChangedEdges()const{return m_ChangedEdges;}
+  void          ClearChangedEdges(){m_ChangedEdges.clear();}
 
   double   CalculateCostToTravelBetweenNodes(int nd1, int nd2)const;
 
+  //returns the distance from the line segment to the nearest wall, as the
+  //walls are now
+  double   CalculateClearance(Vector2D from, Vector2D to)const;
+
+  //returns the cost of travelling from the node to the closest active
+  //giver of the type, or -1 if none is active
+  double   CalculateCostToClosestActiveGiver(int nd, int GiverType)const;
+
+  //returns the field of the nearest active givers of the type, or NULL if
+  //there is none or it is out of date
+  const ItemField* GetItemField(int GiverType)const;
+
   //returns the position of a graph node selected at random
   Vector2D GetRandomNodeLocation()const;
   
   
-  void  UpdateTriggerSystem(std::list<Raven_Bot*>& bots);
+  void  UpdateTriggerSystem(std::vector<Raven_Bot*>& bots);
 
   const Raven_Map::TriggerSystem::TriggerList&  GetTriggers()const{return m_TriggerSystem.GetTriggers();}
+  unsigned int                       GetTriggerActivityEpoch(int type)const{return m_TriggerSystem.GetActivityEpoch(type);}
   const std::vector<Wall2D*>&        GetWalls()const{return m_Walls;}
   NavGraph&                          GetNavGraph()const{return *m_pNavGraph;}
   std::vector<Raven_Door*>&          GetDoors(){return m_Doors;}
@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------
+//
+//  Name:   Raven_MatchFarm.cpp
+//
+//  Desc:   command line runner which plays a batch of matches on the same
+//          map, spread over every core of the machine. Each match is a
+//          Raven_World of its own so the matches share nothing and run
+//          without any locking.
+//
+//          When every match is over one line per bot and per match is
+//          written to the stats file:
+//
+//            match, bot, kills, shots, hits, accuracy, pickups
+//
+//          where accuracy is hits / shots (the number of projectiles
+//          fired which damaged an opponent)
+//
+//          usage: raven_matchfarm <map> <NumMatches> <NumBots> <NumTicks>
+//                                 <stats.csv> [NumThreads]
+//
+//          must be run from the directory holding Params.lua
+//
+//------------------------------------------------------------------------
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "constants.h"
+#include "Raven_World.h"
+#include "Raven_Game.h"
+#include "Raven_Bot.h"
+#include "Time/CrudeTimer.h"
+#include "misc/WorkStealingPool.h"
+
+
+//the statistics gathered for one bot at the end of a match
+struct BotStats
+{
+  int ID;
+  int Kills;
+  int Shots;
+  int Hits;
+  int Pickups;
+};
+
+struct MatchResult
+{
+  bool                  Played;
+  std::vector<BotStats> Bots;
+
+  MatchResult():Played(false){}
+};
+
+
+//------------------------------- PlayMatch -----------------------------------
+//
+//  creates a world on the calling thread, plays NumTicks updates and
+//  records the statistics of every bot
+//-----------------------------------------------------------------------------
+static void PlayMatch(const std::string& map,
+                      int                NumBots,
+                      int                NumTicks,
+                      MatchResult&       result)
+{
+  Raven_World world;
+
+  Clock->UseFixedStep(1.0 / FrameRate);
+
+  Raven_Game* game = world.Game();
+
+  if (!game->LoadMap(map)) return;
+
+  for (int i=game->GetNumBots(); i<NumBots; ++i)
+  {
+    game->AddBots(1, game->GetNextTeam());
+  }
+
+  for (int tick=0; tick<NumTicks; ++tick)
+  {
+    game->Update();
+  }
+
+  std::vector<Raven_Bot*>::const_iterator curBot = game->GetAllBots().begin();
+  for (curBot; curBot != game->GetAllBots().end(); ++curBot)
+  {
+    BotStats stats;
+
+    stats.ID      = (*curBot)->ID();
+    stats.Kills   = (*curBot)->Score();
+    stats.Shots   = (*curBot)->NumShotsFired();
+    stats.Hits    = (*curBot)->NumHits();
+    stats.Pickups = (*curBot)->NumItemsPickedUp();
+
+    result.Bots.push_back(stats);
+  }
+
+  result.Played = true;
+}
+
+
+int main(int argc, char* argv[])
+{
+  if (argc < 6)
+  {
+    std::cerr << "usage: " << argv[0]
+              << " <map> <NumMatches> <NumBots> <NumTicks> <stats.csv> [NumThreads]" << std::endl;
+
+    return 1;
+  }
+
+  const std::string map        = argv[1];
+  const int         NumMatches = atoi(argv[2]);
+  const int         NumBots    = atoi(argv[3]);
+  const int         NumTicks   = atoi(argv[4]);
+  const std::string StatsFile  = argv[5];
+  const unsigned    NumThreads = argc > 6 ? (unsigned)atoi(argv[6]) : 0;
+
+  std::vector<MatchResult> results(NumMatches);
+
+  typedef std::chrono::steady_clock clock;
+
+  clock::time_point start = clock::now();
+
+  std::atomic<bool> bFailed(false);
+
+  {
+    WorkStealingPool pool(NumThreads);
+
+    pool.ParallelFor(0, NumMatches, 1, [&](int begin, int end)
+    {
+      for (int m=begin; m<end; ++m)
+      {
+        try
+        {
+          PlayMatch(map, NumBots, NumTicks, results[m]);
+        }
+
+        catch (const std::runtime_error& err)
+        {
+          std::cerr << "match " << m << ": " << err.what() << std::endl;
+
+          bFailed = true;
+        }
+      }
+    });
+
+    std::cout << NumMatches << " matches of " << NumTicks << " ticks on "
+              << pool.NumThreads() << " threads";
+  }
+
+  double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+  std::cout << " in " << seconds << "s ("
+            << (seconds > 0 ? (double)NumMatches * NumTicks / seconds : 0)
+            << " ticks per second)" << std::endl;
+
+  std::ofstream out(StatsFile.c_str());
+
+  if (!out)
+  {
+    std::cerr << "cannot write " << StatsFile << std::endl;
+
+    return 1;
+  }
+
+  out << "match,bot,kills,shots,hits,accuracy,pickups\n";
+
+  for (int m=0; m<NumMatches; ++m)
+  {
+    if (!results[m].Played) bFailed = true;
+
+    for (unsigned int b=0; b<results[m].Bots.size(); ++b)
+    {
+      const BotStats& s = results[m].Bots[b];
+
+      out << m << ',' << s.ID << ',' << s.Kills << ',' << s.Shots << ',' << s.Hits << ','
+          << (s.Shots > 0 ? (double)s.Hits / s.Shots : 0.0) << ',' << s.Pickups << '\n';
+    }
+  }
+
+  return bFailed ? 1 : 0;
+}
@@ -0,0 +1,344 @@
+//------------------------------------------------------------------------
+//
+//  Name:   Raven_QueueBench.cpp
+//
+//  Desc:   command line tool timing the heap policies of
+//          IndexedPriorityQLow (see PriorityQueue.h).
+//
+//          it first times each queue alone: NumItems items with random
+//          whole number keys are inserted, each has its key lowered once
+//          and they are all popped, and the nanoseconds an insert, a
+//          ChangePriority and a Pop take are reported.
+//
+//          then it times Dijkstra's algorithm run to the end from
+//          NumSearches nodes spread over two graphs: the navgraph of the
+//          map, and a GridSize x GridSize grid made by GraphHelper_CreateGrid
+//          with its costs rounded to whole numbers, which the radix heap
+//          can be used with. For each it reports the microseconds a search
+//          takes and how many of each operation it does, and checks that
+//          every queue finds the same costs as the binary heap.
+//
+//          the exit code is 2 when a queue finds different costs.
+//
+//          usage: raven_queuebench [map] [NumSearches] [GridSize] [NumItems]
+//
+//          the map defaults to maps/Raven_DM1.map, NumSearches to 200,
+//          GridSize to 128 and NumItems to 100000.
+//
+//          must be run from the directory holding Params.lua
+//
+//------------------------------------------------------------------------
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Raven_Game.h"
+#include "Raven_Map.h"
+#include "misc/PriorityQueue.h"
+#include "misc/utils.h"
+#include "Graph/HandyGraphFunctions.h"
+
+
+typedef std::chrono::steady_clock clock_type;
+
+typedef SparseGraph<NavGraphNode<>, NavGraphEdge> GridGraph;
+
+
+//how many of each operation a search made
+struct OpCounts
+{
+  int Inserts;
+  int Pops;
+  int Changes;
+};
+
+
+//------------------------------- TimeQueue -----------------------------------
+//
+//  the average nanoseconds an insert, a ChangePriority and a Pop take over
+//  NumItems items. Returns false if the items do not come out in order
+//-----------------------------------------------------------------------------
+template <class queue_type>
+static bool TimeQueue(int     NumItems,
+                      double& InsertTime,
+                      double& ChangeTime,
+                      double& PopTime)
+{
+  std::vector<double> keys(NumItems);
+  std::vector<double> lowered(NumItems);
+
+  srand(1);
+
+  for (int i=0; i<NumItems; ++i)
+  {
+    keys[i]    = RandInt(0, 1000000);
+    lowered[i] = keys[i] - RandInt(0, (int)keys[i]);
+  }
+
+  queue_type pq(keys, NumItems);
+
+  clock_type::time_point start = clock_type::now();
+
+  for (int i=0; i<NumItems; ++i) pq.insert(i);
+
+  InsertTime = std::chrono::duration<double, std::nano>(clock_type::now() - start).count() / NumItems;
+
+  start = clock_type::now();
+
+  for (int i=0; i<NumItems; ++i)
+  {
+    keys[i] = lowered[i];
+
+    pq.ChangePriority(i);
+  }
+
+  ChangeTime = std::chrono::duration<double, std::nano>(clock_type::now() - start).count() / NumItems;
+
+  bool   bInOrder = true;
+  double last     = -1;
+
+  start = clock_type::now();
+
+  while (!pq.empty())
+  {
+    int i = pq.Pop();
+
+    if (keys[i] < last) bInOrder = false;
+
+    last = keys[i];
+  }
+
+  PopTime = std::chrono::duration<double, std::nano>(clock_type::now() - start).count() / NumItems;
+
+  return bInOrder;
+}
+
+//------------------------------- Dijkstra ------------------------------------
+//
+//  the cost of the way from the source to every node, MaxDouble for the
+//  nodes which cannot be reached
+//-----------------------------------------------------------------------------
+template <class queue_type, class graph_type>
+static void Dijkstra(const graph_type&    G,
+                     int                  source,
+                     std::vector<double>& costs,
+                     std::vector<char>&   bSettled,
+                     OpCounts&            ops)
+{
+  costs.assign(G.NumNodes(), MaxDouble);
+  bSettled.assign(G.NumNodes(), false);
+
+  queue_type pq(costs, G.NumNodes());
+
+  costs[source] = 0;
+
+  pq.insert(source);
+
+  ++ops.Inserts;
+
+  while (!pq.empty())
+  {
+    int nd = pq.Pop();
+
+    ++ops.Pops;
+
+    bSettled[nd] = true;
+
+    typename graph_type::ConstEdgeIterator EdgeItr(G, nd);
+    for (const typename graph_type::EdgeType* pE=EdgeItr.begin();
+         !EdgeItr.end();
+         pE=EdgeItr.next())
+    {
+      if (bSettled[pE->To()]) continue;
+
+      double cost = costs[nd] + pE->Cost();
+
+      if (costs[pE->To()] == MaxDouble)
+      {
+        costs[pE->To()] = cost;
+
+        pq.insert(pE->To());
+
+        ++ops.Inserts;
+      }
+
+      else if (cost < costs[pE->To()])
+      {
+        costs[pE->To()] = cost;
+
+        pq.ChangePriority(pE->To());
+
+        ++ops.Changes;
+      }
+    }
+  }
+}
+
+//------------------------------ TimeSearches ---------------------------------
+//
+//  runs a search from each of the sources and reports the time a search
+//  takes. Returns false if the costs found differ from the ones given
+//-----------------------------------------------------------------------------
+template <class queue_type, class graph_type>
+static bool TimeSearches(const char*                              name,
+                         const graph_type&                        G,
+                         const std::vector<int>&                  sources,
+                         const std::vector<std::vector<double> >& expected)
+{
+  OpCounts ops = {0, 0, 0};
+
+  std::vector<double> costs;
+  std::vector<char>   bSettled;
+
+  double total = 0;
+  bool   bSame = true;
+
+  for (unsigned int s=0; s<sources.size(); ++s)
+  {
+    clock_type::time_point start = clock_type::now();
+
+    Dijkstra<queue_type>(G, sources[s], costs, bSettled, ops);
+
+    total += std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+
+    for (int nd=0; nd<G.NumNodes(); ++nd)
+    {
+      if (fabs(costs[nd] - expected[s][nd]) > 1e-6) bSame = false;
+    }
+  }
+
+  const int n = (int)sources.size();
+
+  std::cout << "  " << name << ": " << total / n << "us per search, "
+            << ops.Inserts / n << " inserts, " << ops.Changes / n << " changes, "
+            << ops.Pops / n << " pops" << (bSame ? "" : ", COSTS DIFFER") << std::endl;
+
+  return bSame;
+}
+
+//----------------------------- ExpectedCosts ---------------------------------
+//-----------------------------------------------------------------------------
+template <class graph_type>
+static std::vector<std::vector<double> > ExpectedCosts(const graph_type&       G,
+                                                       const std::vector<int>& sources)
+{
+  std::vector<std::vector<double> > expected(sources.size());
+
+  std::vector<char> bSettled;
+
+  OpCounts ops = {0, 0, 0};
+
+  for (unsigned int s=0; s<sources.size(); ++s)
+  {
+    Dijkstra<IndexedPriorityQLow<double> >(G, sources[s], expected[s], bSettled, ops);
+  }
+
+  return expected;
+}
+
+//------------------------------- Sources -------------------------------------
+//
+//  NumSearches nodes spread evenly over the graph
+//-----------------------------------------------------------------------------
+static std::vector<int> Sources(int NumNodes, int NumSearches)
+{
+  std::vector<int> sources;
+
+  for (int s=0; s<NumSearches; ++s)
+  {
+    sources.push_back((int)((long long)s * NumNodes / NumSearches));
+  }
+
+  return sources;
+}
+
+
+int main(int argc, char* argv[])
+{
+  const std::string map   = argc > 1 ? argv[1] : "maps/Raven_DM1.map";
+  const int NumSearches   = argc > 2 ? atoi(argv[2]) : 200;
+  const int GridSize      = argc > 3 ? atoi(argv[3]) : 128;
+  const int NumItems      = argc > 4 ? atoi(argv[4]) : 100000;
+
+  try
+  {
+    bool bOk = true;
+
+    std::cout << NumItems << " items, ns per insert / change / pop:" << std::endl;
+
+    struct QueueTime
+    {
+      const char* Name;
+      bool (*Time)(int, double&, double&, double&);
+    } queues[] =
+    {
+      {"binary", &TimeQueue<IndexedPriorityQLow<double, HeapPolicy_Binary> >},
+      {"4-ary",  &TimeQueue<IndexedPriorityQLow<double, HeapPolicy_4ary> >},
+      {"radix",  &TimeQueue<IndexedPriorityQLow<double, HeapPolicy_Radix> >}
+    };
+
+    for (unsigned int q=0; q<sizeof(queues)/sizeof(queues[0]); ++q)
+    {
+      double InsertTime, ChangeTime, PopTime;
+
+      bool bInOrder = queues[q].Time(NumItems, InsertTime, ChangeTime, PopTime);
+
+      std::cout << "  " << queues[q].Name << ": " << InsertTime << " / " << ChangeTime
+                << " / " << PopTime << (bInOrder ? "" : ", OUT OF ORDER") << std::endl;
+
+      if (!bInOrder) bOk = false;
+    }
+
+    //the navgraph of the map
+    Raven_Game game;
+
+    if (!game.LoadMap(map)) return 1;
+
+    const Raven_Map::NavGraph& NavGraph = game.GetMap()->GetNavGraph();
+
+    std::vector<int> sources = Sources(NavGraph.NumNodes(), NumSearches);
+
+    std::vector<std::vector<double> > expected = ExpectedCosts(NavGraph, sources);
+
+    std::cout << map << " navgraph, " << NavGraph.NumNodes() << " nodes:" << std::endl;
+
+    bOk &= TimeSearches<IndexedPriorityQLow<double, HeapPolicy_Binary> >("binary", NavGraph, sources, expected);
+    bOk &= TimeSearches<IndexedPriorityQLow<double, HeapPolicy_4ary> >("4-ary", NavGraph, sources, expected);
+
+    //a grid with whole number costs
+    GridGraph grid(false);
+
+    GraphHelper_CreateGrid(grid, GridSize*10, GridSize*10, GridSize, GridSize);
+
+    for (int nd=0; nd<grid.NumNodes(); ++nd)
+    {
+      GridGraph::EdgeIterator EdgeItr(grid, nd);
+      for (GridGraph::EdgeType* pE=EdgeItr.begin(); !EdgeItr.end(); pE=EdgeItr.next())
+      {
+        pE->SetCost(floor(pE->Cost() + 0.5));
+      }
+    }
+
+    sources  = Sources(grid.NumNodes(), NumSearches);
+    expected = ExpectedCosts(grid, sources);
+
+    std::cout << GridSize << "x" << GridSize << " grid:" << std::endl;
+
+    bOk &= TimeSearches<IndexedPriorityQLow<double, HeapPolicy_Binary> >("binary", grid, sources, expected);
+    bOk &= TimeSearches<IndexedPriorityQLow<double, HeapPolicy_4ary> >("4-ary", grid, sources, expected);
+    bOk &= TimeSearches<IndexedPriorityQLow<double, HeapPolicy_Radix> >("radix", grid, sources, expected);
+
+    return bOk ? 0 : 2;
+  }
+
+  catch (const std::runtime_error& err)
+  {
+    std::cerr << err.what() << std::endl;
+
+    return 1;
+  }
+}
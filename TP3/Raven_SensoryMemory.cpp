@@ -1,7 +1,7 @@
 #include "Raven_SensoryMemory.h"
 #include "Raven_Game.h"
-#include "time/crudetimer.h"
-#include "misc/cgdi.h"
+#include "Time/CrudeTimer.h"
+#include "misc/Cgdi.h"
 #include "misc/Stream_Utility_Functions.h"
 
 //------------------------------- ctor ----------------------------------------
@@ -14,14 +14,44 @@
 
 //--------------------- MakeNewRecordIfNotAlreadyPresent ----------------------
 
-void Raven_SensoryMemory::MakeNewRecordIfNotAlreadyPresent(Raven_Bot* pOpponent)
+MemoryRecord& Raven_SensoryMemory::MakeNewRecordIfNotAlreadyPresent(Raven_Bot* pOpponent)
 {
+  const int slot = pOpponent->Slot();
+
+  //make room for the slots given out since the last call
+  if (slot >= (int)m_Records.size())
+  {
+    m_Records.resize(m_pOwner->GetWorld()->GetNumBotSlots());
+    m_Sensed.resize((m_Records.size() + 31) / 32, 0);
+  }
+
   //else check to see if this Opponent already exists in the memory. If it doesn't,
   //create a new record
-  if (m_MemoryMap.find(pOpponent) == m_MemoryMap.end())
+  if (!isSensed(slot))
   {
-    m_MemoryMap[pOpponent] = MemoryRecord();
+    m_Records[slot] = MemoryRecord();
+    m_Records[slot].pOpponent = pOpponent;
+
+    m_Sensed[slot >> 5] |= 1u << (slot & 31);
   }
+
+  return m_Records[slot];
+}
+
+//------------------------------ GetRecord ------------------------------------
+//-----------------------------------------------------------------------------
+const MemoryRecord* Raven_SensoryMemory::GetRecord(const Raven_Bot* pOpponent)const
+{
+  if (!pOpponent) return NULL;
+
+  const int slot = pOpponent->Slot();
+
+  if (slot < 0 || slot >= (int)m_Records.size() || !isSensed(slot)) return NULL;
+
+  //the slot may have been given to another bot
+  if (m_Records[slot].pOpponent != pOpponent) return NULL;
+
+  return &m_Records[slot];
 }
 
 //------------------------ RemoveBotFromMemory --------------------------------
@@ -30,11 +60,11 @@ void Raven_SensoryMemory::MakeNewRecordIfNotAlreadyPresent(Raven_Bot* pOpponent)
 //-----------------------------------------------------------------------------
 void Raven_SensoryMemory::RemoveBotFromMemory(Raven_Bot* pBot)
 {
-  MemoryMap::iterator record = m_MemoryMap.find(pBot);
-  
-  if (record != m_MemoryMap.end())
+  if (GetRecord(pBot))
   {
-    m_MemoryMap.erase(record);
+    const int slot = pBot->Slot();
+
+    m_Sensed[slot >> 5] &= ~(1u << (slot & 31));
   }
 }
   
@@ -51,9 +81,7 @@ void Raven_SensoryMemory::UpdateWithSoundSource(Raven_Bot* pNoiseMaker)
   {
     //if the bot is already part of the memory then update its data, else
     //create a new memory record and add it to the memory
-    MakeNewRecordIfNotAlreadyPresent(pNoiseMaker);
-
-    MemoryRecord& info = m_MemoryMap[pNoiseMaker];
+    MemoryRecord& info = MakeNewRecordIfNotAlreadyPresent(pNoiseMaker);
 
     //test if there is LOS between bots 
     if (m_pOwner->GetWorld()->isLOSOkay(m_pOwner->Pos(), pNoiseMaker->Pos()))
@@ -83,18 +111,16 @@ void Raven_SensoryMemory::UpdateVision()
 {
   //for each bot in the world test to see if it is visible to the owner of
   //this class
-  const std::list<Raven_Bot*>& bots = m_pOwner->GetWorld()->GetAllBots();
-  std::list<Raven_Bot*>::const_iterator curBot;
+  const std::vector<Raven_Bot*>& bots = m_pOwner->GetWorld()->GetAllBots();
+  std::vector<Raven_Bot*>::const_iterator curBot;
   for (curBot = bots.begin(); curBot!=bots.end(); ++curBot)
   {
     //make sure the bot being examined is not this bot
     if (m_pOwner != *curBot)
     {
-      //make sure it is part of the memory map
-      MakeNewRecordIfNotAlreadyPresent(*curBot);
-
-      //get a reference to this bot's data
-      MemoryRecord& info = m_MemoryMap[*curBot];
+      //make sure it is part of the memory map and get a reference to this
+      //bot's data
+      MemoryRecord& info = MakeNewRecordIfNotAlreadyPresent(*curBot);
 
       //test if there is LOS between bots 
       if (m_pOwner->GetWorld()->isLOSOkay(m_pOwner->Pos(), (*curBot)->Pos()))
@@ -137,32 +163,41 @@ void Raven_SensoryMemory::UpdateVision()
 
 //------------------------ GetListOfRecentlySensedOpponents -------------------
 //
-//  returns a list of the bots that have been sensed recently
+//  returns a list of the bots that have been sensed recently, in slot order
 //-----------------------------------------------------------------------------
-std::list<Raven_Bot*> 
+const std::vector<Raven_Bot*>&
 Raven_SensoryMemory::GetListOfRecentlySensedOpponents()const
 {
   //this will store all the opponents the bot can remember
-  std::list<Raven_Bot*> opponents;
+  m_RecentlySensed.clear();
 
   double CurrentTime = Clock->GetCurrentTime();
 
-  MemoryMap::const_iterator curRecord = m_MemoryMap.begin();
-  for (curRecord; curRecord!=m_MemoryMap.end(); ++curRecord)
+  const bool bTeamMode = m_pOwner->GetWorld()->isTeamMode();
+
+  for (unsigned int w=0; w<m_Sensed.size(); ++w)
   {
-    //if this bot has been updated in the memory recently, add to list
-    if ( (CurrentTime - curRecord->second.fTimeLastSensed) <= m_dMemorySpan)
-	{
-		// Set as oponents 
-		if (!m_pOwner->GetWorld()->isTeamMode() || 
-			(m_pOwner->GetWorld()->isTeamMode() && curRecord->first->EntityType() != m_pOwner->EntityType()) ){
-			opponents.push_back(curRecord->first);
-		}
-   
+    //visit the set bits of this word only
+    for (unsigned int bits = m_Sensed[w]; bits; bits &= bits - 1)
+    {
+      int bit = 0;
+      while (!((bits >> bit) & 1)) ++bit;
+
+      const MemoryRecord& record = m_Records[w*32 + bit];
+
+      //if this bot has been updated in the memory recently, add to list
+      if ( (CurrentTime - record.fTimeLastSensed) <= m_dMemorySpan)
+      {
+        // Set as oponents 
+        if (!bTeamMode || record.pOpponent->EntityType() != m_pOwner->EntityType())
+        {
+          m_RecentlySensed.push_back(record.pOpponent);
+        }
+      }
     }
   }
 
-  return opponents;
+  return m_RecentlySensed;
 }
 
 //----------------------------- isOpponentShootable --------------------------------
@@ -172,14 +207,9 @@ Raven_SensoryMemory::GetListOfRecentlySensedOpponents()const
 //-----------------------------------------------------------------------------
 bool Raven_SensoryMemory::isOpponentShootable(Raven_Bot* pOpponent)const
 {
-  MemoryMap::const_iterator it = m_MemoryMap.find(pOpponent);
- 
-  if (it != m_MemoryMap.end())
-  {
-    return it->second.bShootable;
-  }
+  const MemoryRecord* record = GetRecord(pOpponent);
 
-  return false;
+  return record && record->bShootable;
 }
 
 //----------------------------- isOpponentWithinFOV --------------------------------
@@ -188,14 +218,9 @@ bool Raven_SensoryMemory::isOpponentShootable(Raven_Bot* pOpponent)const
 //-----------------------------------------------------------------------------
 bool  Raven_SensoryMemory::isOpponentWithinFOV(Raven_Bot* pOpponent)const
 {
-  MemoryMap::const_iterator it = m_MemoryMap.find(pOpponent);
- 
-  if (it != m_MemoryMap.end())
-  {
-    return it->second.bWithinFOV;
-  }
+  const MemoryRecord* record = GetRecord(pOpponent);
 
-  return false;
+  return record && record->bWithinFOV;
 }
 
 //---------------------------- GetLastRecordedPositionOfOpponent -------------------
@@ -204,11 +229,11 @@ bool  Raven_SensoryMemory::isOpponentWithinFOV(Raven_Bot* pOpponent)const
 //-----------------------------------------------------------------------------
 Vector2D  Raven_SensoryMemory::GetLastRecordedPositionOfOpponent(Raven_Bot* pOpponent)const
 {
-  MemoryMap::const_iterator it = m_MemoryMap.find(pOpponent);
- 
-  if (it != m_MemoryMap.end())
+  const MemoryRecord* record = GetRecord(pOpponent);
+
+  if (record)
   {
-    return it->second.vLastSensedPosition;
+    return record->vLastSensedPosition;
   }
 
   throw std::runtime_error("< Raven_SensoryMemory::GetLastRecordedPositionOfOpponent>: Attempting to get position of unrecorded bot");
@@ -220,11 +245,11 @@ Vector2D  Raven_SensoryMemory::GetLastRecordedPositionOfOpponent(Raven_Bot* pOpp
 //-----------------------------------------------------------------------------
 double  Raven_SensoryMemory::GetTimeOpponentHasBeenVisible(Raven_Bot* pOpponent)const
 {
-  MemoryMap::const_iterator it = m_MemoryMap.find(pOpponent);
- 
-  if (it != m_MemoryMap.end() && it->second.bWithinFOV)
+  const MemoryRecord* record = GetRecord(pOpponent);
+
+  if (record && record->bWithinFOV)
   {
-    return Clock->GetCurrentTime() - it->second.fTimeBecameVisible;
+    return Clock->GetCurrentTime() - record->fTimeBecameVisible;
   }
 
   return 0;
@@ -237,11 +262,11 @@ double  Raven_SensoryMemory::GetTimeOpponentHasBeenVisible(Raven_Bot* pOpponent)
 //-----------------------------------------------------------------------------
 double Raven_SensoryMemory::GetTimeOpponentHasBeenOutOfView(Raven_Bot* pOpponent)const
 {
-  MemoryMap::const_iterator it = m_MemoryMap.find(pOpponent);
- 
-  if (it != m_MemoryMap.end())
+  const MemoryRecord* record = GetRecord(pOpponent);
+
+  if (record)
   {
-    return Clock->GetCurrentTime() - it->second.fTimeLastVisible;
+    return Clock->GetCurrentTime() - record->fTimeLastVisible;
   }
 
   return MaxDouble;
@@ -253,11 +278,11 @@ double Raven_SensoryMemory::GetTimeOpponentHasBeenOutOfView(Raven_Bot* pOpponent
 //-----------------------------------------------------------------------------
 double  Raven_SensoryMemory::GetTimeSinceLastSensed(Raven_Bot* pOpponent)const
 {
-  MemoryMap::const_iterator it = m_MemoryMap.find(pOpponent);
- 
-  if (it != m_MemoryMap.end() && it->second.bWithinFOV)
+  const MemoryRecord* record = GetRecord(pOpponent);
+
+  if (record && record->bWithinFOV)
   {
-    return Clock->GetCurrentTime() - it->second.fTimeLastSensed;
+    return Clock->GetCurrentTime() - record->fTimeLastSensed;
   }
 
   return 0;
@@ -269,8 +294,8 @@ double  Raven_SensoryMemory::GetTimeSinceLastSensed(Raven_Bot* pOpponent)const
 //-----------------------------------------------------------------------------
 void  Raven_SensoryMemory::RenderBoxesAroundRecentlySensed()const
 {
-  std::list<Raven_Bot*> opponents = GetListOfRecentlySensedOpponents();
-  std::list<Raven_Bot*>::const_iterator it;
+  const std::vector<Raven_Bot*>& opponents = GetListOfRecentlySensedOpponents();
+  std::vector<Raven_Bot*>::const_iterator it;
   for (it = opponents.begin(); it != opponents.end(); ++it)
   {
     gdi->OrangePen();
@@ -10,9 +10,8 @@
 //  Desc:
 //
 //-----------------------------------------------------------------------------
-#include <map>
-#include <list>
-#include "2d/vector2d.h"
+#include <vector>
+#include "2D/Vector2D.h"
 
 class Raven_Bot;
 
@@ -20,6 +19,9 @@ class Raven_Bot;
 class MemoryRecord
 {
 public:
+
+  //the opponent this record is about
+  Raven_Bot*   pOpponent;
   
   //records the time the opponent was last sensed (seen or heard). This
   //is used to determine if a bot can 'remember' this record or not. 
@@ -48,7 +50,8 @@ public:
   bool        bShootable;
   
 
-  MemoryRecord():fTimeLastSensed(-999),
+  MemoryRecord():pOpponent(0),
+            fTimeLastSensed(-999),
             fTimeBecameVisible(-999),
             fTimeLastVisible(0),
             bWithinFOV(false),
@@ -62,17 +65,20 @@ class Raven_SensoryMemory
 {
 private:
 
-  typedef std::map<Raven_Bot*, MemoryRecord> MemoryMap;
-
-private:
-  
   //the owner of this instance
   Raven_Bot* m_pOwner;
 
   //this container is used to simulate memory of sensory events. A MemoryRecord
   //is created for each opponent in the environment. Each record is updated 
   //whenever the opponent is encountered. (when it is seen or heard)
-  MemoryMap  m_MemoryMap;
+  //The records are indexed by the slot of the opponent (see Raven_Bot::Slot)
+  std::vector<MemoryRecord> m_Records;
+
+  //one bit per slot, set when the record of that slot is in use
+  std::vector<unsigned int> m_Sensed;
+
+  //the result of GetListOfRecentlySensedOpponents, kept to reuse its memory
+  mutable std::vector<Raven_Bot*> m_RecentlySensed;
 
   //a bot has a memory span equivalent to this value. When a bot requests a 
   //list of all recently sensed opponents this value is used to determine if 
@@ -81,8 +87,16 @@ private:
 
   //this methods checks to see if there is an existing record for pBot. If
   //not a new MemoryRecord record is made and added to the memory map.(called
-  //by UpdateWithSoundSource & UpdateVision)
-  void       MakeNewRecordIfNotAlreadyPresent(Raven_Bot* pBot);
+  //by UpdateWithSoundSource & UpdateVision). Returns the record
+  MemoryRecord& MakeNewRecordIfNotAlreadyPresent(Raven_Bot* pBot);
+
+  //returns the record of pBot, or NULL if there is none
+  const MemoryRecord* GetRecord(const Raven_Bot* pBot)const;
+
+  bool       isSensed(int slot)const
+  {
+    return (m_Sensed[slot >> 5] >> (slot & 31)) & 1;
+  }
 
 public:
 
@@ -107,8 +121,9 @@ public:
   double    GetTimeOpponentHasBeenOutOfView(Raven_Bot* pOpponent)const;
 
   //this method returns a list of all the opponents that have had their
-  //records updated within the last m_dMemorySpan seconds.
-  std::list<Raven_Bot*> GetListOfRecentlySensedOpponents()const;
+  //records updated within the last m_dMemorySpan seconds. The list is
+  //overwritten by the next call
+  const std::vector<Raven_Bot*>& GetListOfRecentlySensedOpponents()const;
 
   void     RenderBoxesAroundRecentlySensed()const;
 
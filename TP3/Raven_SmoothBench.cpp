@@ -0,0 +1,281 @@
+//------------------------------------------------------------------------
+//
+//  Name:   Raven_SmoothBench.cpp
+//
+//  Desc:   command line tool comparing the two ways a path can be smoothed
+//          precisely (see Bot_SmoothPathsWithFunnel in Params.lua).
+//
+//          it plans paths between NumPaths pairs of navgraph nodes picked
+//          at random and smooths each of them both ways:
+//
+//            traced  - SmoothPathEdgesPrecise, which traces against the
+//                      walls between every pair of edges
+//            funnel  - StringPullPathEdges
+//
+//          for each it reports the microseconds smoothing a path takes,
+//          the traces made, and the edges and length left. It checks that
+//          a bot can walk every edge the funnel makes, and that the funnel
+//          keeps every edge other than a normal one, from the same source
+//          and with the same behavior. Edges the funnel leaves as planned
+//          are not checked: some navgraph edges pass closer to a wall than
+//          a bot's radius already.
+//
+//          the exit code is 2 when a check fails.
+//
+//          usage: raven_smoothbench [map] [NumPaths]
+//
+//          the map defaults to maps/Raven_DM1.map and NumPaths to 1000.
+//
+//          must be run from the directory holding Params.lua
+//
+//------------------------------------------------------------------------
+#include <cstdlib>
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Raven_Game.h"
+#include "Raven_Map.h"
+#include "Raven_Bot.h"
+#include "misc/utils.h"
+#include "navigation/PathEdge.h"
+#include "navigation/PathFunnel.h"
+#include "navigation/TimeSlicedGraphAlgorithms.h"
+
+
+typedef std::chrono::steady_clock clock_type;
+
+typedef std::list<PathEdge> Path;
+
+
+//what smoothing the paths one way came to
+struct SmoothResult
+{
+  double Time;
+  long   Traces;
+  long   Edges;
+  double Length;
+};
+
+
+//---------------------------- SmoothTraced -----------------------------------
+//
+//  the loop of Raven_PathPlanner::SmoothPathEdgesPrecise, counting the
+//  traces it makes
+//-----------------------------------------------------------------------------
+static void SmoothTraced(const Raven_Game& game,
+                         double            BoundingRadius,
+                         Path&             path,
+                         long&             traces)
+{
+  Path::iterator e1 = path.begin();
+
+  while (e1 != path.end())
+  {
+    Path::iterator e2 = e1;
+    ++e2;
+
+    while (e2 != path.end())
+    {
+      if (e2->Behavior() == NavGraphEdge::normal &&
+          (++traces, !game.isPathObstructed(e1->Source(), e2->Destination(), BoundingRadius)))
+      {
+        e1->SetDestination(e2->Destination());
+        e2 = path.erase(++e1, ++e2);
+        e1 = e2;
+        --e1;
+      }
+
+      else
+      {
+        ++e2;
+      }
+    }
+
+    ++e1;
+  }
+}
+
+//-------------------------------- Length -------------------------------------
+//-----------------------------------------------------------------------------
+static double Length(const Path& path)
+{
+  double length = 0;
+
+  for (Path::const_iterator e=path.begin(); e!=path.end(); ++e)
+  {
+    length += Vec2DDistance(e->Source(), e->Destination());
+  }
+
+  return length;
+}
+
+//--------------------------- KeepsSpecialEdges -------------------------------
+//
+//  true if each edge of the smoothed path other than a normal one is one of
+//  the path's, from the same source
+//-----------------------------------------------------------------------------
+static bool KeepsSpecialEdges(const Path& path, const Path& smoothed)
+{
+  Path::const_iterator e = path.begin();
+
+  for (Path::const_iterator s=smoothed.begin(); s!=smoothed.end(); ++s)
+  {
+    if (s->Behavior() == NavGraphEdge::normal) continue;
+
+    while (e != path.end() && e->Behavior() == NavGraphEdge::normal) ++e;
+
+    if (e == path.end() ||
+        e->Behavior() != s->Behavior() ||
+        e->DoorID() != s->DoorID() ||
+        !(e->Source() == s->Source()))
+    {
+      return false;
+    }
+
+    ++e;
+  }
+
+  while (e != path.end() && e->Behavior() == NavGraphEdge::normal) ++e;
+
+  return e == path.end();
+}
+
+
+//------------------------------ isPlannedEdge --------------------------------
+//
+//  returns true if the planned path holds an edge from the same source to
+//  the same destination as the given one
+//-----------------------------------------------------------------------------
+static bool isPlannedEdge(const Path& planned, const PathEdge& edge)
+{
+  for (Path::const_iterator e=planned.begin(); e!=planned.end(); ++e)
+  {
+    if (e->Source() == edge.Source() && e->Destination() == edge.Destination()) return true;
+  }
+
+  return false;
+}
+
+
+int main(int argc, char* argv[])
+{
+  const std::string map = argc > 1 ? argv[1] : "maps/Raven_DM1.map";
+  const int NumPaths    = argc > 2 ? atoi(argv[2]) : 1000;
+
+  try
+  {
+    Raven_Game game;
+
+    if (!game.LoadMap(map)) return 1;
+
+    //a bot to take the size of
+    if (game.GetNumBots() == 0) game.AddBots(1, game.GetNextTeam());
+
+    const double BoundingRadius = game.GetAllBots().front()->BRadius();
+
+    const Raven_Map::NavGraph& G = game.GetMap()->GetNavGraph();
+
+    //the paths between pairs of nodes picked at random
+    std::vector<Path> paths;
+
+    srand(1);
+
+    while ((int)paths.size() < NumPaths)
+    {
+      const int source = RandInt(0, G.NumNodes()-1);
+      const int target = RandInt(0, G.NumNodes()-1);
+
+      if (source == target || !G.isNodePresent(source) || !G.isNodePresent(target)) continue;
+
+      Graph_SearchAStar_TS<Raven_Map::NavGraph, Heuristic_ShavedEuclid> search(G, source, target);
+
+      int result;
+
+      do result = search.CycleOnce(); while (result == search_incomplete);
+
+      if (result == target_found) paths.push_back(search.GetPathAsPathEdges());
+    }
+
+    SmoothResult traced = {0, 0, 0, 0};
+    SmoothResult funnel = {0, 0, 0, 0};
+
+    long   NumEdges = 0;
+    double length   = 0;
+
+    int NumObstructed = 0;
+    int NumMangled    = 0;
+
+    for (unsigned int p=0; p<paths.size(); ++p)
+    {
+      NumEdges += (long)paths[p].size();
+      length   += Length(paths[p]);
+
+      Path path = paths[p];
+
+      clock_type::time_point start = clock_type::now();
+
+      SmoothTraced(game, BoundingRadius, path, traced.Traces);
+
+      traced.Time   += std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+      traced.Edges  += (long)path.size();
+      traced.Length += Length(path);
+
+      path  = paths[p];
+      start = clock_type::now();
+
+      StringPullPathEdges(path, BoundingRadius);
+
+      funnel.Time   += std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+      funnel.Edges  += (long)path.size();
+      funnel.Length += Length(path);
+
+      for (Path::const_iterator e=path.begin(); e!=path.end(); ++e)
+      {
+        if (e->Behavior() == NavGraphEdge::normal &&
+            !isPlannedEdge(paths[p], *e) &&
+            game.isPathObstructed(e->Source(), e->Destination(), BoundingRadius))
+        {
+          ++NumObstructed;
+        }
+      }
+
+      if (!KeepsSpecialEdges(paths[p], path)) ++NumMangled;
+    }
+
+    const double n = (double)paths.size();
+
+    std::cout << map << ", " << paths.size() << " paths of " << NumEdges / n
+              << " edges and length " << length / n << " on average:" << std::endl;
+
+    struct Row
+    {
+      const char*         Name;
+      const SmoothResult* Result;
+    } rows[] = {{"traced", &traced}, {"funnel", &funnel}};
+
+    for (unsigned int r=0; r<sizeof(rows)/sizeof(rows[0]); ++r)
+    {
+      const SmoothResult& res = *rows[r].Result;
+
+      std::cout << "  " << rows[r].Name << ": " << res.Time / n << "us per path, "
+                << res.Traces / n << " traces, " << res.Edges / n << " edges, length "
+                << res.Length / n << std::endl;
+    }
+
+    std::cout << "  " << NumObstructed << " funnel edges obstructed, "
+              << NumMangled << " paths with special edges changed" << std::endl;
+
+    return NumObstructed == 0 && NumMangled == 0 ? 0 : 2;
+  }
+
+  catch (const std::runtime_error& err)
+  {
+    std::cerr << err.what() << std::endl;
+
+    return 1;
+  }
+}
@@ -1,11 +1,11 @@
 #include "Raven_SteeringBehaviors.h"
 #include "Raven_Bot.h"
-#include "2d/Wall2D.h"
-#include "2d/Transformations.h"
+#include "2D/Wall2D.h"
+#include "2D/Transformations.h"
 #include "misc/utils.h"
 #include "misc/Cgdi.h"
 #include "Raven_Game.h"
-#include "2d/geometry.h"
+#include "2D/geometry.h"
 #include "lua/Raven_Scriptor.h"
 #include "Raven_Map.h"
 
@@ -25,11 +25,11 @@ Raven_Steering::Raven_Steering(Raven_Game* world, Raven_Bot* agent):
              m_pWorld(world),
              m_pRaven_Bot(agent),
              m_iFlags(0),
-             m_dWeightSeparation(script->GetDouble("SeparationWeight")),
-             m_dWeightWander(script->GetDouble("WanderWeight")),
-             m_dWeightWallAvoidance(script->GetDouble("WallAvoidanceWeight")),
-             m_dViewDistance(script->GetDouble("ViewDistance")),
-             m_dWallDetectionFeelerLength(script->GetDouble("WallDetectionFeelerLength")),
+             m_dWeightSeparation(script->Params().SeparationWeight),
+             m_dWeightWander(script->Params().WanderWeight),
+             m_dWeightWallAvoidance(script->Params().WallAvoidanceWeight),
+             m_dViewDistance(script->Params().ViewDistance),
+             m_dWallDetectionFeelerLength(script->Params().WallDetectionFeelerLength),
              m_Feelers(3),
              m_Deceleration(normal),
              m_pTargetAgent1(NULL),
@@ -37,8 +37,8 @@ Raven_Steering::Raven_Steering(Raven_Game* world, Raven_Bot* agent):
              m_dWanderDistance(WanderDist),
              m_dWanderJitter(WanderJitterPerSec),
              m_dWanderRadius(WanderRad),
-             m_dWeightSeek(script->GetDouble("SeekWeight")),
-             m_dWeightArrive(script->GetDouble("ArriveWeight")),
+             m_dWeightSeek(script->Params().SeekWeight),
+             m_dWeightArrive(script->Params().ArriveWeight),
              m_bCellSpaceOn(false),
              m_SummingMethod(prioritized)
              
@@ -378,12 +378,12 @@ void Raven_Steering::CreateFeelers()
 //
 // this calculates a force repelling from the other neighbors
 //------------------------------------------------------------------------
-Vector2D Raven_Steering::Separation(const std::list<Raven_Bot*>& neighbors)
+Vector2D Raven_Steering::Separation(const std::vector<Raven_Bot*>& neighbors)
 {  
   //iterate through all the neighbors and calculate the vector from the
   Vector2D SteeringForce;
 
-  std::list<Raven_Bot*>::const_iterator it = neighbors.begin();
+  std::vector<Raven_Bot*>::const_iterator it = neighbors.begin();
   for (it; it != neighbors.end(); ++it)
   {
     //make sure this agent isn't included in the calculations and that
@@ -11,10 +11,9 @@
 //
 //------------------------------------------------------------------------
 #include <vector>
-#include <windows.h>
 #include <string>
 #include <list>
-#include "2d/Vector2D.h"
+#include "2D/Vector2D.h"
 #include "constants.h"
 
 class Raven_Bot;
@@ -160,7 +159,7 @@ private:
   Vector2D WallAvoidance(const std::vector<Wall2D*> &walls);
 
   
-  Vector2D Separation(const std::list<Raven_Bot*> &agents);
+  Vector2D Separation(const std::vector<Raven_Bot*> &agents);
 
 
     /* .......................................................
@@ -2,7 +2,7 @@
 #include "Raven_Bot.h"
 #include "Raven_SensoryMemory.h"
 #include "Raven_Game.h"
-#include "debug/DebugConsole.h"
+#include "Debug/DebugConsole.h"
 
 #include "Messaging/Telegram.h"
 #include "Raven_Messages.h"
@@ -13,7 +13,8 @@
 //-------------------------------- ctor ---------------------------------------
 //-----------------------------------------------------------------------------
 Raven_TargetingSystem::Raven_TargetingSystem(Raven_Bot* owner):m_pOwner(owner),
-                                                               m_pCurrentTarget(0)
+                                                               m_pCurrentTarget(0),
+                                                               m_pTeamTargetToSend(0)
 {}
 
 
@@ -26,11 +27,15 @@ void Raven_TargetingSystem::Update()
   double ClosestDistSoFar = MaxDouble;
   m_pCurrentTarget       = 0;
 
+  //the leader is part of its team so it gets the target it sends too. It
+  //is tracked here as the message is only sent by NotifyTeamOfTarget
+  Raven_Bot* pTeamTarget = m_pOwner->GetTeamTarget();
+
   //grab a list of all the opponents the owner can sense
-  std::list<Raven_Bot*> SensedBots;
-  SensedBots = m_pOwner->GetSensoryMem()->GetListOfRecentlySensedOpponents();
+  const std::vector<Raven_Bot*>& SensedBots =
+                     m_pOwner->GetSensoryMem()->GetListOfRecentlySensedOpponents();
   
-  std::list<Raven_Bot*>::const_iterator curBot = SensedBots.begin();
+  std::vector<Raven_Bot*>::const_iterator curBot = SensedBots.begin();
   for (curBot; curBot != SensedBots.end(); ++curBot)
   {
     //make sure the bot is alive and that it is not the owner
@@ -42,7 +47,7 @@ void Raven_TargetingSystem::Update()
 		// if the cible is the one designated by the leader of the team, target it
 		if (m_pOwner->GetWorld()->isTeamMode())
 		{
-			if (*curBot == m_pOwner->GetTeamTarget())
+			if (*curBot == pTeamTarget)
 			{
 				debug_con << "Le bot " << m_pOwner->ID() << "  pris pour cible le TeamTarget " << (*curBot)->ID() << "";
 				m_pCurrentTarget = *curBot;
@@ -61,21 +66,33 @@ void Raven_TargetingSystem::Update()
 				debug_con << "Leader " << m_pOwner->ID() << " demande a son quipe d'attaquer " << (*curBot)->ID() << "";
 				m_pCurrentTarget = *curBot;
 
-				// Send to each agent on by one
-				for (Raven_Bot *bot : m_pOwner->GetWorld()->GetTeamMembers(m_pOwner->EntityType()))
-				{
-						Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-												m_pOwner->ID(),
-												bot->ID(),
-												Msg_TeamTarget,
-												m_pCurrentTarget);
-				}
+				m_pTeamTargetToSend = m_pCurrentTarget;
+				pTeamTarget         = m_pCurrentTarget;
 			}
 		}
     }
   }
 }
 
+//------------------------- NotifyTeamOfTarget --------------------------------
+//-----------------------------------------------------------------------------
+void Raven_TargetingSystem::NotifyTeamOfTarget()
+{
+  if (!m_pTeamTargetToSend) return;
+
+  // Send to each agent on by one
+  for (Raven_Bot *bot : m_pOwner->GetWorld()->GetTeamMembers(m_pOwner->EntityType()))
+  {
+    Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
+                            m_pOwner->ID(),
+                            bot->ID(),
+                            Msg_TeamTarget,
+                            m_pTeamTargetToSend);
+  }
+
+  m_pTeamTargetToSend = 0;
+}
+
 
 
 
@@ -10,7 +10,7 @@
 //  Desc:   class to select a target from the opponents currently in a bot's
 //          perceptive memory.
 //-----------------------------------------------------------------------------
-#include "2d/Vector2D.h"
+#include "2D/Vector2D.h"
 #include <list>
 
 
@@ -29,6 +29,10 @@ private:
   //the current target (this will be null if there is no target assigned)
   Raven_Bot*  m_pCurrentTarget;
 
+  //when the owner leads a team, the target selected by the last Update,
+  //waiting to be sent to the team by NotifyTeamOfTarget
+  Raven_Bot*  m_pTeamTargetToSend;
+
 
 public:
 
@@ -39,8 +43,14 @@ public:
   //if there are no opponents that have had their memory records updated
   //within the memory span of the owner then the current target is set
   //to null
+  //Update does not send any message (it may be running in parallel with
+  //the other bots) so this must be called afterwards to pass on the team
+  //target
   void       Update();
 
+  //sends the target selected by a team leader to its team
+  void       NotifyTeamOfTarget();
+
   //returns true if there is a currently assigned target
   bool       isTargetPresent()const{return m_pCurrentTarget != 0;}
 
@@ -0,0 +1,319 @@
+//------------------------------------------------------------------------
+//
+//  Name:   Raven_TriggerBench.cpp
+//
+//  Desc:   command line tool timing TriggerSystem::TryTriggers with the
+//          triggers sorted into a grid of cells (see Partition) against
+//          trying every bot against every trigger.
+//
+//          it plays a game of NumBots bots and, after each update, tries
+//          every live bot against two trigger systems, one partitioned
+//          like the map's and one not. Both hold a probe for each of the
+//          map's triggers, covering its bounding box, and NumExtra more
+//          the size of a giver at graph nodes picked at random. A probe
+//          only counts the bots touching it, so the game is not changed
+//          and both systems are timed on the same positions. Every live
+//          bot is tried each update, rather than at Bot_TriggerUpdateFreq.
+//
+//          a map has only a few spawn points, and a bot only spawns at a
+//          free one, so with many bots most would be waiting to spawn. A
+//          bot waiting to spawn is put at a free navgraph node picked at
+//          random instead, so nearly all of them are alive, fighting and
+//          moving over the triggers.
+//
+//          it reports the bots alive and the shots fired per update, the
+//          microseconds an update takes with each system and the triggers
+//          a bot is tried against, and checks that both find the same bots
+//          touching the same number of triggers.
+//
+//          the exit code is 2 when they disagree.
+//
+//          usage: raven_triggerbench [map] [NumBots] [NumTicks] [NumExtra]
+//
+//          the map defaults to maps/Raven_DM1.map, NumBots to 200,
+//          NumTicks to 1000 and NumExtra to 0.
+//
+//          must be run from the directory holding Params.lua
+//
+//------------------------------------------------------------------------
+#include <cstdlib>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "constants.h"
+#include "Raven_Game.h"
+#include "Raven_Map.h"
+#include "Raven_Bot.h"
+#include "Time/CrudeTimer.h"
+#include "Triggers/Trigger.h"
+#include "Triggers/TriggerSystem.h"
+#include "lua/Raven_Scriptor.h"
+
+
+typedef std::chrono::steady_clock clock_type;
+
+
+//a bot as seen by the probes. It is always ready to be tried
+struct BotProbe
+{
+  Raven_Bot* pBot;
+
+  long       NumTries;
+  long       NumTouches;
+
+  bool     isReadyForTriggerUpdate()const{return true;}
+  bool     isAlive()const{return pBot->isAlive();}
+  Vector2D Pos()const{return pBot->Pos();}
+  double   BRadius()const{return pBot->BRadius();}
+};
+
+
+//a trigger which counts the bots it is tried against and touches
+class Trigger_Probe : public Trigger<BotProbe>
+{
+public:
+
+  Trigger_Probe(Vector2D TopLeft, Vector2D BottomRight):
+
+                      Trigger<BotProbe>(BaseGameEntity::GetNextValidID())
+  {
+    AddRectangularTriggerRegion(TopLeft, BottomRight);
+  }
+
+  void Try(BotProbe* pProbe)
+  {
+    ++pProbe->NumTries;
+
+    if (isTouchingTrigger(pProbe->Pos(), pProbe->BRadius())) ++pProbe->NumTouches;
+  }
+
+  void Update(){}
+  void Render(){}
+};
+
+typedef TriggerSystem<Trigger<BotProbe> > ProbeSystem;
+
+
+//what trying the bots against one of the systems came to
+struct TryResult
+{
+  double Time;
+  long   Bots;
+  long   Tries;
+  long   Touches;
+};
+
+
+//---------------------------- SpawnAtNode ------------------------------------
+//
+//  like Raven_Game::AttemptToAddBot, but at a navgraph node picked at random
+//  rather than at a spawn point. Bots spawned on top of each other would be
+//  pushed apart by nothing, so a node is only used if no bot is near it
+//-----------------------------------------------------------------------------
+static bool SpawnAtNode(const Raven_Game& game, Raven_Bot* pBot)
+{
+  for (int attempt=0; attempt<10; ++attempt)
+  {
+    const Vector2D pos = game.GetMap()->GetRandomNodeLocation();
+
+    bool bAvailable = true;
+
+    std::vector<Raven_Bot*>::const_iterator curBot;
+    for (curBot = game.GetAllBots().begin(); curBot != game.GetAllBots().end(); ++curBot)
+    {
+      if (!(*curBot)->isSpawning() &&
+          Vec2DDistance(pos, (*curBot)->Pos()) < pBot->BRadius() + (*curBot)->BRadius())
+      {
+        bAvailable = false;
+
+        break;
+      }
+    }
+
+    if (bAvailable)
+    {
+      pBot->Spawn(pos);
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+//---------------------------- TryProbes --------------------------------------
+//
+//  tries the bots against the system, adding to the result. The touches of
+//  each bot are left in the probes
+//-----------------------------------------------------------------------------
+static void TryProbes(ProbeSystem&            system,
+                      std::vector<BotProbe*>& probes,
+                      TryResult&              result)
+{
+  for (unsigned int p=0; p<probes.size(); ++p)
+  {
+    probes[p]->NumTries   = 0;
+    probes[p]->NumTouches = 0;
+  }
+
+  clock_type::time_point start = clock_type::now();
+
+  system.Update(probes);
+
+  result.Time += std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+
+  for (unsigned int p=0; p<probes.size(); ++p)
+  {
+    if (probes[p]->isAlive()) ++result.Bots;
+
+    result.Tries   += probes[p]->NumTries;
+    result.Touches += probes[p]->NumTouches;
+  }
+}
+
+
+int main(int argc, char* argv[])
+{
+  const std::string map = argc > 1 ? argv[1] : "maps/Raven_DM1.map";
+  const int NumBots     = argc > 2 ? atoi(argv[2]) : 200;
+  const int NumTicks    = argc > 3 ? atoi(argv[3]) : 1000;
+  const int NumExtra    = argc > 4 ? atoi(argv[4]) : 0;
+
+  srand(1);
+
+  Clock->UseFixedStep(1.0 / FrameRate);
+
+  try
+  {
+    Raven_Game game;
+
+    if (!game.LoadMap(map)) return 1;
+
+    while (game.GetNumBots() < NumBots)
+    {
+      game.AddBots(1, game.GetNextTeam());
+    }
+
+    const Raven_Map* pMap = game.GetMap();
+
+    ProbeSystem grid;
+    ProbeSystem pairs;
+
+    grid.Partition(pMap->GetSizeX(),
+                   pMap->GetSizeY(),
+                   script->Params().NumCellsX,
+                   script->Params().NumCellsY);
+
+    Raven_Map::TriggerSystem::TriggerList::const_iterator curTrg;
+    for (curTrg = pMap->GetTriggers().begin(); curTrg != pMap->GetTriggers().end(); ++curTrg)
+    {
+      Vector2D TopLeft, BottomRight;
+
+      if (!(*curTrg)->GetRegionBounds(TopLeft, BottomRight)) continue;
+
+      grid.Register(new Trigger_Probe(TopLeft, BottomRight));
+      pairs.Register(new Trigger_Probe(TopLeft, BottomRight));
+    }
+
+    const double range = script->Params().DefaultGiverTriggerRange;
+
+    for (int e=0; e<NumExtra; ++e)
+    {
+      const Vector2D pos    = pMap->GetRandomNodeLocation();
+      const Vector2D corner = Vector2D(range, range);
+
+      grid.Register(new Trigger_Probe(pos - corner, pos + corner));
+      pairs.Register(new Trigger_Probe(pos - corner, pos + corner));
+    }
+
+    const int NumTriggers = (int)pairs.GetTriggers().size();
+
+    std::vector<BotProbe>  bots(game.GetAllBots().size());
+    std::vector<BotProbe*> probes;
+
+    for (unsigned int b=0; b<bots.size(); ++b)
+    {
+      bots[b].pBot = game.GetAllBots()[b];
+
+      probes.push_back(&bots[b]);
+    }
+
+    TryResult GridResult  = {0, 0, 0, 0};
+    TryResult PairsResult = {0, 0, 0, 0};
+
+    int NumMismatched = 0;
+
+    std::vector<long> touches(bots.size());
+
+    for (int tick=0; tick<NumTicks; ++tick)
+    {
+      game.Update();
+
+      for (unsigned int b=0; b<bots.size(); ++b)
+      {
+        if (bots[b].pBot->isSpawning()) SpawnAtNode(game, bots[b].pBot);
+      }
+
+      TryProbes(pairs, probes, PairsResult);
+
+      for (unsigned int b=0; b<bots.size(); ++b)
+      {
+        touches[b] = bots[b].NumTouches;
+      }
+
+      TryProbes(grid, probes, GridResult);
+
+      for (unsigned int b=0; b<bots.size(); ++b)
+      {
+        if (touches[b] != bots[b].NumTouches) ++NumMismatched;
+      }
+    }
+
+    const double n        = NumTicks > 0 ? (double)NumTicks : 1.0;
+    const double NumTried = PairsResult.Bots > 0 ? (double)PairsResult.Bots : 1.0;
+
+    long NumShots = 0;
+
+    for (unsigned int b=0; b<bots.size(); ++b)
+    {
+      NumShots += bots[b].pBot->NumShotsFired();
+    }
+
+    std::cout << map << ", " << bots.size() << " bots, " << NumTriggers << " triggers, "
+              << NumTicks << " ticks:" << std::endl;
+
+    std::cout << "  " << PairsResult.Bots / n << " bots alive and " << NumShots / n
+              << " shots fired per update" << std::endl;
+
+    struct Row
+    {
+      const char*      Name;
+      const TryResult* Result;
+    } rows[] = {{"all pairs", &PairsResult}, {"grid", &GridResult}};
+
+    for (unsigned int r=0; r<sizeof(rows)/sizeof(rows[0]); ++r)
+    {
+      const TryResult& res = *rows[r].Result;
+
+      std::cout << "  " << rows[r].Name << ": " << res.Time / n << "us per update, "
+                << res.Tries / NumTried << " triggers tried and "
+                << res.Touches / NumTried << " touched per live bot" << std::endl;
+    }
+
+    std::cout << "  " << NumMismatched << " bots touching a different number of triggers"
+              << std::endl;
+
+    return NumMismatched == 0 ? 0 : 2;
+  }
+
+  catch (const std::runtime_error& err)
+  {
+    std::cerr << err.what() << std::endl;
+
+    return 1;
+  }
+}
@@ -10,7 +10,7 @@
 #include "lua/Raven_Scriptor.h"
 #include "Raven_Game.h"
 #include "Raven_UserOptions.h"
-#include "2D/transformations.h"
+#include "2D/Transformations.h"
 
 
 
@@ -20,6 +20,7 @@ Raven_WeaponSystem::Raven_WeaponSystem(Raven_Bot* owner,
                                        double ReactionTime,
                                        double AimAccuracy,
                                        double AimPersistance):m_pOwner(owner),
+                                                          m_iInventoryEpoch(0),
                                                           m_dReactionTime(ReactionTime),
                                                           m_dAimAccuracy(AimAccuracy),
                                                           m_dAimPersistance(AimPersistance)
@@ -61,6 +62,24 @@ void Raven_WeaponSystem::Initialize()
   m_WeaponMap[type_rocket_launcher] = 0;
   m_WeaponMap[type_grenade] = new Grenade(m_pOwner);
   m_WeaponMap[type_blade] = new Blade(m_pOwner);
+
+  InventoryChanged();
+}
+
+//---------------------------- BakeFuzzySurfaces ------------------------------
+//
+//  bakes the table shared by each type of weapon
+//-----------------------------------------------------------------------------
+void Raven_WeaponSystem::BakeFuzzySurfaces()
+{
+  if (!script->Params().Weapon_UseFuzzySurfaces) return;
+
+  Raven_Weapon::BakeFuzzySurface(type_blaster, Blaster::AddFuzzyRules);
+  Raven_Weapon::BakeFuzzySurface(type_shotgun, ShotGun::AddFuzzyRules);
+  Raven_Weapon::BakeFuzzySurface(type_rail_gun, RailGun::AddFuzzyRules);
+  Raven_Weapon::BakeFuzzySurface(type_rocket_launcher, RocketLauncher::AddFuzzyRules);
+  Raven_Weapon::BakeFuzzySurface(type_grenade, Grenade::AddFuzzyRules);
+  Raven_Weapon::BakeFuzzySurface(type_blade, Blade::AddFuzzyRules);
 }
 
 //-------------------------------- SelectWeapon -------------------------------
@@ -156,6 +175,8 @@ void  Raven_WeaponSystem::AddWeapon(unsigned int weapon_type)
   else
   {
     m_WeaponMap[weapon_type] = w;
+
+    InventoryChanged();
   }
 }
 
@@ -12,7 +12,7 @@
 //
 //-----------------------------------------------------------------------------
 #include <map>
-#include "2d/vector2d.h"
+#include "2D/Vector2D.h"
 
 class Raven_Bot;
 class Raven_Weapon;
@@ -37,6 +37,10 @@ private:
   //a pointer to the weapon the bot is currently holding
   Raven_Weapon*    m_pCurrentWeapon;
 
+  //bumped each time a weapon is added or the ammo of one changes, so what
+  //is worked out from the inventory can be kept until it changes
+  unsigned int     m_iInventoryEpoch;
+
   //this is the minimum amount of time a bot needs to see an opponent before
   //it can react to it. This variable is used to prevent a bot shooting at
   //an opponent the instant it becomes visible.
@@ -73,6 +77,10 @@ public:
   //sets up the weapon map with just one weapon: the blaster
   void          Initialize();
 
+  //bakes the lookup tables of the weapons' fuzzy rules, when they are used,
+  //so it is done while loading rather than when a weapon is first picked up
+  static void   BakeFuzzySurfaces();
+
   //this method aims the bot's current weapon at the target (if there is a
   //target) and, if aimed correctly, fires a round. (Called each update-step
   //from Raven_Bot::Update)
@@ -104,6 +112,10 @@ public:
   //returns the amount of ammo remaining for the specified weapon
   int           GetAmmoRemainingForWeapon(unsigned int weapon_type);
 
+  //called by the weapons when their ammo changes
+  void          InventoryChanged(){++m_iInventoryEpoch;}
+  unsigned int  GetInventoryEpoch()const{return m_iInventoryEpoch;}
+
   double         ReactionTime()const{return m_dReactionTime;}
 
   void          RenderCurrentWeapon()const;
@@ -0,0 +1,43 @@
+#include "Raven_World.h"
+#include "Raven_Game.h"
+
+
+//------------------------------ ctor -----------------------------------------
+//-----------------------------------------------------------------------------
+Raven_World::Raven_World():m_pGame(NULL)
+{
+  //the game reads its parameters and registers its entities while it is
+  //being created so the world must be current first
+  MakeCurrent();
+
+  m_pGame = new Raven_Game();
+}
+
+//------------------------------ dtor -----------------------------------------
+//-----------------------------------------------------------------------------
+Raven_World::~Raven_World()
+{
+  MakeCurrent();
+
+  delete m_pGame;
+
+  Release();
+}
+
+//--------------------------- MakeCurrent -------------------------------------
+//-----------------------------------------------------------------------------
+void Raven_World::MakeCurrent()
+{
+  WorldContext::MakeCurrent();
+
+  Raven_Scriptor::m_pThreadInstance = &m_Script;
+}
+
+//----------------------------- Release ---------------------------------------
+//-----------------------------------------------------------------------------
+void Raven_World::Release()
+{
+  WorldContext::Release();
+
+  Raven_Scriptor::m_pThreadInstance = NULL;
+}
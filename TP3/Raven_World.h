@@ -0,0 +1,44 @@
+#ifndef RAVEN_WORLD_H
+#define RAVEN_WORLD_H
+//------------------------------------------------------------------------
+//
+//  Name:   Raven_World.h
+//
+//  Desc:   a self contained instance of the Raven simulation: a game with
+//          its own entity manager, message dispatcher, clock and Lua
+//          state. Any number of these can be run at the same time, each
+//          one on its own thread (see WorldContext).
+//
+//          The world is made current on the thread that creates it. A
+//          thread should only update the world that is current on it.
+//
+//------------------------------------------------------------------------
+#include "Game/WorldContext.h"
+#include "lua/Raven_Scriptor.h"
+
+class Raven_Game;
+
+
+class Raven_World : public WorldContext
+{
+private:
+
+  //the parameters of this world (Params.lua is run by the ctor)
+  Raven_Scriptor m_Script;
+
+  Raven_Game*    m_pGame;
+
+public:
+
+  Raven_World();
+  ~Raven_World();
+
+  void        MakeCurrent();
+  void        Release();
+
+  Raven_Game* Game()const{return m_pGame;}
+};
+
+
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef PROJECTILE_POOL_H
+#define PROJECTILE_POOL_H
+#pragma warning (disable:4786)
+//-----------------------------------------------------------------------------
+//
+//  Name:   ProjectilePool.h
+//
+//  Desc:   storage for all the projectiles of one type.
+//
+//          Projectiles are constructed in slots taken from blocks of raw
+//          memory. A block is never freed or moved while the pool exists,
+//          so a projectile keeps the same address for the whole of its life,
+//          and the slot of a dead projectile is reused by the next one
+//          fired. Once the pool has grown to the size a firefight needs,
+//          firing a weapon does not allocate any memory.
+//
+//          The live projectiles are kept in a contiguous array, in the
+//          order they were fired, which is compacted as dead ones are
+//          removed. Because the pool knows the exact type it holds, Update
+//          and Render are called without going through the vtable.
+//-----------------------------------------------------------------------------
+#include <vector>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+
+template <class projectile_type>
+class ProjectilePool
+{
+private:
+
+  enum {SlotsPerBlock = 32};
+
+  typedef typename std::aligned_storage<sizeof(projectile_type),
+                                        alignof(projectile_type)>::type Slot;
+
+  //the memory the projectiles are constructed in
+  std::vector<Slot*>            m_Blocks;
+
+  //slots not currently holding a projectile
+  std::vector<projectile_type*> m_FreeSlots;
+
+  //the projectiles in play, oldest first
+  std::vector<projectile_type*> m_Live;
+
+  void AddBlock()
+  {
+    Slot* block = new Slot[SlotsPerBlock];
+
+    m_Blocks.push_back(block);
+
+    //pushed in reverse so slots are handed out in address order
+    for (int s=SlotsPerBlock-1; s>=0; --s)
+    {
+      m_FreeSlots.push_back(reinterpret_cast<projectile_type*>(&block[s]));
+    }
+  }
+
+  void Destroy(projectile_type* p)
+  {
+    p->~projectile_type();
+
+    m_FreeSlots.push_back(p);
+  }
+
+  //copy ctor and assignment should be private
+  ProjectilePool(const ProjectilePool&);
+  ProjectilePool& operator=(const ProjectilePool&);
+
+public:
+
+  ProjectilePool(){}
+
+  ~ProjectilePool()
+  {
+    Clear();
+
+    for (unsigned int b=0; b<m_Blocks.size(); ++b)
+    {
+      delete [] m_Blocks[b];
+    }
+  }
+
+  //constructs a new projectile in a free slot. The arguments are passed
+  //to the projectile's constructor
+  template <class... Args>
+  projectile_type* Create(Args&&... args)
+  {
+    if (m_FreeSlots.empty()) AddBlock();
+
+    projectile_type* p = new (m_FreeSlots.back()) projectile_type(std::forward<Args>(args)...);
+
+    m_FreeSlots.pop_back();
+
+    m_Live.push_back(p);
+
+    return p;
+  }
+
+  //removes the projectiles which died during the last update and updates
+  //the others. The order of the remaining projectiles is unchanged
+  void Update()
+  {
+    unsigned int NumLive = 0;
+
+    for (unsigned int i=0; i<m_Live.size(); ++i)
+    {
+      projectile_type* p = m_Live[i];
+
+      if (p->isDead())
+      {
+        Destroy(p);
+      }
+      else
+      {
+        p->projectile_type::Update();
+
+        m_Live[NumLive++] = p;
+      }
+    }
+
+    m_Live.resize(NumLive);
+  }
+
+  void Render()const
+  {
+    for (unsigned int i=0; i<m_Live.size(); ++i)
+    {
+      m_Live[i]->projectile_type::Render();
+    }
+  }
+
+  //destroys every projectile in play. The memory is kept for reuse
+  void Clear()
+  {
+    for (unsigned int i=0; i<m_Live.size(); ++i)
+    {
+      Destroy(m_Live[i]);
+    }
+
+    m_Live.clear();
+  }
+
+  int  NumLive()const{return (int)m_Live.size();}
+
+  const std::vector<projectile_type*>& GetLive()const{return m_Live;}
+};
+
+
+
+#endif
@@ -1,10 +1,10 @@
 #include "Projectile_Blade_Strike.h"
 #include "../lua/Raven_Scriptor.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 #include "../Raven_Bot.h"
 #include "../Raven_Game.h"
-#include "game/EntityFunctionTemplates.h"
-#include "2d/WallIntersectionTests.h"
+#include "Game/EntityFunctionTemplates.h"
+#include "2D/WallIntersectionTests.h"
 #include "../Raven_Map.h"
 
 #include "../Raven_Messages.h"
@@ -19,13 +19,13 @@ Blade_Strike::Blade_Strike(Raven_Bot* swordsman, Vector2D target) :
 		swordsman->ID(),
 		swordsman->Pos(),
 		swordsman->Facing(),
-		script->GetInt("Blade_Damage"),
-		script->GetDouble("Blade_Scale"),
-		script->GetDouble("Blade_MaxSpeed"),
-		script->GetDouble("Blade_Mass"),
-		script->GetDouble("Blade_MaxForce")),
+		script->Params().Blade_Damage,
+		script->Params().Blade_Scale,
+		script->Params().Blade_MaxSpeed,
+		script->Params().Blade_Mass,
+		script->Params().Blade_MaxForce),
 		swordsman(swordsman), 
-		m_dBlastRadius(script->GetDouble("Blade_Range"))
+		m_dBlastRadius(script->Params().Blade_Range)
 {
 	assert(target != Vector2D());
 }
@@ -48,20 +48,17 @@ void Blade_Strike::TestForImpact()
 //--------------- InflictDamageOnBotsWithinBlastRadius ------------------------
 void Blade_Strike::InflictDamageOnBotsWithinBlastRadius()
 {
-	std::list<Raven_Bot*>::const_iterator curBot = m_pWorld->GetAllBots().begin();
+	//only the bots in the grid cells around the strike need testing
+	const std::vector<Raven_Bot*>& candidates = m_pWorld->GetBotGrid().QueryCircle(Pos(), 1.5 * m_dBlastRadius);
 
-	for (curBot; curBot != m_pWorld->GetAllBots().end(); ++curBot)
+	std::vector<Raven_Bot*>::const_iterator curBot = candidates.begin();
+
+	for (curBot; curBot != candidates.end(); ++curBot)
 	{
 		if ((*curBot) != swordsman) {
 			if (Vec2DDistance(Pos(), (*curBot)->Pos()) < 1.5 * m_dBlastRadius + (*curBot)->BRadius())
 			{
-				//send a message to the bot to let it know it's been hit, and who the
-				//shot came from
-				Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-					m_iShooterID,
-					(*curBot)->ID(),
-					Msg_TakeThatMF,
-					(void*)&m_iDamageInflicted);
+				DamageBot(*curBot);
 
 			}
 		}
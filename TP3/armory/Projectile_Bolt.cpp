@@ -1,10 +1,10 @@
 #include "Projectile_Bolt.h"
 #include "../lua/Raven_Scriptor.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 #include "../Raven_Bot.h"
 #include "../Raven_Game.h"
 #include "../constants.h"
-#include "2d/WallIntersectionTests.h"
+#include "2D/WallIntersectionTests.h"
 #include "../Raven_Map.h"
 
 #include "../Raven_Messages.h"
@@ -20,11 +20,11 @@ Bolt::Bolt(Raven_Bot* shooter, Vector2D target):
                          shooter->ID(),
                          shooter->Pos(),
                          shooter->Facing(),
-                         script->GetInt("Bolt_Damage"),
-                         script->GetDouble("Bolt_Scale"),
-                         script->GetDouble("Bolt_MaxSpeed"),
-                         script->GetDouble("Bolt_Mass"),
-                         script->GetDouble("Bolt_MaxForce"))
+                         script->Params().Bolt_Damage,
+                         script->Params().Bolt_Scale,
+                         script->Params().Bolt_MaxSpeed,
+                         script->Params().Bolt_Mass,
+                         script->Params().Bolt_MaxForce)
 {
    assert (target != Vector2D());
 }
@@ -61,13 +61,7 @@ void Bolt::Update()
       m_bImpacted = true;
       m_bDead     = true;
 
-      //send a message to the bot to let it know it's been hit, and who the
-      //shot came from
-      Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-                              m_iShooterID,
-                              hit->ID(),
-                              Msg_TakeThatMF,
-                              (void*)&m_iDamageInflicted);
+      DamageBot(hit);
     }
 
     //test for impact with a wall
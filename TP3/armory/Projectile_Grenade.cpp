@@ -1,10 +1,10 @@
 #include "Projectile_Grenade.h"
 #include "../lua/Raven_Scriptor.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 #include "../Raven_Bot.h"
 #include "../Raven_Game.h"
 #include "../constants.h"
-#include "2d/WallIntersectionTests.h"
+#include "2D/WallIntersectionTests.h"
 #include "../Raven_Map.h"
 
 #include "../Raven_Messages.h"
@@ -20,16 +20,16 @@ Grenade_Projectile::Grenade_Projectile(Raven_Bot* shooter, Vector2D target) :
 		shooter->ID(),
 		shooter->Pos(),
 		shooter->Facing(),
-		script->GetInt("Grenade_Damage"),
-		script->GetDouble("Grenade_Scale"),
-		script->GetDouble("Grenade_MaxSpeed"),
-		script->GetDouble("Grenade_Mass"),
-		script->GetDouble("Grenade_MaxForce")),
+		script->Params().Grenade_Damage,
+		script->Params().Grenade_Scale,
+		script->Params().Grenade_MaxSpeed,
+		script->Params().Grenade_Mass,
+		script->Params().Grenade_MaxForce),
 
 	exploded(false),
-	explosionTime(Clock->GetCurrentTime() + script->GetDouble("Grenade_TimeBeforeExplosion")),
+	explosionTime(Clock->GetCurrentTime() + script->Params().Grenade_TimeBeforeExplosion),
 	m_dCurrentBlastRadius(0.0),
-	m_dBlastRadius(script->GetDouble("Grenade_BlastRadius"))
+	m_dBlastRadius(script->Params().Grenade_BlastRadius)
 {
 	assert(target != Vector2D());
 }
@@ -60,7 +60,7 @@ void Grenade_Projectile::Update()
 			exploded = true;
 		}
 		
-		m_dCurrentBlastRadius += script->GetDouble("Rocket_ExplosionDecayRate");
+		m_dCurrentBlastRadius += script->Params().Rocket_ExplosionDecayRate;
 
 		//when the rendered blast circle becomes equal in size to the blast radius
 		//the rocket can be removed from the game
@@ -89,7 +89,8 @@ void Grenade_Projectile::TestForImpact()
 		int damageOnHit = 0;
 
 		//send a message to the bot to let it know it's been hit, and who the
-		//shot came from
+		//shot came from. The grenade only does damage when it explodes, so
+		//this does not count as a hit
 		Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
 			m_iShooterID,
 			hit->ID(),
@@ -124,19 +125,16 @@ void Grenade_Projectile::TestForImpact()
 //-----------------------------------------------------------------------------
 void Grenade_Projectile::InflictDamageOnBotsWithinBlastRadius()
 {
-	std::list<Raven_Bot*>::const_iterator curBot = m_pWorld->GetAllBots().begin();
+	//only the bots in the grid cells around the blast need testing
+	const std::vector<Raven_Bot*>& candidates = m_pWorld->GetBotGrid().QueryCircle(Pos(), m_dBlastRadius);
 
-	for (curBot; curBot != m_pWorld->GetAllBots().end(); ++curBot)
+	std::vector<Raven_Bot*>::const_iterator curBot = candidates.begin();
+
+	for (curBot; curBot != candidates.end(); ++curBot)
 	{
 		if (Vec2DDistance(Pos(), (*curBot)->Pos()) < m_dBlastRadius + (*curBot)->BRadius())
 		{
-			//send a message to the bot to let it know it's been hit, and who the
-			//shot came from
-			Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-				m_iShooterID,
-				(*curBot)->ID(),
-				Msg_TakeThatMF,
-				(void*)&m_iDamageInflicted);
+			DamageBot(*curBot);
 
 		}
 	}
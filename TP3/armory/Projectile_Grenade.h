@@ -33,7 +33,7 @@ public:
 
 	void Update();
 
-	inline bool Grenade_Projectile::isExploded()
+	inline bool isExploded()
 	{
 		if (Clock->GetCurrentTime() > explosionTime)
 		{
@@ -1,11 +1,11 @@
 #include "Projectile_Pellet.h"
 #include "../lua/Raven_Scriptor.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 #include "../Raven_Bot.h"
 #include "../Raven_Game.h"
-#include "game/EntityFunctionTemplates.h"
+#include "Game/EntityFunctionTemplates.h"
 #include "../constants.h"
-#include "2d/WallIntersectionTests.h"
+#include "2D/WallIntersectionTests.h"
 #include "../Raven_Map.h"
 #include <list>
 
@@ -23,13 +23,13 @@ Pellet::Pellet(Raven_Bot* shooter, Vector2D target):
                          shooter->ID(),
                          shooter->Pos(),
                          shooter->Facing(),
-                         script->GetInt("Pellet_Damage"),
-                         script->GetDouble("Pellet_Scale"),
-                         script->GetDouble("Pellet_MaxSpeed"),
-                         script->GetDouble("Pellet_Mass"),
-                         script->GetDouble("Pellet_MaxForce")),
+                         script->Params().Pellet_Damage,
+                         script->Params().Pellet_Scale,
+                         script->Params().Pellet_MaxSpeed,
+                         script->Params().Pellet_Mass,
+                         script->Params().Pellet_MaxForce),
 
-        m_dTimeShotIsVisible(script->GetDouble("Pellet_Persistance"))
+        m_dTimeShotIsVisible(script->Params().Pellet_Persistance)
 {
   
 }
@@ -96,13 +96,7 @@ void Pellet::TestForImpact()
                                                hit->BRadius(),
                                                m_vImpactPoint);
 
-  //send a message to the bot to let it know it's been hit, and who the
-  //shot came from
-  Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-                              m_iShooterID,
-                              hit->ID(),
-                              Msg_TakeThatMF,
-                              (void*)&m_iDamageInflicted);
+  DamageBot(hit);
 }
 
 //-------------------------- Render -------------------------------------------
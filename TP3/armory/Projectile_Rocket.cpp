@@ -1,10 +1,10 @@
 #include "Projectile_Rocket.h"
 #include "../lua/Raven_Scriptor.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 #include "../Raven_Bot.h"
 #include "../Raven_Game.h"
 #include "../constants.h"
-#include "2d/WallIntersectionTests.h"
+#include "2D/WallIntersectionTests.h"
 #include "../Raven_Map.h"
 
 #include "../Raven_Messages.h"
@@ -20,14 +20,14 @@ Rocket::Rocket(Raven_Bot* shooter, Vector2D target):
                          shooter->ID(),
                          shooter->Pos(),
                          shooter->Facing(),
-                         script->GetInt("Rocket_Damage"),
-                         script->GetDouble("Rocket_Scale"),
-                         script->GetDouble("Rocket_MaxSpeed"),
-                         script->GetDouble("Rocket_Mass"),
-                         script->GetDouble("Rocket_MaxForce")),
+                         script->Params().Rocket_Damage,
+                         script->Params().Rocket_Scale,
+                         script->Params().Rocket_MaxSpeed,
+                         script->Params().Rocket_Mass,
+                         script->Params().Rocket_MaxForce),
 
        m_dCurrentBlastRadius(0.0),
-       m_dBlastRadius(script->GetDouble("Rocket_BlastRadius"))
+       m_dBlastRadius(script->Params().Rocket_BlastRadius)
 {
    assert (target != Vector2D());
 }
@@ -52,7 +52,7 @@ void Rocket::Update()
 
   else
   {
-    m_dCurrentBlastRadius += script->GetDouble("Rocket_ExplosionDecayRate");
+    m_dCurrentBlastRadius += script->Params().Rocket_ExplosionDecayRate;
 
     //when the rendered blast circle becomes equal in size to the blast radius
     //the rocket can be removed from the game
@@ -80,13 +80,7 @@ void Rocket::TestForImpact()
     {
       m_bImpacted = true;
 
-      //send a message to the bot to let it know it's been hit, and who the
-      //shot came from
-      Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-                              m_iShooterID,
-                              hit->ID(),
-                              Msg_TakeThatMF,
-                              (void*)&m_iDamageInflicted);
+      DamageBot(hit);
 
       //test for bots within the blast radius and inflict damage
       InflictDamageOnBotsWithinBlastRadius();
@@ -128,19 +122,16 @@ void Rocket::TestForImpact()
 //-----------------------------------------------------------------------------
 void Rocket::InflictDamageOnBotsWithinBlastRadius()
 {
-  std::list<Raven_Bot*>::const_iterator curBot = m_pWorld->GetAllBots().begin();
+  //only the bots in the grid cells around the blast need testing
+  const std::vector<Raven_Bot*>& candidates = m_pWorld->GetBotGrid().QueryCircle(Pos(), m_dBlastRadius);
 
-  for (curBot; curBot != m_pWorld->GetAllBots().end(); ++curBot)
+  std::vector<Raven_Bot*>::const_iterator curBot = candidates.begin();
+
+  for (curBot; curBot != candidates.end(); ++curBot)
   {
     if (Vec2DDistance(Pos(), (*curBot)->Pos()) < m_dBlastRadius + (*curBot)->BRadius())
     {
-      //send a message to the bot to let it know it's been hit, and who the
-      //shot came from
-      Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-                              m_iShooterID,
-                              (*curBot)->ID(),
-                              Msg_TakeThatMF,
-                              (void*)&m_iDamageInflicted);
+      DamageBot(*curBot);
       
     }
   }  
@@ -1,10 +1,10 @@
 #include "Projectile_Slug.h"
 #include "../lua/Raven_Scriptor.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 #include "../Raven_Bot.h"
 #include "../Raven_Game.h"
-#include "game/EntityFunctionTemplates.h"
-#include "2d/WallIntersectionTests.h"
+#include "Game/EntityFunctionTemplates.h"
+#include "2D/WallIntersectionTests.h"
 #include "../Raven_Map.h"
 
 #include "../Raven_Messages.h"
@@ -22,13 +22,13 @@ Slug::Slug(Raven_Bot* shooter, Vector2D target):
                          shooter->ID(),
                          shooter->Pos(),
                          shooter->Facing(),
-                         script->GetInt("Slug_Damage"),
-                         script->GetDouble("Slug_Scale"),
-                         script->GetDouble("Slug_MaxSpeed"),
-                         script->GetDouble("Slug_Mass"),
-                         script->GetDouble("Slug_MaxForce")),
+                         script->Params().Slug_Damage,
+                         script->Params().Slug_Scale,
+                         script->Params().Slug_MaxSpeed,
+                         script->Params().Slug_Mass,
+                         script->Params().Slug_MaxForce),
 
-        m_dTimeShotIsVisible(script->GetDouble("Slug_Persistance"))
+        m_dTimeShotIsVisible(script->Params().Slug_Persistance)
 {
   
 }
@@ -82,22 +82,16 @@ void Slug::TestForImpact()
 
   //test to see if the ray between the current position of the slug and 
   //the start position intersects with any bots.
-  std::list<Raven_Bot*> hits = GetListOfIntersectingBots(m_vOrigin, m_vPosition);
+  const std::vector<Raven_Bot*>& hits = GetListOfIntersectingBots(m_vOrigin, m_vPosition);
 
   //if no bots hit just return;
   if (hits.empty()) return;
 
   //give some damage to the hit bots
-  std::list<Raven_Bot*>::iterator it;
+  std::vector<Raven_Bot*>::const_iterator it;
   for (it=hits.begin(); it != hits.end(); ++it)
   {
-    //send a message to the bot to let it know it's been hit, and who the
-    //shot came from
-    Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-                            m_iShooterID,
-                            (*it)->ID(),
-                            Msg_TakeThatMF,
-                            (void*)&m_iDamageInflicted);
+    DamageBot(*it);
     
   }
 }
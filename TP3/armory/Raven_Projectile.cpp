@@ -1,19 +1,26 @@
 #include "Raven_Projectile.h"
 #include "../Raven_Game.h"
-#include <list>
+#include "../Raven_Bot.h"
+#include "../Raven_Messages.h"
+#include "Messaging/MessageDispatcher.h"
+#include <vector>
 
 //------------------ GetClosestIntersectingBot --------------------------------
-
+//
+//  only the bots in the grid cells crossed by FromTo are tested
+//-----------------------------------------------------------------------------
 Raven_Bot* Raven_Projectile::GetClosestIntersectingBot(Vector2D    From,
                                                        Vector2D    To)const
 {
   Raven_Bot* ClosestIntersectingBot = 0;
   double ClosestSoFar = MaxDouble;
 
-  //iterate through all entities checking against the line segment FromTo
-  std::list<Raven_Bot*>::const_iterator curBot;
-  for (curBot =  m_pWorld->GetAllBots().begin();
-       curBot != m_pWorld->GetAllBots().end();
+  const std::vector<Raven_Bot*>& candidates = m_pWorld->GetBotGrid().QuerySegment(From, To);
+
+  //iterate through the candidates checking against the line segment FromTo
+  std::vector<Raven_Bot*>::const_iterator curBot;
+  for (curBot =  candidates.begin();
+       curBot != candidates.end();
        ++curBot)
   {
     //make sure we don't check against the shooter of the projectile
@@ -41,31 +48,61 @@ Raven_Bot* Raven_Projectile::GetClosestIntersectingBot(Vector2D    From,
 
 
 //---------------------- GetListOfIntersectingBots ----------------------------
-std::list<Raven_Bot*> Raven_Projectile::GetListOfIntersectingBots(Vector2D From,
-                                                                  Vector2D To)const
+const std::vector<Raven_Bot*>& Raven_Projectile::GetListOfIntersectingBots(Vector2D From,
+                                                                           Vector2D To)const
 {
-  //this will hold any bots that are intersecting with the line segment
-  std::list<Raven_Bot*> hits;
+  //the candidates are filtered in place: this will hold any bots that are
+  //intersecting with the line segment
+  std::vector<Raven_Bot*>& hits = m_pWorld->GetBotGrid().QuerySegment(From, To);
 
-  //iterate through all entities checking against the line segment FromTo
-  std::list<Raven_Bot*>::const_iterator curBot;
-  for (curBot =  m_pWorld->GetAllBots().begin();
-       curBot != m_pWorld->GetAllBots().end();
-       ++curBot)
+  unsigned int NumHits = 0;
+
+  for (unsigned int i=0; i<hits.size(); ++i)
   {
+    Raven_Bot* pBot = hits[i];
+
     //make sure we don't check against the shooter of the projectile
-    if ( ((*curBot)->ID() != m_iShooterID))
+    if (pBot->ID() != m_iShooterID)
     {
       //if the distance to FromTo is less than the entities bounding radius then
-      //there is an intersection so add it to hits
-      if (DistToLineSegment(From, To, (*curBot)->Pos()) < (*curBot)->BRadius())
+      //there is an intersection so keep it
+      if (DistToLineSegment(From, To, pBot->Pos()) < pBot->BRadius())
       {
-        hits.push_back(*curBot);
+        hits[NumHits++] = pBot;
       }
     }
-
   }
 
+  hits.resize(NumHits);
+
   return hits;
 }
 
+
+//------------------------------- DamageBot -----------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Projectile::DamageBot(Raven_Bot* pBot)
+{
+  //dead and spawning bots take no damage, and neither the shooter nor its
+  //teammates are opponents
+  if (!m_bHitOpponent && pBot->isAlive() && pBot->ID() != m_iShooterID)
+  {
+    Raven_Bot* pShooter = m_pWorld->GetBotFromID(m_iShooterID);
+
+    if (pShooter &&
+        (!m_pWorld->isTeamMode() || pShooter->EntityType() != pBot->EntityType()))
+    {
+      pShooter->IncrementHits();
+
+      m_bHitOpponent = true;
+    }
+  }
+
+  //send a message to the bot to let it know it's been hit, and who the
+  //shot came from
+  Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
+                          m_iShooterID,
+                          pBot->ID(),
+                          Msg_TakeThatMF,
+                          (void*)&m_iDamageInflicted);
+}
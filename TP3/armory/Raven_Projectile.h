@@ -12,10 +12,10 @@
 //          types of projectile: Slugs (railgun), Pellets (shotgun), Rockets
 //          (rocket launcher ) and Bolts (Blaster) 
 //-----------------------------------------------------------------------------
-#include "game/MovingEntity.h"
-#include "2d/Vector2D.h"
-#include "time/CrudeTimer.h"
-#include <list>
+#include "Game/MovingEntity.h"
+#include "2D/Vector2D.h"
+#include "Time/CrudeTimer.h"
+#include <vector>
 
 class Raven_Game;
 class Raven_Bot;
@@ -40,6 +40,10 @@ protected:
   //how much damage the projectile inflicts
   int           m_iDamageInflicted;
 
+  //set the first time the projectile damages an opponent of its shooter.
+  //A projectile counts as one hit at most, however many bots it damages
+  bool          m_bHitOpponent;
+
   //is it dead? A dead projectile is one that has come to the end of its
   //trajectory and cycled through any explosion sequence. A dead projectile
   //can be removed from the world environment and deleted.
@@ -58,8 +62,15 @@ protected:
   Raven_Bot*            GetClosestIntersectingBot(Vector2D From,
                                                   Vector2D To)const;
 
-  std::list<Raven_Bot*> GetListOfIntersectingBots(Vector2D From,
-                                                  Vector2D To)const;
+  //the result is held in a buffer owned by the world's bot grid. It is
+  //overwritten by the next query
+  const std::vector<Raven_Bot*>& GetListOfIntersectingBots(Vector2D From,
+                                                           Vector2D To)const;
+
+  //sends the bot a message saying it has taken the damage this projectile
+  //inflicts. The shooter is credited with a hit if this is the first
+  //opponent damaged
+  void          DamageBot(Raven_Bot* pBot);
 
 
 public:
@@ -88,6 +99,7 @@ public:
                                         m_bImpacted(false),
                                         m_pWorld(world),
                                         m_iDamageInflicted(damage),
+                                        m_bHitOpponent(false),
                                         m_vOrigin(origin),
                                         m_iShooterID(ShooterID)
                 
@@ -1,7 +1,102 @@
 #include "Raven_Weapon.h"
+#include "../Raven_Bot.h"
+#include "../Raven_WeaponSystem.h"
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
+
+
+//------------------------- IncrementRounds -----------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Weapon::IncrementRounds(int num)
+{
+  m_iNumRoundsLeft+=num;
+  Clamp(m_iNumRoundsLeft, 0, m_iMaxRoundsCarried);
+
+  if (m_pOwner) m_pOwner->GetWeaponSys()->InventoryChanged();
+}
+
+//------------------------ DecrementNumRounds ---------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Weapon::DecrementNumRounds()
+{
+  if (m_iNumRoundsLeft>0)
+  {
+    --m_iNumRoundsLeft;
+
+    if (m_pOwner) m_pOwner->GetWeaponSys()->InventoryChanged();
+  }
+}
 
 
 Vector2D Raven_Weapon::getVectorPrecision(double precision) {
 	return Vector2D(RandInRange(-5*precision/100, 5*precision/100), RandInRange(-5*precision/100, 5*precision/100)); 
 }
+
+
+//the surfaces baked so far, by weapon type and by the resolution and
+//tolerance they were baked with. Shared by all the worlds
+typedef std::tuple<unsigned int, int, double> SurfaceKey;
+
+static std::map<SurfaceKey, FuzzySurface> BakedSurfaces;
+static std::mutex                        BakedSurfacesMutex;
+
+//----------------------- BakeDesirabilitySurface -----------------------------
+//
+//  every weapon of a type has the same rules, so the surface is baked once
+//  and shared. A surface which could not be baked within the tolerance
+//  would skew the choice of weapon, so it is kept only to remember that
+//  and the weapons go on evaluating their rules
+//-----------------------------------------------------------------------------
+const FuzzySurface* Raven_Weapon::BakeDesirabilitySurface(unsigned int  type,
+                                                          FuzzyProgram& desirability)
+{
+  if (!script->Params().Weapon_UseFuzzySurfaces) return NULL;
+
+  const SurfaceKey key(type,
+                       script->Params().Weapon_FuzzySurfaceResolution,
+                       script->Params().Weapon_FuzzySurfaceTolerance);
+
+  std::lock_guard<std::mutex> lock(BakedSurfacesMutex);
+
+  FuzzySurface& surface = BakedSurfaces[key];
+
+  if (!surface.isBaked())
+  {
+    surface.Bake(desirability, std::get<1>(key), std::get<2>(key));
+  }
+
+  if (surface.MaxError() > std::get<2>(key)) return NULL;
+
+  return &surface;
+}
+
+//---------------------------- BakeFuzzySurface -------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Weapon::BakeFuzzySurface(unsigned int type, AddFuzzyRulesFunc AddFuzzyRules)
+{
+  FuzzyModule fm;
+
+  FuzzyProgram desirability = AddFuzzyRules(fm);
+
+  BakeDesirabilitySurface(type, desirability);
+}
+
+//------------------------- EvaluateDesirability ------------------------------
+//-----------------------------------------------------------------------------
+double Raven_Weapon::EvaluateDesirability(const double* inputs)
+{
+  if (m_pDesirabilitySurface)
+  {
+    return m_pDesirabilitySurface->Evaluate(inputs[0],
+                                            m_DesirabilityProgram.NumInputs() > 1 ? inputs[1] : 0.0);
+  }
+
+  double desirability;
+
+  m_DesirabilityProgram.Evaluate(inputs, &desirability);
+
+  return desirability;
+}
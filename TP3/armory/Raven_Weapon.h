@@ -11,12 +11,13 @@
 //-----------------------------------------------------------------------------
 #include <vector>
 
-#include "2d/Vector2D.h"
-#include "time/CrudeTimer.h"
+#include "2D/Vector2D.h"
+#include "Time/CrudeTimer.h"
 #include "misc/utils.h"
 #include "../lua/Raven_Scriptor.h"
 #include "../Raven_Bot.h"
-#include "Fuzzy/FuzzyModule.h"
+#include "fuzzy/FuzzyModule.h"
+#include "fuzzy/FuzzySurface.h"
 
 
 
@@ -37,6 +38,11 @@ protected:
   //set for inferring desirability.
   FuzzyModule   m_FuzzyModule;
 
+  //the rules of the module giving the desirability and the precision,
+  //compiled by InitializeFuzzyModule. Cheaper to evaluate than the module
+  FuzzyProgram  m_DesirabilityProgram;
+  FuzzyProgram  m_PrecisionProgram;
+
   //amount of ammo carried for this weapon
   unsigned int  m_iNumRoundsLeft;
 
@@ -63,6 +69,10 @@ protected:
   //the max speed of the projectile this weapon fires
   double         m_dMaxProjectileSpeed;
 
+  //the desirability program sampled into a lookup table, shared by all the
+  //weapons of the same type. NULL unless Weapon_UseFuzzySurfaces is set
+  const FuzzySurface* m_pDesirabilitySurface;
+
   //The number of times a weapon can be discharges depends on its rate of fire.
   //This method returns true if the weapon is able to be discharged at the 
   //current time. (called from ShootAt() )
@@ -75,6 +85,17 @@ protected:
   //variables and rule base.
   virtual void  InitializeFuzzyModule() = 0;
 
+  //returns the surface shared by the weapons of the given type, baking it
+  //from their desirability program first if need be. Returns NULL unless
+  //Weapon_UseFuzzySurfaces is set and the surface deviates from the program
+  //by no more than Weapon_FuzzySurfaceTolerance
+  static const FuzzySurface* BakeDesirabilitySurface(unsigned int  type,
+                                                     FuzzyProgram& desirability);
+
+  //the desirability for the inputs of m_DesirabilityProgram, looked up in
+  //the surface when there is one
+  double        EvaluateDesirability(const double* inputs);
+
   //vertex buffers containing the weapon's geometry
   std::vector<Vector2D>   m_vecWeaponVB;
   std::vector<Vector2D>   m_vecWeaponVBTrans;
@@ -96,7 +117,8 @@ public:
                                  m_iMaxRoundsCarried(MaxRoundsCarried),
                                  m_dLastDesirabilityScore(0),
                                  m_dIdealRange(IdealRange),
-                                 m_dMaxProjectileSpeed(ProjectileSpeed)
+                                 m_dMaxProjectileSpeed(ProjectileSpeed),
+                                 m_pDesirabilitySurface(NULL)
   {  
     m_dTimeNextAvailable = Clock->GetCurrentTime();
   }
@@ -104,6 +126,17 @@ public:
 
   virtual ~Raven_Weapon(){}
 
+  //each type of weapon has a static AddFuzzyRules which sets up the fuzzy
+  //variables and rules of the type in fm, and returns the rules giving the
+  //desirability, compiled. Its InitializeFuzzyModule adds them to the
+  //weapon's own module
+  typedef FuzzyProgram (*AddFuzzyRulesFunc)(FuzzyModule& fm);
+
+  //bakes the desirability surface shared by the weapons of the given type
+  //from the rules added by AddFuzzyRules (see Weapon_UseFuzzySurfaces in
+  //Params.lua)
+  static void BakeFuzzySurface(unsigned int type, AddFuzzyRulesFunc AddFuzzyRules);
+
   //this method aims the weapon at the given target by rotating the weapon's
   //owner's facing direction (constrained by the bot's turning rate). It returns  
   //true if the weapon is directly facing the target.
@@ -131,12 +164,16 @@ public:
 
   //returns the number of rounds remaining for the weapon
   int           NumRoundsRemaining()const{return m_iNumRoundsLeft;}
-  void          DecrementNumRounds(){if (m_iNumRoundsLeft>0) --m_iNumRoundsLeft;}
+  void          DecrementNumRounds();
   void          IncrementRounds(int num); 
   unsigned int  GetType()const{return m_iType;}
   double         GetIdealRange()const{return m_dIdealRange;}
 
   Vector2D getVectorPrecision(double precision);
+
+  //used by the tool checking the surfaces against the fuzzy rules
+  FuzzyProgram&       GetDesirabilityProgram(){return m_DesirabilityProgram;}
+  const FuzzySurface* GetDesirabilitySurface()const{return m_pDesirabilitySurface;}
 };
 
 
@@ -168,12 +205,6 @@ inline bool Raven_Weapon::AimAt(Vector2D target)const
   return m_pOwner->RotateFacingTowardPosition(target);
 }
 
-//-----------------------------------------------------------------------------
-inline void Raven_Weapon::IncrementRounds(int num)
-{
-  m_iNumRoundsLeft+=num;
-  Clamp(m_iNumRoundsLeft, 0, m_iMaxRoundsCarried);
-}
 
 
 
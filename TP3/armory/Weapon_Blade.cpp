@@ -12,11 +12,11 @@
 Blade::Blade(Raven_Bot*   owner) :
 
 	Raven_Weapon(type_blade,
-		script->GetInt("Blade_DefaultRounds"),
-		script->GetInt("Blade_MaxRoundsCarried"),
-		script->GetDouble("Blade_AttackFreq"),
-		script->GetDouble("Blade_IdealRange"),
-		script->GetDouble("Blade_MaxSpeed"),
+		script->Params().Blade_DefaultRounds,
+		script->Params().Blade_MaxRoundsCarried,
+		script->Params().Blade_AttackFreq,
+		script->Params().Blade_IdealRange,
+		script->Params().Blade_MaxSpeed,
 		owner)
 {
 	//setup the vertex buffer
@@ -55,9 +55,9 @@ inline void Blade::ShootAt(Vector2D pos)
 
 		UpdateTimeWeaponIsNextAvailable();
 
-		//add a trigger to the game so that the other bots can hear this shot
-		//(provided they are within range)
-		m_pOwner->GetWorld()->GetMap()->AddSoundTrigger(m_pOwner, script->GetDouble("Blade_SoundRange"));
+		//record the noise of this shot. The game tells the bots within range
+		//about it once all the bots have been updated
+		m_pOwner->GetWorld()->AddNoise(m_pOwner, script->Params().Blade_SoundRange);
 	}
 }
 
@@ -66,32 +66,41 @@ inline void Blade::ShootAt(Vector2D pos)
 //-----------------------------------------------------------------------------
 double Blade::GetDesirability(double DistToTarget)
 {
-	m_FuzzyModule.Fuzzify("DistToTarget", DistToTarget);
+	double inputs[] = {DistToTarget};
 
-	m_dLastDesirabilityScore = m_FuzzyModule.DeFuzzify("Desirability", FuzzyModule::max_av);
+	m_dLastDesirabilityScore = EvaluateDesirability(inputs);
 
 	return m_dLastDesirabilityScore;
 }
 
-//-------------------------  InitializeFuzzyModule ----------------------------
-//
-//  set up some fuzzy variables and rules
+//------------------------------- AddFuzzyRules -------------------------------
+//-----------------------------------------------------------------------------
+FuzzyProgram Blade::AddFuzzyRules(FuzzyModule& fm)
+{
+	FuzzyVariable& DistToTarget = fm.CreateFLV("DistToTarget");
+	FzSet Target_Melee = DistToTarget.AddLeftShoulderSet("Target_Melee", 0, 40, 50);
+	FzSet Target_Close = DistToTarget.AddTriangularSet("Target_Close", 50, 75, 100);
+	FzSet Target_Far = DistToTarget.AddRightShoulderSet("Target_Far", 100, 300, 1000);
+
+	FuzzyVariable& Desirability = fm.CreateFLV("Desirability");
+	FzSet VeryDesirable = Desirability.AddRightShoulderSet("VeryDesirable", 80, 90, 100);
+	FzSet Desirable = Desirability.AddTriangularSet("Desirable", 10, 25, 30);
+	FzSet Undesirable = Desirability.AddLeftShoulderSet("Undesirable", 0, 5, 10);
+
+	fm.AddRule(Target_Melee, VeryDesirable);
+	fm.AddRule(Target_Close, Desirable);
+	fm.AddRule(Target_Far, Undesirable);
+
+	return fm.Compile({"DistToTarget"}, {"Desirability"});
+}
+
+//--------------------------- InitializeFuzzyModule ---------------------------
 //-----------------------------------------------------------------------------
 void Blade::InitializeFuzzyModule()
 {
-	FuzzyVariable& DistToTarget = m_FuzzyModule.CreateFLV("DistToTarget");
-	FzSet& Target_Melee = DistToTarget.AddLeftShoulderSet("Target_Melee", 0, 40, 50);
-	FzSet& Target_Close = DistToTarget.AddTriangularSet("Target_Close", 50, 75, 100);
-	FzSet& Target_Far = DistToTarget.AddRightShoulderSet("Target_Far", 100, 300, 1000);
-
-	FuzzyVariable& Desirability = m_FuzzyModule.CreateFLV("Desirability");
-	FzSet& VeryDesirable = Desirability.AddRightShoulderSet("VeryDesirable", 80, 90, 100);
-	FzSet& Desirable = Desirability.AddTriangularSet("Desirable", 10, 25, 30);
-	FzSet& Undesirable = Desirability.AddLeftShoulderSet("Undesirable", 0, 5, 10);
-
-	m_FuzzyModule.AddRule(Target_Melee, VeryDesirable);
-	m_FuzzyModule.AddRule(Target_Close, Desirable);
-	m_FuzzyModule.AddRule(Target_Far, Undesirable);
+	m_DesirabilityProgram = AddFuzzyRules(m_FuzzyModule);
+
+	m_pDesirabilitySurface = BakeDesirabilitySurface(m_iType, m_DesirabilityProgram);
 }
 
 
@@ -10,6 +10,8 @@ public:
 
 	Blade(Raven_Bot* owner);
 
+	static FuzzyProgram AddFuzzyRules(FuzzyModule& fm);
+
 
 	void Render();
 
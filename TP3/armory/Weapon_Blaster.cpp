@@ -12,11 +12,11 @@
 Blaster::Blaster(Raven_Bot*   owner):
 
                       Raven_Weapon(type_blaster,
-                                   script->GetInt("Blaster_DefaultRounds"),
-                                   script->GetInt("Blaster_MaxRoundsCarried"),
-                                   script->GetDouble("Blaster_FiringFreq"),
-                                   script->GetDouble("Blaster_IdealRange"),
-                                   script->GetDouble("Bolt_MaxSpeed"),
+                                   script->Params().Blaster_DefaultRounds,
+                                   script->Params().Blaster_MaxRoundsCarried,
+                                   script->Params().Blaster_FiringFreq,
+                                   script->Params().Blaster_IdealRange,
+                                   script->Params().Bolt_MaxSpeed,
                                    owner)
 {
   //setup the vertex buffer
@@ -61,9 +61,9 @@ inline void Blaster::ShootAt(Vector2D pos)
 
 		UpdateTimeWeaponIsNextAvailable();
 
-		//add a trigger to the game so that the other bots can hear this shot
-		//(provided they are within range)
-		m_pOwner->GetWorld()->GetMap()->AddSoundTrigger(m_pOwner, script->GetDouble("Blaster_SoundRange"));
+		//record the noise of this shot. The game tells the bots within range
+		//about it once all the bots have been updated
+		m_pOwner->GetWorld()->AddNoise(m_pOwner, script->Params().Blaster_SoundRange);
 	}
 }
 
@@ -75,9 +75,9 @@ inline void Blaster::ShootAt(Vector2D pos)
 double Blaster::GetDesirability(double DistToTarget)
 {
   //fuzzify distance and amount of ammo
-  m_FuzzyModule.Fuzzify("DistToTarget", DistToTarget);
+  double inputs[] = {DistToTarget};
 
-  m_dLastDesirabilityScore = m_FuzzyModule.DeFuzzify("Desirability", FuzzyModule::max_av);
+  m_dLastDesirabilityScore = EvaluateDesirability(inputs);
 
   return m_dLastDesirabilityScore;
 }
@@ -89,65 +89,74 @@ double Blaster::GetDesirability(double DistToTarget)
 double Blaster::getPrecision(double DistToTarget, Vector2D Velocity, double ViewTime)
 {
 	double velocitylenght = Velocity.Length();
-	std::cerr << "distance : " << DistToTarget << " velocity : " << Velocity.Length() << " time : " << ViewTime<<std::endl;
 	//fuzzify distance and amount of ammo
-	m_FuzzyModule.Fuzzify("DistToTarget", DistToTarget);
-	m_FuzzyModule.Fuzzify("Velocity", Velocity.Length());
-	m_FuzzyModule.Fuzzify("ViewTime", ViewTime);
-	m_Precision = m_FuzzyModule.DeFuzzify("Precision", FuzzyModule::max_av);
+	double inputs[] = {DistToTarget, Velocity.Length(), ViewTime};
+
+	m_PrecisionProgram.Evaluate(inputs, &m_Precision);
 
 
 	return m_Precision;
 }
 
 
-//----------------------- InitializeFuzzyModule -------------------------------
-//
-//  set up some fuzzy variables and rules
+//------------------------------- AddFuzzyRules -------------------------------
+//-----------------------------------------------------------------------------
+FuzzyProgram Blaster::AddFuzzyRules(FuzzyModule& fm)
+{
+	FuzzyVariable& DistToTarget = fm.CreateFLV("DistToTarget");
+
+	FzSet Target_Close = DistToTarget.AddLeftShoulderSet("Target_Close", 0, 25, 150);
+	FzSet Target_Medium = DistToTarget.AddTriangularSet("Target_Medium", 25, 150, 300);
+	FzSet Target_Far = DistToTarget.AddRightShoulderSet("Target_Far", 150, 300, 1000);
+
+	FuzzyVariable& Velocity = fm.CreateFLV("Velocity");
+	FzSet Velocity_Low = Velocity.AddLeftShoulderSet("Velocity_Low", 0, 0.2, 0.6);
+	FzSet Velocity_High = Velocity.AddRightShoulderSet("Velocity_High", 0.4, 0.7, 2);
+
+	FuzzyVariable& ViewTime = fm.CreateFLV("ViewTime");
+	FzSet ViewTime_Low = ViewTime.AddLeftShoulderSet("ViewTime_Low", 0, 50, 100);
+	FzSet ViewTime_High = ViewTime.AddRightShoulderSet("ViewTime_High", 10, 350, 10000);
+
+	FuzzyVariable& Precision = fm.CreateFLV("Precision");
+	FzSet Precision_Low = Precision.AddLeftShoulderSet("Precision_Low", 0, 10, 30);
+	FzSet Precision_Medium = Precision.AddTriangularSet("Precision_Medium", 20, 40, 60);
+
+	FzSet Precision_High = Precision.AddRightShoulderSet("Precision_High", 40, 70, 100);
+
+	fm.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_High), Precision_High);
+	fm.AddRule(FzAND(Target_Close, Velocity_Low,  ViewTime_Low), Precision_Medium);
+	fm.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_Low), Precision_Medium);
+	fm.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_High), Precision_Medium);
+	fm.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_High), Precision_High);
+	fm.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_Low), Precision_Medium);
+	fm.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_High), Precision_Medium);
+	//fm.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_Low), Precision_Low);
+	fm.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_High), Precision_Medium);
+	//fm.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_Low), Precision_Low);
+	//fm.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_High), Precision_Low);
+	//fm.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_Low), Precision_Low);
+
+  FuzzyVariable& Desirability = fm.CreateFLV("Desirability"); 
+  FzSet VeryDesirable = Desirability.AddRightShoulderSet("VeryDesirable", 50, 75, 100);
+  FzSet Desirable = Desirability.AddTriangularSet("Desirable", 25, 50, 75);
+  FzSet Undesirable = Desirability.AddLeftShoulderSet("Undesirable", 0, 25, 50);
+
+  fm.AddRule(Target_Close, Desirable);
+  fm.AddRule(Target_Medium, FzVery(Undesirable));
+  fm.AddRule(Target_Far, FzVery(Undesirable));
+
+  return fm.Compile({"DistToTarget"}, {"Desirability"});
+}
+
+//--------------------------- InitializeFuzzyModule ---------------------------
 //-----------------------------------------------------------------------------
 void Blaster::InitializeFuzzyModule()
 {
-	FuzzyVariable& DistToTarget = m_FuzzyModule.CreateFLV("DistToTarget");
-
-	FzSet& Target_Close = DistToTarget.AddLeftShoulderSet("Target_Close", 0, 25, 150);
-	FzSet& Target_Medium = DistToTarget.AddTriangularSet("Target_Medium", 25, 150, 300);
-	FzSet& Target_Far = DistToTarget.AddRightShoulderSet("Target_Far", 150, 300, 1000);
-
-	FuzzyVariable& Velocity = m_FuzzyModule.CreateFLV("Velocity");
-	FzSet& Velocity_Low = Velocity.AddLeftShoulderSet("Velocity_Low", 0, 0.2, 0.6);
-	FzSet& Velocity_High = Velocity.AddRightShoulderSet("Velocity_High", 0.4, 0.7, 2);
-
-	FuzzyVariable& ViewTime = m_FuzzyModule.CreateFLV("ViewTime");
-	FzSet& ViewTime_Low = ViewTime.AddLeftShoulderSet("ViewTime_Low", 0, 50, 100);
-	FzSet& ViewTime_High = ViewTime.AddRightShoulderSet("ViewTime_High", 10, 350, 10000);
-
-	FuzzyVariable& Precision = m_FuzzyModule.CreateFLV("Precision");
-	FzSet& Precision_Low = Precision.AddLeftShoulderSet("Precision_Low", 0, 10, 30);
-	FzSet& Precision_Medium = Precision.AddTriangularSet("Precision_Medium", 20, 40, 60);
-
-	FzSet& Precision_High = Precision.AddRightShoulderSet("Precision_High", 40, 70, 100);
-
-	m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_High), Precision_High);
-	m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_Low,  ViewTime_Low), Precision_Medium);
-	m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_Low), Precision_Medium);
-	m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_High), Precision_Medium);
-	m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_High), Precision_High);
-	m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_Low), Precision_Medium);
-	m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_High), Precision_Medium);
-	//m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_Low), Precision_Low);
-	m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_High), Precision_Medium);
-	//m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_Low), Precision_Low);
-	//m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_High), Precision_Low);
-	//m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_Low), Precision_Low);
-
-  FuzzyVariable& Desirability = m_FuzzyModule.CreateFLV("Desirability"); 
-  FzSet& VeryDesirable = Desirability.AddRightShoulderSet("VeryDesirable", 50, 75, 100);
-  FzSet& Desirable = Desirability.AddTriangularSet("Desirable", 25, 50, 75);
-  FzSet& Undesirable = Desirability.AddLeftShoulderSet("Undesirable", 0, 25, 50);
-
-  m_FuzzyModule.AddRule(Target_Close, Desirable);
-  m_FuzzyModule.AddRule(Target_Medium, FzVery(Undesirable));
-  m_FuzzyModule.AddRule(Target_Far, FzVery(Undesirable));
+  m_DesirabilityProgram = AddFuzzyRules(m_FuzzyModule);
+
+  m_pDesirabilitySurface = BakeDesirabilitySurface(m_iType, m_DesirabilityProgram);
+
+  m_PrecisionProgram = m_FuzzyModule.Compile({"DistToTarget", "Velocity", "ViewTime"}, {"Precision"});
 }
 
 
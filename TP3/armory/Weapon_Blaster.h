@@ -21,11 +21,13 @@ class Blaster : public Raven_Weapon
 private:
 
   void  InitializeFuzzyModule();
-  
+
 public:
 
   Blaster(Raven_Bot*   owner);
 
+  static FuzzyProgram AddFuzzyRules(FuzzyModule& fm);
+
 
   void  Render();
 
@@ -14,6 +14,8 @@ public:
 
 	Grenade(Raven_Bot* owner);
 
+	static FuzzyProgram AddFuzzyRules(FuzzyModule& fm);
+
 
 	void Render();
 
@@ -12,11 +12,11 @@
 RailGun::RailGun(Raven_Bot*   owner):
 
                       Raven_Weapon(type_rail_gun,
-                                   script->GetInt("RailGun_DefaultRounds"),
-                                   script->GetInt("RailGun_MaxRoundsCarried"),
-                                   script->GetDouble("RailGun_FiringFreq"),
-                                   script->GetDouble("RailGun_IdealRange"),
-                                   script->GetDouble("Slug_MaxSpeed"),
+                                   script->Params().RailGun_DefaultRounds,
+                                   script->Params().RailGun_MaxRoundsCarried,
+                                   script->Params().RailGun_FiringFreq,
+                                   script->Params().RailGun_IdealRange,
+                                   script->Params().Slug_MaxSpeed,
                                    owner)
 {
 
@@ -62,11 +62,11 @@ inline void RailGun::ShootAt(Vector2D pos)
 
 		UpdateTimeWeaponIsNextAvailable();
 
-		m_iNumRoundsLeft--;
+		DecrementNumRounds();
 
-		//add a trigger to the game so that the other bots can hear this shot
-		//(provided they are within range)
-		m_pOwner->GetWorld()->GetMap()->AddSoundTrigger(m_pOwner, script->GetDouble("RailGun_SoundRange"));
+		//record the noise of this shot. The game tells the bots within range
+		//about it once all the bots have been updated
+		m_pOwner->GetWorld()->AddNoise(m_pOwner, script->Params().RailGun_SoundRange);
 	}
 }
 
@@ -82,10 +82,9 @@ double RailGun::GetDesirability(double DistanceToTarget)
   else
   {
     //fuzzify distance and amount of ammo
-    m_FuzzyModule.Fuzzify("DistanceToTarget", DistanceToTarget);
-    m_FuzzyModule.Fuzzify("AmmoStatus", (double)m_iNumRoundsLeft);
+    double inputs[] = {DistanceToTarget, (double)m_iNumRoundsLeft};
 
-    m_dLastDesirabilityScore = m_FuzzyModule.DeFuzzify("Desirability", FuzzyModule::max_av);
+    m_dLastDesirabilityScore = EvaluateDesirability(inputs);
   }
 
   return m_dLastDesirabilityScore;
@@ -97,82 +96,91 @@ double RailGun::GetDesirability(double DistanceToTarget)
 double RailGun::getPrecision(double DistanceToTarget, Vector2D Velocity, double ViewTime)
 {
 	double velocitylenght = Velocity.Length();
-	std::cerr << "distance : " << DistanceToTarget << " velocity : " << Velocity.Length() << " time : " << ViewTime << std::endl;
 	//fuzzify distance and amount of DistanceToTarget
-	m_FuzzyModule.Fuzzify("DistanceToTarget", DistanceToTarget);
-	m_FuzzyModule.Fuzzify("Velocity", Velocity.Length());
-	m_FuzzyModule.Fuzzify("ViewTime", ViewTime);
-	m_Precision = m_FuzzyModule.DeFuzzify("Precision", FuzzyModule::max_av);
+	double inputs[] = {DistanceToTarget, Velocity.Length(), ViewTime};
+
+	m_PrecisionProgram.Evaluate(inputs, &m_Precision);
 
 
 	return m_Precision;
 }
 
 
-//----------------------- InitializeFuzzyModule -------------------------------
-//
-//  set up some fuzzy variables and rules
+//------------------------------- AddFuzzyRules -------------------------------
 //-----------------------------------------------------------------------------
-void RailGun::InitializeFuzzyModule()
+FuzzyProgram RailGun::AddFuzzyRules(FuzzyModule& fm)
 { 
 
-  FuzzyVariable& DistanceToTarget = m_FuzzyModule.CreateFLV("DistanceToTarget");
+  FuzzyVariable& DistanceToTarget = fm.CreateFLV("DistanceToTarget");
   
-  FzSet& Target_Close = DistanceToTarget.AddLeftShoulderSet("Target_Close", 0, 25, 150);
-  FzSet& Target_Medium = DistanceToTarget.AddTriangularSet("Target_Medium", 25, 150, 300);
-  FzSet& Target_Far = DistanceToTarget.AddRightShoulderSet("Target_Far", 150, 300, 1000);
+  FzSet Target_Close = DistanceToTarget.AddLeftShoulderSet("Target_Close", 0, 25, 150);
+  FzSet Target_Medium = DistanceToTarget.AddTriangularSet("Target_Medium", 25, 150, 300);
+  FzSet Target_Far = DistanceToTarget.AddRightShoulderSet("Target_Far", 150, 300, 1000);
 
-  FuzzyVariable& Desirability = m_FuzzyModule.CreateFLV("Desirability");
+  FuzzyVariable& Desirability = fm.CreateFLV("Desirability");
   
-  FzSet& VeryDesirable = Desirability.AddRightShoulderSet("VeryDesirable", 50, 75, 100);
-  FzSet& Desirable = Desirability.AddTriangularSet("Desirable", 25, 50, 75);
-  FzSet& Undesirable = Desirability.AddLeftShoulderSet("Undesirable", 0, 25, 50);
-
-  FuzzyVariable& AmmoStatus = m_FuzzyModule.CreateFLV("AmmoStatus");
-  FzSet& Ammo_Loads = AmmoStatus.AddRightShoulderSet("Ammo_Loads", 15, 30, 100);
-  FzSet& Ammo_Okay = AmmoStatus.AddTriangularSet("Ammo_Okay", 0, 15, 30);
-  FzSet& Ammo_Low = AmmoStatus.AddTriangularSet("Ammo_Low", 0, 0, 15);
-
-
-  FuzzyVariable& Velocity = m_FuzzyModule.CreateFLV("Velocity");
-  FzSet& Velocity_Low = Velocity.AddLeftShoulderSet("Velocity_Low", 0, 0.2, 0.6);
-  FzSet& Velocity_High = Velocity.AddRightShoulderSet("Velocity_High", 0.4, 0.7, 2);
-
-  FuzzyVariable& ViewTime = m_FuzzyModule.CreateFLV("ViewTime");
-  FzSet& ViewTime_Low = ViewTime.AddLeftShoulderSet("ViewTime_Low", 0, 50, 100);
-  //FzSet& ViewTime_Medium = DistToTarget.AddTriangularSet("ViewTime_Medium", 0.5, 2, 3.5);
-  FzSet& ViewTime_High = ViewTime.AddRightShoulderSet("ViewTime_High", 10, 350, 10000);
-
-  FuzzyVariable& Precision = m_FuzzyModule.CreateFLV("Precision");
-  FzSet& Precision_Low = Precision.AddLeftShoulderSet("Precision_Low", 0, 10, 30);
-  FzSet& Precision_Medium = Precision.AddTriangularSet("Precision_Medium", 20, 40, 60);
-  FzSet& Precision_High = Precision.AddRightShoulderSet("Precision_High", 40, 70, 100);
-
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_High), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_Low), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_Low), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_High), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_High), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_Low), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_High), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_Low), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_High), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_Low), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_High), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_Low), Precision_Low);
-
-
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Loads), FzFairly(Desirable));
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Okay),  FzFairly(Desirable));
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Low), Undesirable);
-
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Loads), VeryDesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Okay), Desirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Low), Desirable);
-
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Loads), FzVery(VeryDesirable));
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Okay), FzVery(VeryDesirable));
-  m_FuzzyModule.AddRule(FzAND(Target_Far, FzFairly(Ammo_Low)), VeryDesirable);
+  FzSet VeryDesirable = Desirability.AddRightShoulderSet("VeryDesirable", 50, 75, 100);
+  FzSet Desirable = Desirability.AddTriangularSet("Desirable", 25, 50, 75);
+  FzSet Undesirable = Desirability.AddLeftShoulderSet("Undesirable", 0, 25, 50);
+
+  FuzzyVariable& AmmoStatus = fm.CreateFLV("AmmoStatus");
+  FzSet Ammo_Loads = AmmoStatus.AddRightShoulderSet("Ammo_Loads", 15, 30, 100);
+  FzSet Ammo_Okay = AmmoStatus.AddTriangularSet("Ammo_Okay", 0, 15, 30);
+  FzSet Ammo_Low = AmmoStatus.AddTriangularSet("Ammo_Low", 0, 0, 15);
+
+
+  FuzzyVariable& Velocity = fm.CreateFLV("Velocity");
+  FzSet Velocity_Low = Velocity.AddLeftShoulderSet("Velocity_Low", 0, 0.2, 0.6);
+  FzSet Velocity_High = Velocity.AddRightShoulderSet("Velocity_High", 0.4, 0.7, 2);
+
+  FuzzyVariable& ViewTime = fm.CreateFLV("ViewTime");
+  FzSet ViewTime_Low = ViewTime.AddLeftShoulderSet("ViewTime_Low", 0, 50, 100);
+  //FzSet ViewTime_Medium = DistToTarget.AddTriangularSet("ViewTime_Medium", 0.5, 2, 3.5);
+  FzSet ViewTime_High = ViewTime.AddRightShoulderSet("ViewTime_High", 10, 350, 10000);
+
+  FuzzyVariable& Precision = fm.CreateFLV("Precision");
+  FzSet Precision_Low = Precision.AddLeftShoulderSet("Precision_Low", 0, 10, 30);
+  FzSet Precision_Medium = Precision.AddTriangularSet("Precision_Medium", 20, 40, 60);
+  FzSet Precision_High = Precision.AddRightShoulderSet("Precision_High", 40, 70, 100);
+
+  fm.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_High), Precision_High);
+  fm.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_Low), Precision_Medium);
+  fm.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_Low), Precision_Medium);
+  fm.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_High), Precision_High);
+  fm.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_High), Precision_High);
+  fm.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_Low), Precision_Medium);
+  fm.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_High), Precision_High);
+  fm.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_Low), Precision_Low);
+  fm.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_High), Precision_Medium);
+  fm.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_Low), Precision_Low);
+  fm.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_High), Precision_Low);
+  fm.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_Low), Precision_Low);
+
+
+  fm.AddRule(FzAND(Target_Close, Ammo_Loads), FzFairly(Desirable));
+  fm.AddRule(FzAND(Target_Close, Ammo_Okay),  FzFairly(Desirable));
+  fm.AddRule(FzAND(Target_Close, Ammo_Low), Undesirable);
+
+  fm.AddRule(FzAND(Target_Medium, Ammo_Loads), VeryDesirable);
+  fm.AddRule(FzAND(Target_Medium, Ammo_Okay), Desirable);
+  fm.AddRule(FzAND(Target_Medium, Ammo_Low), Desirable);
+
+  fm.AddRule(FzAND(Target_Far, Ammo_Loads), FzVery(VeryDesirable));
+  fm.AddRule(FzAND(Target_Far, Ammo_Okay), FzVery(VeryDesirable));
+  fm.AddRule(FzAND(Target_Far, FzFairly(Ammo_Low)), VeryDesirable);
+
+  return fm.Compile({"DistanceToTarget", "AmmoStatus"}, {"Desirability"});
+}
+
+//--------------------------- InitializeFuzzyModule ---------------------------
+//-----------------------------------------------------------------------------
+void RailGun::InitializeFuzzyModule()
+{
+  m_DesirabilityProgram = AddFuzzyRules(m_FuzzyModule);
+
+  m_pDesirabilitySurface = BakeDesirabilitySurface(m_iType, m_DesirabilityProgram);
+
+  m_PrecisionProgram = m_FuzzyModule.Compile({"DistanceToTarget", "Velocity", "ViewTime"}, {"Precision"});
 }
 
 //-------------------------------- Render -------------------------------------
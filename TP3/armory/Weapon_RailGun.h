@@ -26,6 +26,8 @@ public:
 
   RailGun(Raven_Bot* owner);
 
+  static FuzzyProgram AddFuzzyRules(FuzzyModule& fm);
+
   void  Render();
 
   void  ShootAt(Vector2D pos);
@@ -12,11 +12,11 @@
 RocketLauncher::RocketLauncher(Raven_Bot*   owner):
 
                       Raven_Weapon(type_rocket_launcher,
-                                   script->GetInt("RocketLauncher_DefaultRounds"),
-                                   script->GetInt("RocketLauncher_MaxRoundsCarried"),
-                                   script->GetDouble("RocketLauncher_FiringFreq"),
-                                   script->GetDouble("RocketLauncher_IdealRange"),
-                                   script->GetDouble("Rocket_MaxSpeed"),
+                                   script->Params().RocketLauncher_DefaultRounds,
+                                   script->Params().RocketLauncher_MaxRoundsCarried,
+                                   script->Params().RocketLauncher_FiringFreq,
+                                   script->Params().RocketLauncher_IdealRange,
+                                   script->Params().Rocket_MaxSpeed,
                                    owner)
 {
     //setup the vertex buffer
@@ -61,13 +61,13 @@ inline void RocketLauncher::ShootAt(Vector2D pos)
 		//fire off a rocket!
 		m_pOwner->GetWorld()->AddRocket(m_pOwner, pos + getVectorPrecision(precision));
 
-		m_iNumRoundsLeft--;
+		DecrementNumRounds();
 
 		UpdateTimeWeaponIsNextAvailable();
 
-		//add a trigger to the game so that the other bots can hear this shot
-		//(provided they are within range)
-		m_pOwner->GetWorld()->GetMap()->AddSoundTrigger(m_pOwner, script->GetDouble("RocketLauncher_SoundRange"));
+		//record the noise of this shot. The game tells the bots within range
+		//about it once all the bots have been updated
+		m_pOwner->GetWorld()->AddNoise(m_pOwner, script->Params().RocketLauncher_SoundRange);
 	}
 }
 
@@ -83,10 +83,9 @@ double RocketLauncher::GetDesirability(double DistToTarget)
   else
   {
     //fuzzify distance and amount of ammo
-    m_FuzzyModule.Fuzzify("DistToTarget", DistToTarget);
-    m_FuzzyModule.Fuzzify("AmmoStatus", (double)m_iNumRoundsLeft);
+    double inputs[] = {DistToTarget, (double)m_iNumRoundsLeft};
 
-    m_dLastDesirabilityScore = m_FuzzyModule.DeFuzzify("Desirability", FuzzyModule::max_av);
+    m_dLastDesirabilityScore = EvaluateDesirability(inputs);
   }
 
   return m_dLastDesirabilityScore;
@@ -98,125 +97,134 @@ double RocketLauncher::GetDesirability(double DistToTarget)
 double RocketLauncher::getPrecision(double DistToTarget, Vector2D Velocity, double ViewTime)
 {
 	double velocitylenght = Velocity.Length();
-	std::cerr << "distance : " << DistToTarget << " velocity : " << Velocity.Length() << " time : " << ViewTime << std::endl;
 	//fuzzify distance and amount of ammo
-	m_FuzzyModule.Fuzzify("DistToTarget", DistToTarget);
-	m_FuzzyModule.Fuzzify("Velocity", Velocity.Length());
-	m_FuzzyModule.Fuzzify("ViewTime", ViewTime);
-	m_Precision = m_FuzzyModule.DeFuzzify("Precision", FuzzyModule::max_av);
+	double inputs[] = {DistToTarget, Velocity.Length(), ViewTime};
+
+	m_PrecisionProgram.Evaluate(inputs, &m_Precision);
 
 
 	return m_Precision;
 }
 
-//-------------------------  InitializeFuzzyModule ----------------------------
-//
-//  set up some fuzzy variables and rules
+//------------------------------- AddFuzzyRules -------------------------------
+//-----------------------------------------------------------------------------
+FuzzyProgram RocketLauncher::AddFuzzyRules(FuzzyModule& fm)
+{
+  FuzzyVariable& DistToTarget = fm.CreateFLV("DistToTarget");
+
+  /*FzSet Target_Close = DistToTarget.AddLeftShoulderSet("Target_Close",0,25,150);
+  FzSet Target_Medium = DistToTarget.AddTriangularSet("Target_Medium",25,150,300);
+  FzSet Target_Far = DistToTarget.AddRightShoulderSet("Target_Far",150,300,1000);*/
+  FzSet Target_Melee = DistToTarget.AddLeftShoulderSet("Target_Melee", 0, 5, 10);
+  FzSet Target_Close = DistToTarget.AddLeftShoulderSet("Target_Close", 10, 25, 150);
+  FzSet Target_Medium = DistToTarget.AddTriangularSet("Target_Medium", 25, 150, 300);
+  FzSet Target_Far = DistToTarget.AddRightShoulderSet("Target_Far", 150, 300, 800);
+  FzSet Target_VeryFar = DistToTarget.AddRightShoulderSet("Target_VeryFar", 800, 950, 1000);
+
+  FuzzyVariable& Desirability = fm.CreateFLV("Desirability"); 
+  /*FzSet VeryDesirable = Desirability.AddRightShoulderSet("VeryDesirable", 50, 75, 100);
+  FzSet Desirable = Desirability.AddTriangularSet("Desirable", 25, 50, 75);
+  FzSet Undesirable = Desirability.AddLeftShoulderSet("Undesirable", 0, 25, 50);*/
+  FzSet Necessary = Desirability.AddRightShoulderSet("Necessary", 95, 97.5, 100);
+  FzSet VeryDesirable = Desirability.AddTriangularSet("VeryDesirable", 60, 75, 95);
+  FzSet Desirable = Desirability.AddTriangularSet("Desirable", 40, 50, 60);
+  FzSet Undesirable = Desirability.AddTriangularSet("Undesirable", 5, 25, 40);
+  FzSet Unthinkable = Desirability.AddLeftShoulderSet("Unthinkable", 0, 2.5, 5);
+
+  FuzzyVariable& AmmoStatus = fm.CreateFLV("AmmoStatus");
+  /*FzSet Ammo_Loads = AmmoStatus.AddRightShoulderSet("Ammo_Loads", 10, 30, 100);
+  FzSet Ammo_Okay = AmmoStatus.AddTriangularSet("Ammo_Okay", 0, 10, 30);
+  FzSet Ammo_Low = AmmoStatus.AddTriangularSet("Ammo_Low", 0, 0, 10);*/
+  FzSet Ammo_Full = AmmoStatus.AddRightShoulderSet("Ammo_Full", 45, 47.5, 50);
+  FzSet Ammo_Loads = AmmoStatus.AddTriangularSet("Ammo_Loads", 25, 30, 45);
+  FzSet Ammo_Okay = AmmoStatus.AddTriangularSet("Ammo_Okay", 10, 20, 25);
+  FzSet Ammo_Low = AmmoStatus.AddTriangularSet("Ammo_Low", 2, 3, 10);
+  FzSet Ammo_Empty = AmmoStatus.AddLeftShoulderSet("Ammo_Empty", 0, 1, 2);
+
+
+  FuzzyVariable& Velocity = fm.CreateFLV("Velocity");
+  FzSet Velocity_Low = Velocity.AddLeftShoulderSet("Velocity_Low", 0, 0.2, 0.6);
+  FzSet Velocity_High = Velocity.AddRightShoulderSet("Velocity_High", 0.4, 0.7, 2);
+
+  FuzzyVariable& ViewTime = fm.CreateFLV("ViewTime");
+  FzSet ViewTime_Low = ViewTime.AddLeftShoulderSet("ViewTime_Low", 0, 50, 100);
+  //FzSet ViewTime_Medium = DistToTarget.AddTriangularSet("ViewTime_Medium", 0.5, 2, 3.5);
+  FzSet ViewTime_High = ViewTime.AddRightShoulderSet("ViewTime_High", 10, 350, 10000);
+
+  FuzzyVariable& Precision = fm.CreateFLV("Precision");
+  FzSet Precision_Low = Precision.AddLeftShoulderSet("Precision_Low", 0, 10, 30);
+  FzSet Precision_Medium = Precision.AddTriangularSet("Precision_Medium", 20, 40, 60);
+
+  FzSet Precision_High = Precision.AddRightShoulderSet("Precision_High", 40, 70, 100);
+
+  fm.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_High), Precision_High);
+  fm.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_Low), Precision_High);
+  fm.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_Low), Precision_High);
+  fm.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_High), Precision_High);
+  fm.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_High), Precision_High);
+  fm.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_Low), Precision_High);
+  fm.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_High), Precision_Medium);
+  fm.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_Low), Precision_Low);
+  fm.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_High), Precision_Medium);
+  fm.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_Low), Precision_Medium);
+  fm.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_High), Precision_Medium);
+  fm.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_Low), Precision_Low);
+  fm.AddRule(FzAND(Target_VeryFar, Velocity_Low, ViewTime_High), Precision_Medium);
+  fm.AddRule(FzAND(Target_VeryFar, Velocity_Low, ViewTime_Low), Precision_Low);
+  fm.AddRule(FzAND(Target_VeryFar, Velocity_High, ViewTime_High), Precision_Low);
+  fm.AddRule(FzAND(Target_VeryFar, Velocity_High, ViewTime_Low), Precision_Low);
+
+  fm.AddRule(FzAND(Target_Melee, Ammo_Full), Unthinkable);
+  fm.AddRule(FzAND(Target_Melee, Ammo_Loads), Unthinkable);
+  fm.AddRule(FzAND(Target_Melee, Ammo_Okay), Unthinkable);
+  fm.AddRule(FzAND(Target_Melee, Ammo_Low), Unthinkable);
+  fm.AddRule(FzAND(Target_Melee, Ammo_Empty), Unthinkable);
+
+  /*fm.AddRule(FzAND(Target_Close, Ammo_Loads), Undesirable);
+  fm.AddRule(FzAND(Target_Close, Ammo_Okay), Undesirable);
+  fm.AddRule(FzAND(Target_Close, Ammo_Low), Undesirable);*/
+  fm.AddRule(FzAND(Target_Close, Ammo_Full), Undesirable);
+  fm.AddRule(FzAND(Target_Close, Ammo_Loads), Undesirable);
+  fm.AddRule(FzAND(Target_Close, Ammo_Okay), Undesirable);
+  fm.AddRule(FzAND(Target_Close, Ammo_Low), Unthinkable);
+  fm.AddRule(FzAND(Target_Close, Ammo_Empty), Unthinkable);
+
+  /*fm.AddRule(FzAND(Target_Medium, Ammo_Loads), VeryDesirable);
+  fm.AddRule(FzAND(Target_Medium, Ammo_Okay), VeryDesirable);
+  fm.AddRule(FzAND(Target_Medium, Ammo_Low), Desirable);*/
+  fm.AddRule(FzAND(Target_Medium, Ammo_Full), Necessary);
+  fm.AddRule(FzAND(Target_Medium, Ammo_Loads), Necessary);
+  fm.AddRule(FzAND(Target_Medium, Ammo_Okay), VeryDesirable);
+  fm.AddRule(FzAND(Target_Medium, Ammo_Low), Desirable);
+  fm.AddRule(FzAND(Target_Medium, Ammo_Empty), Undesirable);
+
+  /*fm.AddRule(FzAND(Target_Far, Ammo_Loads), Desirable);
+  fm.AddRule(FzAND(Target_Far, Ammo_Okay), Undesirable);
+  fm.AddRule(FzAND(Target_Far, Ammo_Low), Undesirable);*/
+  fm.AddRule(FzAND(Target_Far, Ammo_Full), VeryDesirable);
+  fm.AddRule(FzAND(Target_Far, Ammo_Loads), Desirable);
+  fm.AddRule(FzAND(Target_Far, Ammo_Okay), Desirable);
+  fm.AddRule(FzAND(Target_Far, Ammo_Low), Undesirable);
+  fm.AddRule(FzAND(Target_Far, Ammo_Empty), Undesirable);
+
+  fm.AddRule(FzAND(Target_VeryFar, Ammo_Full), Undesirable);
+  fm.AddRule(FzAND(Target_VeryFar, Ammo_Loads), Undesirable);
+  fm.AddRule(FzAND(Target_VeryFar, Ammo_Okay), Undesirable);
+  fm.AddRule(FzAND(Target_VeryFar, Ammo_Low), Unthinkable);
+  fm.AddRule(FzAND(Target_VeryFar, Ammo_Empty), Unthinkable);
+
+  return fm.Compile({"DistToTarget", "AmmoStatus"}, {"Desirability"});
+}
+
+//--------------------------- InitializeFuzzyModule ---------------------------
 //-----------------------------------------------------------------------------
 void RocketLauncher::InitializeFuzzyModule()
 {
-  FuzzyVariable& DistToTarget = m_FuzzyModule.CreateFLV("DistToTarget");
-
-  /*FzSet& Target_Close = DistToTarget.AddLeftShoulderSet("Target_Close",0,25,150);
-  FzSet& Target_Medium = DistToTarget.AddTriangularSet("Target_Medium",25,150,300);
-  FzSet& Target_Far = DistToTarget.AddRightShoulderSet("Target_Far",150,300,1000);*/
-  FzSet& Target_Melee = DistToTarget.AddLeftShoulderSet("Target_Melee", 0, 5, 10);
-  FzSet& Target_Close = DistToTarget.AddLeftShoulderSet("Target_Close", 10, 25, 150);
-  FzSet& Target_Medium = DistToTarget.AddTriangularSet("Target_Medium", 25, 150, 300);
-  FzSet& Target_Far = DistToTarget.AddRightShoulderSet("Target_Far", 150, 300, 800);
-  FzSet& Target_VeryFar = DistToTarget.AddRightShoulderSet("Target_VeryFar", 800, 950, 1000);
-
-  FuzzyVariable& Desirability = m_FuzzyModule.CreateFLV("Desirability"); 
-  /*FzSet& VeryDesirable = Desirability.AddRightShoulderSet("VeryDesirable", 50, 75, 100);
-  FzSet& Desirable = Desirability.AddTriangularSet("Desirable", 25, 50, 75);
-  FzSet& Undesirable = Desirability.AddLeftShoulderSet("Undesirable", 0, 25, 50);*/
-  FzSet& Necessary = Desirability.AddRightShoulderSet("Necessary", 95, 97.5, 100);
-  FzSet& VeryDesirable = Desirability.AddTriangularSet("VeryDesirable", 60, 75, 95);
-  FzSet& Desirable = Desirability.AddTriangularSet("Desirable", 40, 50, 60);
-  FzSet& Undesirable = Desirability.AddTriangularSet("Undesirable", 5, 25, 40);
-  FzSet& Unthinkable = Desirability.AddLeftShoulderSet("Unthinkable", 0, 2.5, 5);
-
-  FuzzyVariable& AmmoStatus = m_FuzzyModule.CreateFLV("AmmoStatus");
-  /*FzSet& Ammo_Loads = AmmoStatus.AddRightShoulderSet("Ammo_Loads", 10, 30, 100);
-  FzSet& Ammo_Okay = AmmoStatus.AddTriangularSet("Ammo_Okay", 0, 10, 30);
-  FzSet& Ammo_Low = AmmoStatus.AddTriangularSet("Ammo_Low", 0, 0, 10);*/
-  FzSet& Ammo_Full = AmmoStatus.AddRightShoulderSet("Ammo_Full", 45, 47.5, 50);
-  FzSet& Ammo_Loads = AmmoStatus.AddTriangularSet("Ammo_Loads", 25, 30, 45);
-  FzSet& Ammo_Okay = AmmoStatus.AddTriangularSet("Ammo_Okay", 10, 20, 25);
-  FzSet& Ammo_Low = AmmoStatus.AddTriangularSet("Ammo_Low", 2, 3, 10);
-  FzSet& Ammo_Empty = AmmoStatus.AddLeftShoulderSet("Ammo_Empty", 0, 1, 2);
-
-
-  FuzzyVariable& Velocity = m_FuzzyModule.CreateFLV("Velocity");
-  FzSet& Velocity_Low = Velocity.AddLeftShoulderSet("Velocity_Low", 0, 0.2, 0.6);
-  FzSet& Velocity_High = Velocity.AddRightShoulderSet("Velocity_High", 0.4, 0.7, 2);
-
-  FuzzyVariable& ViewTime = m_FuzzyModule.CreateFLV("ViewTime");
-  FzSet& ViewTime_Low = ViewTime.AddLeftShoulderSet("ViewTime_Low", 0, 50, 100);
-  //FzSet& ViewTime_Medium = DistToTarget.AddTriangularSet("ViewTime_Medium", 0.5, 2, 3.5);
-  FzSet& ViewTime_High = ViewTime.AddRightShoulderSet("ViewTime_High", 10, 350, 10000);
-
-  FuzzyVariable& Precision = m_FuzzyModule.CreateFLV("Precision");
-  FzSet& Precision_Low = Precision.AddLeftShoulderSet("Precision_Low", 0, 10, 30);
-  FzSet& Precision_Medium = Precision.AddTriangularSet("Precision_Medium", 20, 40, 60);
-
-  FzSet& Precision_High = Precision.AddRightShoulderSet("Precision_High", 40, 70, 100);
-
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_High), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_Low), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_Low), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_High), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_High), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_Low), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_High), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_Low), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_High), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_Low), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_High), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_Low), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_VeryFar, Velocity_Low, ViewTime_High), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_VeryFar, Velocity_Low, ViewTime_Low), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_VeryFar, Velocity_High, ViewTime_High), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_VeryFar, Velocity_High, ViewTime_Low), Precision_Low);
-
-  m_FuzzyModule.AddRule(FzAND(Target_Melee, Ammo_Full), Unthinkable);
-  m_FuzzyModule.AddRule(FzAND(Target_Melee, Ammo_Loads), Unthinkable);
-  m_FuzzyModule.AddRule(FzAND(Target_Melee, Ammo_Okay), Unthinkable);
-  m_FuzzyModule.AddRule(FzAND(Target_Melee, Ammo_Low), Unthinkable);
-  m_FuzzyModule.AddRule(FzAND(Target_Melee, Ammo_Empty), Unthinkable);
-
-  /*m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Loads), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Okay), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Low), Undesirable);*/
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Full), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Loads), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Okay), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Low), Unthinkable);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Empty), Unthinkable);
-
-  /*m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Loads), VeryDesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Okay), VeryDesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Low), Desirable);*/
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Full), Necessary);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Loads), Necessary);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Okay), VeryDesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Low), Desirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Empty), Undesirable);
-
-  /*m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Loads), Desirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Okay), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Low), Undesirable);*/
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Full), VeryDesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Loads), Desirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Okay), Desirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Low), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Empty), Undesirable);
-
-  m_FuzzyModule.AddRule(FzAND(Target_VeryFar, Ammo_Full), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_VeryFar, Ammo_Loads), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_VeryFar, Ammo_Okay), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_VeryFar, Ammo_Low), Unthinkable);
-  m_FuzzyModule.AddRule(FzAND(Target_VeryFar, Ammo_Empty), Unthinkable);
+  m_DesirabilityProgram = AddFuzzyRules(m_FuzzyModule);
+
+  m_pDesirabilitySurface = BakeDesirabilitySurface(m_iType, m_DesirabilityProgram);
+
+  m_PrecisionProgram = m_FuzzyModule.Compile({"DistToTarget", "Velocity", "ViewTime"}, {"Precision"});
 }
 
 
@@ -25,6 +25,8 @@ public:
 
   RocketLauncher(Raven_Bot* owner);
 
+  static FuzzyProgram AddFuzzyRules(FuzzyModule& fm);
+
 
   void Render();
 
@@ -13,15 +13,15 @@
 ShotGun::ShotGun(Raven_Bot*   owner):
 
                       Raven_Weapon(type_shotgun,
-                                   script->GetInt("ShotGun_DefaultRounds"),
-                                   script->GetInt("ShotGun_MaxRoundsCarried"),
-                                   script->GetDouble("ShotGun_FiringFreq"),
-                                   script->GetDouble("ShotGun_IdealRange"),
-                                   script->GetDouble("Pellet_MaxSpeed"),
+                                   script->Params().ShotGun_DefaultRounds,
+                                   script->Params().ShotGun_MaxRoundsCarried,
+                                   script->Params().ShotGun_FiringFreq,
+                                   script->Params().ShotGun_IdealRange,
+                                   script->Params().Pellet_MaxSpeed,
                                    owner),
 
-            m_iNumBallsInShell(script->GetInt("ShotGun_NumBallsInShell")),
-            m_dSpread(script->GetDouble("ShotGun_Spread"))
+            m_iNumBallsInShell(script->Params().ShotGun_NumBallsInShell),
+            m_dSpread(script->Params().ShotGun_Spread)
 {
 
     //setup the vertex buffer
@@ -82,13 +82,13 @@ inline void ShotGun::ShootAt(Vector2D pos)
 
 		}
 
-		m_iNumRoundsLeft--;
+		DecrementNumRounds();
 
 		UpdateTimeWeaponIsNextAvailable();
 
-		//add a trigger to the game so that the other bots can hear this shot
-		//(provided they are within range)
-		m_pOwner->GetWorld()->GetMap()->AddSoundTrigger(m_pOwner, script->GetDouble("ShotGun_SoundRange"));
+		//record the noise of this shot. The game tells the bots within range
+		//about it once all the bots have been updated
+		m_pOwner->GetWorld()->AddNoise(m_pOwner, script->Params().ShotGun_SoundRange);
 	  }
 }
 
@@ -104,10 +104,9 @@ inline double ShotGun::GetDesirability(double DistToTarget)
   else
   {
     //fuzzify distance and amount of ammo
-    m_FuzzyModule.Fuzzify("DistanceToTarget", DistToTarget);
-    m_FuzzyModule.Fuzzify("AmmoStatus", (double)m_iNumRoundsLeft);
+    double inputs[] = {DistToTarget, (double)m_iNumRoundsLeft};
 
-    m_dLastDesirabilityScore = m_FuzzyModule.DeFuzzify("Desirability", FuzzyModule::max_av);
+    m_dLastDesirabilityScore = EvaluateDesirability(inputs);
   }
 
   return m_dLastDesirabilityScore;
@@ -119,81 +118,90 @@ inline double ShotGun::GetDesirability(double DistToTarget)
 double ShotGun::getPrecision(double DistanceToTarget, Vector2D Velocity, double ViewTime)
 {
 	double velocitylenght = Velocity.Length();
-	std::cerr << "distance : " << DistanceToTarget << " velocity : " << Velocity.Length() << " time : " << ViewTime << std::endl;
 	//fuzzify distance and amount of DistanceToTarget
-	m_FuzzyModule.Fuzzify("DistanceToTarget", DistanceToTarget);
-	m_FuzzyModule.Fuzzify("Velocity", Velocity.Length());
-	m_FuzzyModule.Fuzzify("ViewTime", ViewTime);
-	m_Precision = m_FuzzyModule.DeFuzzify("Precision", FuzzyModule::max_av);
+	double inputs[] = {DistanceToTarget, Velocity.Length(), ViewTime};
+
+	m_PrecisionProgram.Evaluate(inputs, &m_Precision);
 
 
 	return m_Precision;
 }
 
 
-//--------------------------- InitializeFuzzyModule ---------------------------
-//
-//  set up some fuzzy variables and rules
+//------------------------------- AddFuzzyRules -------------------------------
 //-----------------------------------------------------------------------------
-void ShotGun::InitializeFuzzyModule()
+FuzzyProgram ShotGun::AddFuzzyRules(FuzzyModule& fm)
 {  
-  FuzzyVariable& DistanceToTarget = m_FuzzyModule.CreateFLV("DistanceToTarget");
+  FuzzyVariable& DistanceToTarget = fm.CreateFLV("DistanceToTarget");
 
-  FzSet& Target_Close = DistanceToTarget.AddLeftShoulderSet("Target_Close", 0, 25, 150);
-  FzSet& Target_Medium = DistanceToTarget.AddTriangularSet("Target_Medium", 25, 150, 300);
-  FzSet& Target_Far = DistanceToTarget.AddRightShoulderSet("Target_Far", 150, 300, 1000);
+  FzSet Target_Close = DistanceToTarget.AddLeftShoulderSet("Target_Close", 0, 25, 150);
+  FzSet Target_Medium = DistanceToTarget.AddTriangularSet("Target_Medium", 25, 150, 300);
+  FzSet Target_Far = DistanceToTarget.AddRightShoulderSet("Target_Far", 150, 300, 1000);
 
-  FuzzyVariable& Desirability = m_FuzzyModule.CreateFLV("Desirability");
+  FuzzyVariable& Desirability = fm.CreateFLV("Desirability");
   
-  FzSet& VeryDesirable = Desirability.AddRightShoulderSet("VeryDesirable", 50, 75, 100);
-  FzSet& Desirable = Desirability.AddTriangularSet("Desirable", 25, 50, 75);
-  FzSet& Undesirable = Desirability.AddLeftShoulderSet("Undesirable", 0, 25, 50);
-
-  FuzzyVariable& AmmoStatus = m_FuzzyModule.CreateFLV("AmmoStatus");
-  FzSet& Ammo_Loads = AmmoStatus.AddRightShoulderSet("Ammo_Loads", 30, 60, 100);
-  FzSet& Ammo_Okay = AmmoStatus.AddTriangularSet("Ammo_Okay", 0, 30, 60);
-  FzSet& Ammo_Low = AmmoStatus.AddTriangularSet("Ammo_Low", 0, 0, 30);
-
-  FuzzyVariable& Velocity = m_FuzzyModule.CreateFLV("Velocity");
-  FzSet& Velocity_Low = Velocity.AddLeftShoulderSet("Velocity_Low", 0, 0.2, 0.6);
-  FzSet& Velocity_High = Velocity.AddRightShoulderSet("Velocity_High", 0.4, 0.7, 2);
-
-  FuzzyVariable& ViewTime = m_FuzzyModule.CreateFLV("ViewTime");
-  FzSet& ViewTime_Low = ViewTime.AddLeftShoulderSet("ViewTime_Low", 0, 50, 100);
-  //FzSet& ViewTime_Medium = DistToTarget.AddTriangularSet("ViewTime_Medium", 0.5, 2, 3.5);
-  FzSet& ViewTime_High = ViewTime.AddRightShoulderSet("ViewTime_High", 10, 350, 10000);
-
-  FuzzyVariable& Precision = m_FuzzyModule.CreateFLV("Precision");
-  FzSet& Precision_Low = Precision.AddLeftShoulderSet("Precision_Low", 0, 10, 30);
-  FzSet& Precision_Medium = Precision.AddTriangularSet("Precision_Medium", 20, 40, 60);
-
-  FzSet& Precision_High = Precision.AddRightShoulderSet("Precision_High", 40, 70, 100);
-
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_High), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_Low), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_Low), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_High), Precision_High);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_High), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_Low), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_High), Precision_Medium);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_Low), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_High), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_Low), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_High), Precision_Low);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_Low), Precision_Low);
-
-
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Loads), VeryDesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Okay), VeryDesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Close, Ammo_Low), VeryDesirable);
-
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Loads), VeryDesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Okay), Desirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Medium, Ammo_Low), Undesirable);
-
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Loads), Desirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Okay), Undesirable);
-  m_FuzzyModule.AddRule(FzAND(Target_Far, Ammo_Low), Undesirable);
+  FzSet VeryDesirable = Desirability.AddRightShoulderSet("VeryDesirable", 50, 75, 100);
+  FzSet Desirable = Desirability.AddTriangularSet("Desirable", 25, 50, 75);
+  FzSet Undesirable = Desirability.AddLeftShoulderSet("Undesirable", 0, 25, 50);
+
+  FuzzyVariable& AmmoStatus = fm.CreateFLV("AmmoStatus");
+  FzSet Ammo_Loads = AmmoStatus.AddRightShoulderSet("Ammo_Loads", 30, 60, 100);
+  FzSet Ammo_Okay = AmmoStatus.AddTriangularSet("Ammo_Okay", 0, 30, 60);
+  FzSet Ammo_Low = AmmoStatus.AddTriangularSet("Ammo_Low", 0, 0, 30);
+
+  FuzzyVariable& Velocity = fm.CreateFLV("Velocity");
+  FzSet Velocity_Low = Velocity.AddLeftShoulderSet("Velocity_Low", 0, 0.2, 0.6);
+  FzSet Velocity_High = Velocity.AddRightShoulderSet("Velocity_High", 0.4, 0.7, 2);
+
+  FuzzyVariable& ViewTime = fm.CreateFLV("ViewTime");
+  FzSet ViewTime_Low = ViewTime.AddLeftShoulderSet("ViewTime_Low", 0, 50, 100);
+  //FzSet ViewTime_Medium = DistToTarget.AddTriangularSet("ViewTime_Medium", 0.5, 2, 3.5);
+  FzSet ViewTime_High = ViewTime.AddRightShoulderSet("ViewTime_High", 10, 350, 10000);
+
+  FuzzyVariable& Precision = fm.CreateFLV("Precision");
+  FzSet Precision_Low = Precision.AddLeftShoulderSet("Precision_Low", 0, 10, 30);
+  FzSet Precision_Medium = Precision.AddTriangularSet("Precision_Medium", 20, 40, 60);
+
+  FzSet Precision_High = Precision.AddRightShoulderSet("Precision_High", 40, 70, 100);
+
+  fm.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_High), Precision_High);
+  fm.AddRule(FzAND(Target_Close, Velocity_Low, ViewTime_Low), Precision_High);
+  fm.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_Low), Precision_High);
+  fm.AddRule(FzAND(Target_Close, Velocity_High, ViewTime_High), Precision_High);
+  fm.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_High), Precision_Medium);
+  fm.AddRule(FzAND(Target_Medium, Velocity_Low, ViewTime_Low), Precision_Low);
+  fm.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_High), Precision_Medium);
+  fm.AddRule(FzAND(Target_Medium, Velocity_High, ViewTime_Low), Precision_Low);
+  fm.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_High), Precision_Low);
+  fm.AddRule(FzAND(Target_Far, Velocity_Low, ViewTime_Low), Precision_Low);
+  fm.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_High), Precision_Low);
+  fm.AddRule(FzAND(Target_Far, Velocity_High, ViewTime_Low), Precision_Low);
+
+
+  fm.AddRule(FzAND(Target_Close, Ammo_Loads), VeryDesirable);
+  fm.AddRule(FzAND(Target_Close, Ammo_Okay), VeryDesirable);
+  fm.AddRule(FzAND(Target_Close, Ammo_Low), VeryDesirable);
+
+  fm.AddRule(FzAND(Target_Medium, Ammo_Loads), VeryDesirable);
+  fm.AddRule(FzAND(Target_Medium, Ammo_Okay), Desirable);
+  fm.AddRule(FzAND(Target_Medium, Ammo_Low), Undesirable);
+
+  fm.AddRule(FzAND(Target_Far, Ammo_Loads), Desirable);
+  fm.AddRule(FzAND(Target_Far, Ammo_Okay), Undesirable);
+  fm.AddRule(FzAND(Target_Far, Ammo_Low), Undesirable);
+
+  return fm.Compile({"DistanceToTarget", "AmmoStatus"}, {"Desirability"});
+}
+
+//--------------------------- InitializeFuzzyModule ---------------------------
+//-----------------------------------------------------------------------------
+void ShotGun::InitializeFuzzyModule()
+{
+  m_DesirabilityProgram = AddFuzzyRules(m_FuzzyModule);
+
+  m_pDesirabilitySurface = BakeDesirabilitySurface(m_iType, m_DesirabilityProgram);
+
+  m_PrecisionProgram = m_FuzzyModule.Compile({"DistanceToTarget", "Velocity", "ViewTime"}, {"Precision"});
 }
 
 //-------------------------------- Render -------------------------------------
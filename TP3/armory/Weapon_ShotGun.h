@@ -32,6 +32,8 @@ public:
 
   ShotGun(Raven_Bot* owner);
 
+  static FuzzyProgram AddFuzzyRules(FuzzyModule& fm);
+
   void  Render();
 
   void  ShootAt(Vector2D pos);
@@ -3,12 +3,13 @@
 #include "Raven_Goal_Types.h"
 #include "../Raven_WeaponSystem.h"
 #include "../Raven_ObjectEnumerations.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 #include "misc/Stream_Utility_Functions.h"
 #include "Raven_Feature.h"
+#include "Raven_FeatureCache.h"
 
 
-#include "debug/DebugConsole.h"
+#include "Debug/DebugConsole.h"
 
 //------------------ CalculateDesirability ------------------------------------
 //
@@ -25,8 +26,8 @@ double AttackTargetGoal_Evaluator::CalculateDesirability(Raven_Bot* pBot)
      const double Tweaker = 1.0;
 
      Desirability = Tweaker *
-                    Raven_Feature::Health(pBot) * 
-                    Raven_Feature::TotalWeaponStrength(pBot);
+                    pBot->GetFeatures()->Health() * 
+                    pBot->GetFeatures()->TotalWeaponStrength();
 
      //bias the value according to the personality of the bot
      Desirability *= m_dCharacterBias;
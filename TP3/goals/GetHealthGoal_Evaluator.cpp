@@ -4,6 +4,7 @@
 #include "Raven_Goal_Types.h"
 #include "misc/Stream_Utility_Functions.h"
 #include "Raven_Feature.h"
+#include "Raven_FeatureCache.h"
 
 //#include "Goal_DodgeSideToSide.h"
 
@@ -13,7 +14,7 @@
 double GetHealthGoal_Evaluator::CalculateDesirability(Raven_Bot* pBot)
 {
   //first grab the distance to the closest instance of a health item
-  double Distance = Raven_Feature::DistanceToItem(pBot, type_health);
+  double Distance = pBot->GetFeatures()->DistanceToItem(type_health);
 
   //if the distance feature is rated with a value of 1 it means that the
   //item is either not present on the map or too far away to be worth 
@@ -30,8 +31,8 @@ double GetHealthGoal_Evaluator::CalculateDesirability(Raven_Bot* pBot)
     //the desirability of finding a health item is proportional to the amount
     //of health remaining and inversely proportional to the distance from the
     //nearest instance of a health item.
-    double Desirability = Tweaker * (1-Raven_Feature::Health(pBot)) / 
-                        (Raven_Feature::DistanceToItem(pBot, type_health));
+    double Desirability = Tweaker * (1-pBot->GetFeatures()->Health()) / 
+                        (pBot->GetFeatures()->DistanceToItem(type_health));
  
     //ensure the value is in the range 0 to 1
     Clamp(Desirability, 0, 1);
@@ -6,6 +6,7 @@
 #include "Goal_Think.h"
 #include "Raven_Goal_Types.h"
 #include "Raven_Feature.h"
+#include "Raven_FeatureCache.h"
 
 #include "../Raven_WeaponSystem.h"
 
@@ -22,7 +23,7 @@ double GetWeaponCacheGoal_Evaluator::CalculateDesirability(Raven_Bot* pBot)
 		return 0;
 	}
 	// On rcupre la distance avec la cache la plus proche
-	double Distance = Raven_Feature::DistanceToItem(pBot, type_team_cache);
+	double Distance = pBot->GetFeatures()->DistanceToItem(type_team_cache);
 
 	//if the distance feature is rated with a value of 1 it means that the
 	//item is either not present on the map or too far away to be worth 
@@ -39,7 +40,7 @@ double GetWeaponCacheGoal_Evaluator::CalculateDesirability(Raven_Bot* pBot)
 		double Health;
 		std::vector<double> WeaponsStrength;
 
-		Health = Raven_Feature::Health(pBot);
+		Health = pBot->GetFeatures()->Health();
 
 		int missingWeapons = 0;
 		for (int weapon = type_rail_gun; weapon < type_blaster; ++weapon) {
@@ -6,6 +6,7 @@
 #include "Goal_Think.h"
 #include "Raven_Goal_Types.h"
 #include "Raven_Feature.h"
+#include "Raven_FeatureCache.h"
 
 #include <string>
 
@@ -17,7 +18,7 @@
 double GetWeaponGoal_Evaluator::CalculateDesirability(Raven_Bot* pBot)
 {
   //grab the distance to the closest instance of the weapon type
-  double Distance = Raven_Feature::DistanceToItem(pBot, m_iWeaponType);
+  double Distance = pBot->GetFeatures()->DistanceToItem(m_iWeaponType);
 
   //if the distance feature is rated with a value of 1 it means that the
   //item is either not present on the map or too far away to be worth 
@@ -33,10 +34,9 @@ double GetWeaponGoal_Evaluator::CalculateDesirability(Raven_Bot* pBot)
 
     double Health, WeaponStrength;
 
-    Health = Raven_Feature::Health(pBot);
+    Health = pBot->GetFeatures()->Health();
 
-    WeaponStrength = Raven_Feature::IndividualWeaponStrength(pBot,
-                                                             m_iWeaponType);
+    WeaponStrength = pBot->GetFeatures()->IndividualWeaponStrength(m_iWeaponType);
     
     double Desirability = (Tweaker * Health * (1-WeaponStrength)) / Distance;
 
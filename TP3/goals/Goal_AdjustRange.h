@@ -10,7 +10,7 @@
 //  Desc:   
 //
 //-----------------------------------------------------------------------------
-#include "goals/Goal.h"
+#include "Goals/Goal.h"
 #include "Raven_Goal_Types.h"
 #include "../Raven_Bot.h"
 
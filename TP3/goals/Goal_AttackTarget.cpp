@@ -36,20 +36,20 @@ void Goal_AttackTarget::Activate()
     Vector2D dummy;
     if (m_pOwner->canStepLeft(dummy) || m_pOwner->canStepRight(dummy))
     {
-      AddSubgoal(new Goal_DodgeSideToSide(m_pOwner));
+      AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_DodgeSideToSide(m_pOwner));
     }
 
     //if not able to strafe, head directly at the target's position 
     else
     {
-      AddSubgoal(new Goal_SeekToPosition(m_pOwner, m_pOwner->GetTargetBot()->Pos()));
+      AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_SeekToPosition(m_pOwner, m_pOwner->GetTargetBot()->Pos()));
     }
   }
 
   //if the target is not visible, go hunt it.
   else
   {
-    AddSubgoal(new Goal_HuntTarget(m_pOwner));
+    AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_HuntTarget(m_pOwner));
   }
 }
 
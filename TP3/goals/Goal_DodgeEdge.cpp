@@ -1,15 +1,15 @@
 #include "Goal_DodgeEdge.h"
-#include "..\Raven_Bot.h"
+#include "../Raven_Bot.h"
 #include "Raven_Goal_Types.h"
-#include "..\Raven_SteeringBehaviors.h"
-#include "time/CrudeTimer.h"
-#include "..\constants.h"
+#include "../Raven_SteeringBehaviors.h"
+#include "Time/CrudeTimer.h"
+#include "../constants.h"
 #include "../navigation/Raven_PathPlanner.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 #include "../lua/Raven_Scriptor.h"
 
 
-#include "debug/DebugConsole.h"
+#include "Debug/DebugConsole.h"
 
 
 
@@ -42,14 +42,14 @@ void Goal_DodgeEdge::Activate()
   {
     case NavGraphEdge::swim:
     {
-      m_pOwner->SetMaxSpeed(script->GetDouble("Bot_MaxSwimmingSpeed"));
+      m_pOwner->SetMaxSpeed(script->Params().Bot_MaxSwimmingSpeed);
     }
    
     break;
    
     case NavGraphEdge::crawl:
     {
-       m_pOwner->SetMaxSpeed(script->GetDouble("Bot_MaxCrawlingSpeed"));
+       m_pOwner->SetMaxSpeed(script->Params().Bot_MaxCrawlingSpeed);
     }
    
     break;
@@ -171,7 +171,7 @@ void Goal_DodgeEdge::Terminate()
   m_pOwner->GetSteering()->ArriveOff();
 
   //return max speed back to normal
-  m_pOwner->SetMaxSpeed(script->GetDouble("Bot_MaxSpeed"));
+  m_pOwner->SetMaxSpeed(script->Params().Bot_MaxSpeed);
 }
 
 //----------------------------- Render ----------------------------------------
@@ -6,7 +6,7 @@
 #include "Goal_NegotiateDoor.h"
 #include "Goal_DodgeEdge.h"
 #include "Goal_DodgeSideToSide.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 
 
 
@@ -15,8 +15,10 @@
 Goal_DodgePath::
 Goal_DodgePath(Raven_Bot*          pBot,
                 std::list<PathEdge> path):Goal_Composite<Raven_Bot>(pBot, goal_dodge_path),
-                                                  m_Path(path), m_bClockwise(true)
+                                                  m_bClockwise(true), m_bEven(false)
 {
+  //take the edges over rather than copy them
+  m_Path.swap(path);
 }
 
 
@@ -44,20 +46,20 @@ void Goal_DodgePath::Activate()
 		  // Question E : Go towards the next edge, modified on left or right
 		  if (m_bClockwise)
 		  {
-			  AddSubgoal(new Goal_DodgeEdge(m_pOwner, edge, m_Path.empty(), m_bClockwise));
+			  AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_DodgeEdge(m_pOwner, edge, m_Path.empty(), m_bClockwise));
 			  m_bClockwise = !m_bClockwise;
 			  m_bEven = !m_bEven;
 		  }
 		  else
 		  {
-			  AddSubgoal(new Goal_DodgeEdge(m_pOwner, edge, m_Path.empty(), m_bClockwise));
+			  AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_DodgeEdge(m_pOwner, edge, m_Path.empty(), m_bClockwise));
 			  m_bClockwise = !m_bClockwise;
 			  m_bEven = !m_bEven;
 		  }
 	  }
 	  else
 	  {
-		  AddSubgoal(new Goal_TraverseEdge(m_pOwner, edge, m_Path.empty()));
+		  AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_TraverseEdge(m_pOwner, edge, m_Path.empty()));
 		  m_bEven = !m_bEven;
 	  }
     }
@@ -67,7 +69,7 @@ void Goal_DodgePath::Activate()
   case NavGraphEdge::goes_through_door:
     {
       //also add a goal that is able to handle opening the door
-      AddSubgoal(new Goal_NegotiateDoor(m_pOwner, edge, m_Path.empty()));
+      AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_NegotiateDoor(m_pOwner, edge, m_Path.empty()));
     }
 
     break;
@@ -4,7 +4,8 @@
 #include "../Raven_Game.h"
 #include "../Raven_Map.h"
 #include "Messaging/Telegram.h"
-#include "..\Raven_Messages.h"
+#include "../Raven_Messages.h"
+#include "../lua/Raven_Scriptor.h"
 
 #include "Goal_SeekToPosition.h"
 #include "Goal_FollowPath.h"
@@ -29,13 +30,17 @@ void Goal_Explore::Activate()
     m_bDestinationIsSet = true;
   }
 
-  //and request a path to that position
-  m_pOwner->GetPathPlanner()->RequestPathToPosition(m_CurrentDestination);
+  //and request a path to that position. Any place will do to explore, so
+  //the search gives up on one that is a long way round to get to
+  double MaxCost = script->Params().Bot_ExploreMaxDetour *
+                   Vec2DDistance(m_pOwner->Pos(), m_CurrentDestination);
+
+  m_pOwner->GetPathPlanner()->RequestPathToFarPosition(m_CurrentDestination, MaxCost);
 
   //the bot may have to wait a few update cycles before a path is calculated
   //so for appearances sake it simple ARRIVES at the destination until a path
   //has been found
-  AddSubgoal(new Goal_SeekToPosition(m_pOwner, m_CurrentDestination));
+  AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_SeekToPosition(m_pOwner, m_CurrentDestination));
 }
 
 //------------------------------ Process -------------------------------------
@@ -69,7 +74,7 @@ bool Goal_Explore::HandleMessage(const Telegram& msg)
       //clear any existing goals
       RemoveAllSubgoals();
 
-      AddSubgoal(new Goal_FollowPath(m_pOwner,
+      AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_FollowPath(m_pOwner,
                                      m_pOwner->GetPathPlanner()->GetPath()));
 
       return true; //msg handled
@@ -5,7 +5,7 @@
 #include "Goal_TraverseEdge.h"
 #include "Goal_NegotiateDoor.h"
 #include "Goal_DodgeEdge.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 
 
 
@@ -13,9 +13,10 @@
 //-----------------------------------------------------------------------------
 Goal_FollowPath::
 Goal_FollowPath(Raven_Bot*          pBot,
-                std::list<PathEdge> path):Goal_Composite<Raven_Bot>(pBot, goal_follow_path),
-                                                  m_Path(path)
+                std::list<PathEdge> path):Goal_Composite<Raven_Bot>(pBot, goal_follow_path)
 {
+  //take the edges over rather than copy them
+  m_Path.swap(path);
 }
 
 
@@ -38,7 +39,7 @@ void Goal_FollowPath::Activate()
   {
   case NavGraphEdge::normal:
     {
-      AddSubgoal(new Goal_TraverseEdge(m_pOwner, edge, m_Path.empty()));
+      AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_TraverseEdge(m_pOwner, edge, m_Path.empty()));
     }
 
     break;
@@ -46,7 +47,7 @@ void Goal_FollowPath::Activate()
   case NavGraphEdge::goes_through_door:
     {
       //also add a goal that is able to handle opening the door
-      AddSubgoal(new Goal_NegotiateDoor(m_pOwner, edge, m_Path.empty()));
+      AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_NegotiateDoor(m_pOwner, edge, m_Path.empty()));
     }
 
     break;
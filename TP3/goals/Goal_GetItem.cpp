@@ -4,7 +4,7 @@
 #include "../navigation/Raven_PathPlanner.h"
 
 #include "Messaging/Telegram.h"
-#include "..\Raven_Messages.h"
+#include "../Raven_Messages.h"
 
 #include "Goal_Wander.h"
 #include "Goal_FollowPath.h"
@@ -49,7 +49,7 @@ void Goal_GetItem::Activate()
 
   //the bot may have to wait a few update cycles before a path is calculated
   //so for appearances sake it just wanders
-  AddSubgoal(new Goal_Wander(m_pOwner));
+  AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_Wander(m_pOwner));
 
 }
 
@@ -90,7 +90,7 @@ bool Goal_GetItem::HandleMessage(const Telegram& msg)
       RemoveAllSubgoals();
 
 	  // Question E: Dodge path when looking for ammo or health
-      AddSubgoal(new Goal_DodgePath(m_pOwner,
+      AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_DodgePath(m_pOwner,
                                      m_pOwner->GetPathPlanner()->GetPath()));
 
       //get the pointer to the item
@@ -5,7 +5,7 @@
 #include "Goals/Goal_Composite.h"
 #include "Raven_Goal_Types.h"
 #include "../Raven_Bot.h"
-#include "triggers/trigger.h"
+#include "Triggers/Trigger.h"
 
 
 //helper function to change an item type enumeration into a goal type
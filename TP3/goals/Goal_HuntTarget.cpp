@@ -1,13 +1,13 @@
 #include "Goal_HuntTarget.h"
 #include "Goal_Explore.h"
 #include "Goal_MoveToPosition.h"
-#include "..\Raven_Bot.h"
-#include "..\Raven_SteeringBehaviors.h"
+#include "../Raven_Bot.h"
+#include "../Raven_SteeringBehaviors.h"
 
 
 
-#include "debug/DebugConsole.h"
-#include "misc/cgdi.h"
+#include "Debug/DebugConsole.h"
+#include "misc/Cgdi.h"
 
 //---------------------------- Initialize -------------------------------------
 //-----------------------------------------------------------------------------  
@@ -31,13 +31,13 @@ void Goal_HuntTarget::Activate()
     //map locations
     if (lrp.isZero() || m_pOwner->isAtPosition(lrp))
     {
-      AddSubgoal(new Goal_Explore(m_pOwner));
+      AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_Explore(m_pOwner));
     }
 
     //else move to the LRP
     else
     {
-      AddSubgoal(new Goal_MoveToPosition(m_pOwner, lrp));
+      AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_MoveToPosition(m_pOwner, lrp));
     }
   }
 
@@ -1,6 +1,6 @@
 #include "Goal_MoveToItem.h"
 
-#include "..\Raven_Bot.h"
+#include "../Raven_Bot.h"
 #include "..\Raven_NavModule.h"
 
 #include "Raven_GoalQ.h"
@@ -4,7 +4,7 @@
 #include "../navigation/Raven_PathPlanner.h"
 #include "Messaging/Telegram.h"
 #include "../Raven_Messages.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 
 #include "Goal_SeekToPosition.h"
 #include "Goal_FollowPath.h"
@@ -28,7 +28,7 @@ void Goal_MoveToPosition::Activate()
   //that the path planning request has succeeded/failed
   if (m_pOwner->GetPathPlanner()->RequestPathToPosition(m_vDestination))
   {
-    AddSubgoal(new Goal_SeekToPosition(m_pOwner, m_vDestination));
+    AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_SeekToPosition(m_pOwner, m_vDestination));
   }
 }
 
@@ -65,7 +65,7 @@ bool Goal_MoveToPosition::HandleMessage(const Telegram& msg)
       //clear any existing goals
       RemoveAllSubgoals();
 
-      AddSubgoal(new Goal_FollowPath(m_pOwner,
+      AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_FollowPath(m_pOwner,
                                      m_pOwner->GetPathPlanner()->GetPath()));
 
       return true; //msg handled
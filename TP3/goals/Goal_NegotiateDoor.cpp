@@ -1,6 +1,6 @@
 #include "Goal_NegotiateDoor.h"
-#include "..\Raven_Bot.h"
-#include "..\Raven_Game.h"
+#include "../Raven_Bot.h"
+#include "../Raven_Game.h"
 #include "../navigation/Raven_PathPlanner.h"
 
 
@@ -8,7 +8,7 @@
 #include "Goal_TraverseEdge.h"
 
 
-#include "debug/DebugConsole.h"
+#include "Debug/DebugConsole.h"
 
 
 
@@ -42,14 +42,14 @@ void Goal_NegotiateDoor::Activate()
   //be added in reverse order.
   
   //first the goal to traverse the edge that passes through the door
-  AddSubgoal(new Goal_TraverseEdge(m_pOwner, m_PathEdge, m_bLastEdgeInPath));
+  AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_TraverseEdge(m_pOwner, m_PathEdge, m_bLastEdgeInPath));
 
   //next, the goal that will move the bot to the beginning of the edge that
   //passes through the door
-  AddSubgoal(new Goal_MoveToPosition(m_pOwner, m_PathEdge.Source()));
+  AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_MoveToPosition(m_pOwner, m_PathEdge.Source()));
   
   //finally, the Goal that will direct the bot to the location of the switch
-  AddSubgoal(new Goal_MoveToPosition(m_pOwner, posSw));
+  AddSubgoal(new (m_pOwner->GetGoalArena()) Goal_MoveToPosition(m_pOwner, posSw));
 }
 
 
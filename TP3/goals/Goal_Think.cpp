@@ -139,7 +139,7 @@ bool Goal_Think::notPresent(unsigned int GoalType)const
 
 void Goal_Think::AddGoal_MoveToPosition(Vector2D pos)
 {
-  AddSubgoal( new Goal_MoveToPosition(m_pOwner, pos));
+  AddSubgoal( new (m_pOwner->GetGoalArena()) Goal_MoveToPosition(m_pOwner, pos));
 }
 
 void Goal_Think::AddGoal_Explore()
@@ -147,7 +147,7 @@ void Goal_Think::AddGoal_Explore()
   if (notPresent(goal_explore))
   {
     RemoveAllSubgoals();
-    AddSubgoal( new Goal_Explore(m_pOwner));
+    AddSubgoal( new (m_pOwner->GetGoalArena()) Goal_Explore(m_pOwner));
   }
 }
 
@@ -156,7 +156,7 @@ void Goal_Think::AddGoal_GetItem(unsigned int ItemType)
   if (notPresent(ItemTypeToGoalType(ItemType)))
   {
     RemoveAllSubgoals();
-    AddSubgoal( new Goal_GetItem(m_pOwner, ItemType));
+    AddSubgoal( new (m_pOwner->GetGoalArena()) Goal_GetItem(m_pOwner, ItemType));
   }
 }
 
@@ -165,7 +165,7 @@ void Goal_Think::AddGoal_AttackTarget()
   if (notPresent(goal_attack_target))
   {
     RemoveAllSubgoals();
-    AddSubgoal( new Goal_AttackTarget(m_pOwner));
+    AddSubgoal( new (m_pOwner->GetGoalArena()) Goal_AttackTarget(m_pOwner));
   }
 }
 
@@ -173,7 +173,7 @@ void Goal_Think::AddGoal_AttackTarget()
 //-----------------------------------------------------------------------------
 void Goal_Think::QueueGoal_MoveToPosition(Vector2D pos)
 {
-   m_SubGoals.push_back(new Goal_MoveToPosition(m_pOwner, pos));
+   m_SubGoals.push_back(new (m_pOwner->GetGoalArena()) Goal_MoveToPosition(m_pOwner, pos));
 }
 
 
@@ -195,7 +195,7 @@ void Goal_Think::RenderEvaluations(int left, int top)const
 
 void Goal_Think::Render()
 {
-  std::list<Goal<Raven_Bot>*>::iterator curG;
+  SubgoalList::iterator curG;
   for (curG=m_SubGoals.begin(); curG != m_SubGoals.end(); ++curG)
   {
     (*curG)->Render();
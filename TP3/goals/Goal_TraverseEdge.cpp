@@ -1,15 +1,15 @@
 #include "Goal_TraverseEdge.h"
-#include "..\Raven_Bot.h"
+#include "../Raven_Bot.h"
 #include "Raven_Goal_Types.h"
-#include "..\Raven_SteeringBehaviors.h"
-#include "time/CrudeTimer.h"
-#include "..\constants.h"
+#include "../Raven_SteeringBehaviors.h"
+#include "Time/CrudeTimer.h"
+#include "../constants.h"
 #include "../navigation/Raven_PathPlanner.h"
-#include "misc/cgdi.h"
+#include "misc/Cgdi.h"
 #include "../lua/Raven_Scriptor.h"
 
 
-#include "debug/DebugConsole.h"
+#include "Debug/DebugConsole.h"
 
 
 
@@ -40,14 +40,14 @@ void Goal_TraverseEdge::Activate()
   {
     case NavGraphEdge::swim:
     {
-      m_pOwner->SetMaxSpeed(script->GetDouble("Bot_MaxSwimmingSpeed"));
+      m_pOwner->SetMaxSpeed(script->Params().Bot_MaxSwimmingSpeed);
     }
    
     break;
    
     case NavGraphEdge::crawl:
     {
-       m_pOwner->SetMaxSpeed(script->GetDouble("Bot_MaxCrawlingSpeed"));
+       m_pOwner->SetMaxSpeed(script->Params().Bot_MaxCrawlingSpeed);
     }
    
     break;
@@ -139,7 +139,7 @@ void Goal_TraverseEdge::Terminate()
   m_pOwner->GetSteering()->ArriveOff();
 
   //return max speed back to normal
-  m_pOwner->SetMaxSpeed(script->GetDouble("Bot_MaxSpeed"));
+  m_pOwner->SetMaxSpeed(script->Params().Bot_MaxSpeed);
 }
 
 //----------------------------- Render ----------------------------------------
@@ -3,7 +3,7 @@
 #pragma warning (disable:4786)
 
 #include "Goals/Goal.h"
-#include "2d/Vector2D.h"
+#include "2D/Vector2D.h"
 #include "../navigation/Raven_PathPlanner.h"
 #include "../navigation/PathEdge.h"
 
@@ -0,0 +1,99 @@
+#include "Raven_FeatureCache.h"
+
+#include <cassert>
+
+#include "Raven_Feature.h"
+#include "../Raven_Bot.h"
+#include "../Raven_Game.h"
+#include "../Raven_Map.h"
+#include "../Raven_WeaponSystem.h"
+#include "../navigation/Raven_PathPlanner.h"
+
+
+//------------------------------ ctor -----------------------------------------
+//-----------------------------------------------------------------------------
+Raven_FeatureCache::Raven_FeatureCache(Raven_Bot* pOwner):m_pOwner(pOwner)
+{
+  m_TotalWeaponStrength.bKnown = false;
+
+  for (int t=0; t<NumItemTypes; ++t)
+  {
+    m_WeaponStrengths[t].bKnown = false;
+    m_Distances[t].bKnown       = false;
+  }
+}
+
+//------------------------------ Health ---------------------------------------
+//-----------------------------------------------------------------------------
+double Raven_FeatureCache::Health()const
+{
+  return Raven_Feature::Health(m_pOwner);
+}
+
+//--------------------------- DistanceToItem ----------------------------------
+//-----------------------------------------------------------------------------
+double Raven_FeatureCache::DistanceToItem(int ItemType)
+{
+  assert(ItemType >= 0 && ItemType < NumItemTypes &&
+         "<Raven_FeatureCache::DistanceToItem>: not an item type");
+
+  const Raven_Map* pMap = m_pOwner->GetWorld()->GetMap();
+
+  //a bot only goes to its own team's weapon cache
+  const int TriggerType = ItemType == type_team_cache ?
+                          pMap->GetWeaponCache(m_pOwner->EntityType())->EntityType() : ItemType;
+
+  const int          ClosestNode  = m_pOwner->GetPathPlanner()->GetClosestNodeToBot();
+  const unsigned int TriggerEpoch = pMap->GetTriggerActivityEpoch(TriggerType);
+
+  Distance& d = m_Distances[ItemType];
+
+  if (!d.bKnown || d.ClosestNode != ClosestNode || d.TriggerEpoch != TriggerEpoch)
+  {
+    d.bKnown       = true;
+    d.ClosestNode  = ClosestNode;
+    d.TriggerEpoch = TriggerEpoch;
+    d.Value        = Raven_Feature::DistanceToItem(m_pOwner, ItemType);
+  }
+
+  return d.Value;
+}
+
+//---------------------- IndividualWeaponStrength -----------------------------
+//-----------------------------------------------------------------------------
+double Raven_FeatureCache::IndividualWeaponStrength(int WeaponType)
+{
+  assert(WeaponType >= 0 && WeaponType < NumItemTypes &&
+         "<Raven_FeatureCache::IndividualWeaponStrength>: not a weapon type");
+
+  const unsigned int epoch = m_pOwner->GetWeaponSys()->GetInventoryEpoch();
+
+  WeaponStrength& ws = m_WeaponStrengths[WeaponType];
+
+  if (!ws.bKnown || ws.InventoryEpoch != epoch)
+  {
+    ws.bKnown         = true;
+    ws.InventoryEpoch = epoch;
+    ws.Value          = Raven_Feature::IndividualWeaponStrength(m_pOwner, WeaponType);
+  }
+
+  return ws.Value;
+}
+
+//------------------------ TotalWeaponStrength --------------------------------
+//-----------------------------------------------------------------------------
+double Raven_FeatureCache::TotalWeaponStrength()
+{
+  const unsigned int epoch = m_pOwner->GetWeaponSys()->GetInventoryEpoch();
+
+  WeaponStrength& ws = m_TotalWeaponStrength;
+
+  if (!ws.bKnown || ws.InventoryEpoch != epoch)
+  {
+    ws.bKnown         = true;
+    ws.InventoryEpoch = epoch;
+    ws.Value          = Raven_Feature::TotalWeaponStrength(m_pOwner);
+  }
+
+  return ws.Value;
+}
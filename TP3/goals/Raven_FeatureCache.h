@@ -0,0 +1,69 @@
+#ifndef RAVEN_FEATURE_CACHE_H
+#define RAVEN_FEATURE_CACHE_H
+//-----------------------------------------------------------------------------
+//
+//  Name:   Raven_FeatureCache.h
+//
+//  Desc:   the Raven_Feature values of one bot, each kept until something
+//          it is worked out from changes. The goal evaluators read them
+//          from here, so an arbitration that finds the bot in the same
+//          state as the last one costs a few comparisons.
+//
+//          the weapon strengths are kept until the bot's inventory epoch
+//          changes. The distance to an item is kept until the bot's
+//          closest graph node or the activity epoch of the item's triggers
+//          changes. The health is a single division, cheaper than any
+//          check, so it is not kept.
+//
+//-----------------------------------------------------------------------------
+#include "../Raven_ObjectEnumerations.h"
+
+class Raven_Bot;
+
+
+class Raven_FeatureCache
+{
+private:
+
+  enum {NumItemTypes = type_team_cache + 1};
+
+  //a value and what it was worked out from
+  struct WeaponStrength
+  {
+    bool         bKnown;
+    unsigned int InventoryEpoch;
+    double       Value;
+  };
+
+  struct Distance
+  {
+    bool         bKnown;
+    int          ClosestNode;
+    unsigned int TriggerEpoch;
+    double       Value;
+  };
+
+  Raven_Bot*      m_pOwner;
+
+  WeaponStrength  m_TotalWeaponStrength;
+
+  //by weapon type
+  WeaponStrength  m_WeaponStrengths[NumItemTypes];
+
+  //by item type
+  Distance        m_Distances[NumItemTypes];
+
+public:
+
+  Raven_FeatureCache(Raven_Bot* pOwner);
+
+  //the same values as the methods of Raven_Feature of the same names
+  double Health()const;
+  double DistanceToItem(int ItemType);
+  double IndividualWeaponStrength(int WeaponType);
+  double TotalWeaponStrength();
+};
+
+
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef RAVEN_PARAMS_H
+#define RAVEN_PARAMS_H
+//-----------------------------------------------------------------------------
+//
+//  Name:   Raven_Params.h
+//
+//  Desc:   the parameters of Params.lua used by the game, read once by
+//          Raven_Scriptor when the script is run (see Raven_Scriptor::Reload)
+//          so that the game code can use them without going through the
+//          Lua stack. The fields have the same names as the script
+//          variables.
+//
+//          access them with script->Params().Bot_MaxSpeed etc
+//-----------------------------------------------------------------------------
+#include <string>
+
+
+struct RavenParams
+{
+  //general game parameters
+  int          NumBots;
+  int          MaxSearchCyclesPerUpdateStep;
+  std::string  StartMap;
+  int          NumCellsX;
+  int          NumCellsY;
+  double       GraveLifetime;
+  double       Door_ClosedEdgeCostFactor;
+
+  //bot parameters
+  int          Bot_MaxHealth;
+  double       Bot_MaxSpeed;
+  double       Bot_Mass;
+  double       Bot_MaxForce;
+  double       Bot_MaxHeadTurnRate;
+  double       Bot_Scale;
+  double       Bot_MaxSwimmingSpeed;
+  double       Bot_MaxCrawlingSpeed;
+  double       Bot_WeaponSelectionFrequency;
+  double       Bot_GoalAppraisalUpdateFreq;
+  double       Bot_TargetingUpdateFreq;
+  double       Bot_TriggerUpdateFreq;
+  double       Bot_VisionUpdateFreq;
+  double       Bot_FOV;
+  double       Bot_ReactionTime;
+  double       Bot_AimPersistance;
+  double       Bot_AimAccuracy;
+  double       HitFlashTime;
+  double       Bot_MemorySpan;
+  double       Bot_ExploreMaxDetour;
+  bool         Bot_SmoothPathsWithFunnel;
+
+  //scheduling of the bots' thinking
+  bool         AI_UseScheduler;
+  double       AI_FrameBudget;
+
+  //steering parameters
+  double       SeparationWeight;
+  double       WallAvoidanceWeight;
+  double       WanderWeight;
+  double       SeekWeight;
+  double       ArriveWeight;
+  double       ViewDistance;
+  double       WallDetectionFeelerLength;
+
+  //giver-trigger parameters
+  double       DefaultGiverTriggerRange;
+  double       Health_RespawnDelay;
+  double       Weapon_RespawnDelay;
+
+  //weapon parameters
+  bool         Weapon_UseFuzzySurfaces;
+  int          Weapon_FuzzySurfaceResolution;
+  double       Weapon_FuzzySurfaceTolerance;
+
+  double       Blaster_FiringFreq;
+  int          Blaster_DefaultRounds;
+  int          Blaster_MaxRoundsCarried;
+  double       Blaster_IdealRange;
+  double       Blaster_SoundRange;
+  double       Bolt_MaxSpeed;
+  double       Bolt_Mass;
+  double       Bolt_MaxForce;
+  double       Bolt_Scale;
+  int          Bolt_Damage;
+  double       RocketLauncher_FiringFreq;
+  int          RocketLauncher_DefaultRounds;
+  int          RocketLauncher_MaxRoundsCarried;
+  double       RocketLauncher_IdealRange;
+  double       RocketLauncher_SoundRange;
+  double       Rocket_BlastRadius;
+  double       Rocket_MaxSpeed;
+  double       Rocket_Mass;
+  double       Rocket_MaxForce;
+  double       Rocket_Scale;
+  int          Rocket_Damage;
+  double       Rocket_ExplosionDecayRate;
+  double       RailGun_FiringFreq;
+  int          RailGun_DefaultRounds;
+  int          RailGun_MaxRoundsCarried;
+  double       RailGun_IdealRange;
+  double       RailGun_SoundRange;
+  double       Slug_MaxSpeed;
+  double       Slug_Mass;
+  double       Slug_MaxForce;
+  double       Slug_Scale;
+  double       Slug_Persistance;
+  int          Slug_Damage;
+  double       ShotGun_FiringFreq;
+  int          ShotGun_DefaultRounds;
+  int          ShotGun_MaxRoundsCarried;
+  int          ShotGun_NumBallsInShell;
+  double       ShotGun_Spread;
+  double       ShotGun_IdealRange;
+  double       ShotGun_SoundRange;
+  double       Pellet_MaxSpeed;
+  double       Pellet_Mass;
+  double       Pellet_MaxForce;
+  double       Pellet_Scale;
+  double       Pellet_Persistance;
+  int          Pellet_Damage;
+  double       Grenade_FiringFreq;
+  int          Grenade_DefaultRounds;
+  int          Grenade_MaxRoundsCarried;
+  double       Grenade_IdealRange;
+  double       Grenade_SoundRange;
+  double       Grenade_BlastRadius;
+  double       Grenade_MaxSpeed;
+  double       Grenade_Mass;
+  double       Grenade_MaxForce;
+  double       Grenade_Scale;
+  int          Grenade_Damage;
+  double       Grenade_TimeBeforeExplosion;
+  double       Blade_AttackFreq;
+  int          Blade_DefaultRounds;
+  int          Blade_MaxRoundsCarried;
+  double       Blade_IdealRange;
+  double       Blade_SoundRange;
+  double       Blade_MaxSpeed;
+  double       Blade_Mass;
+  double       Blade_MaxForce;
+  double       Blade_Scale;
+  int          Blade_Damage;
+  double       Blade_Range;
+};
+
+
+
+#endif
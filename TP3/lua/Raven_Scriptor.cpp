@@ -1,7 +1,11 @@
 #include "Raven_Scriptor.h"
 
+thread_local Raven_Scriptor* Raven_Scriptor::m_pThreadInstance = NULL;
+
 Raven_Scriptor* Raven_Scriptor::Instance()
 {
+  if (m_pThreadInstance) return m_pThreadInstance;
+
   static Raven_Scriptor instance;
 
   return &instance;
@@ -10,6 +14,139 @@ Raven_Scriptor* Raven_Scriptor::Instance()
 
 
 Raven_Scriptor::Raven_Scriptor():Scriptor()
+{
+  Reload();
+}
+
+//------------------------------- Reload --------------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Scriptor::Reload()
 {
   RunScriptFile("Params.lua");
+
+  ReadParams();
+}
+
+//----------------------------- ReadParams ------------------------------------
+//-----------------------------------------------------------------------------
+void Raven_Scriptor::ReadParams()
+{
+  m_Params.NumBots = GetInt("NumBots");
+  m_Params.MaxSearchCyclesPerUpdateStep = GetInt("MaxSearchCyclesPerUpdateStep");
+  m_Params.StartMap = GetString("StartMap");
+  m_Params.NumCellsX = GetInt("NumCellsX");
+  m_Params.NumCellsY = GetInt("NumCellsY");
+  m_Params.GraveLifetime = GetDouble("GraveLifetime");
+  m_Params.Door_ClosedEdgeCostFactor = GetDouble("Door_ClosedEdgeCostFactor");
+
+  m_Params.Bot_MaxHealth = GetInt("Bot_MaxHealth");
+  m_Params.Bot_MaxSpeed = GetDouble("Bot_MaxSpeed");
+  m_Params.Bot_Mass = GetDouble("Bot_Mass");
+  m_Params.Bot_MaxForce = GetDouble("Bot_MaxForce");
+  m_Params.Bot_MaxHeadTurnRate = GetDouble("Bot_MaxHeadTurnRate");
+  m_Params.Bot_Scale = GetDouble("Bot_Scale");
+  m_Params.Bot_MaxSwimmingSpeed = GetDouble("Bot_MaxSwimmingSpeed");
+  m_Params.Bot_MaxCrawlingSpeed = GetDouble("Bot_MaxCrawlingSpeed");
+  m_Params.Bot_WeaponSelectionFrequency = GetDouble("Bot_WeaponSelectionFrequency");
+  m_Params.Bot_GoalAppraisalUpdateFreq = GetDouble("Bot_GoalAppraisalUpdateFreq");
+  m_Params.Bot_TargetingUpdateFreq = GetDouble("Bot_TargetingUpdateFreq");
+  m_Params.Bot_TriggerUpdateFreq = GetDouble("Bot_TriggerUpdateFreq");
+  m_Params.Bot_VisionUpdateFreq = GetDouble("Bot_VisionUpdateFreq");
+  m_Params.Bot_FOV = GetDouble("Bot_FOV");
+  m_Params.Bot_ReactionTime = GetDouble("Bot_ReactionTime");
+  m_Params.Bot_AimPersistance = GetDouble("Bot_AimPersistance");
+  m_Params.Bot_AimAccuracy = GetDouble("Bot_AimAccuracy");
+  m_Params.HitFlashTime = GetDouble("HitFlashTime");
+  m_Params.Bot_MemorySpan = GetDouble("Bot_MemorySpan");
+  m_Params.Bot_ExploreMaxDetour = GetDouble("Bot_ExploreMaxDetour");
+  m_Params.Bot_SmoothPathsWithFunnel = GetBool("Bot_SmoothPathsWithFunnel");
+
+  m_Params.AI_UseScheduler = GetBool("AI_UseScheduler");
+  m_Params.AI_FrameBudget = GetDouble("AI_FrameBudget");
+
+  m_Params.SeparationWeight = GetDouble("SeparationWeight");
+  m_Params.WallAvoidanceWeight = GetDouble("WallAvoidanceWeight");
+  m_Params.WanderWeight = GetDouble("WanderWeight");
+  m_Params.SeekWeight = GetDouble("SeekWeight");
+  m_Params.ArriveWeight = GetDouble("ArriveWeight");
+  m_Params.ViewDistance = GetDouble("ViewDistance");
+  m_Params.WallDetectionFeelerLength = GetDouble("WallDetectionFeelerLength");
+
+  m_Params.DefaultGiverTriggerRange = GetDouble("DefaultGiverTriggerRange");
+  m_Params.Health_RespawnDelay = GetDouble("Health_RespawnDelay");
+  m_Params.Weapon_RespawnDelay = GetDouble("Weapon_RespawnDelay");
+
+  m_Params.Weapon_UseFuzzySurfaces = GetBool("Weapon_UseFuzzySurfaces");
+  m_Params.Weapon_FuzzySurfaceResolution = GetInt("Weapon_FuzzySurfaceResolution");
+  m_Params.Weapon_FuzzySurfaceTolerance = GetDouble("Weapon_FuzzySurfaceTolerance");
+
+  m_Params.Blaster_FiringFreq = GetDouble("Blaster_FiringFreq");
+  m_Params.Blaster_DefaultRounds = GetInt("Blaster_DefaultRounds");
+  m_Params.Blaster_MaxRoundsCarried = GetInt("Blaster_MaxRoundsCarried");
+  m_Params.Blaster_IdealRange = GetDouble("Blaster_IdealRange");
+  m_Params.Blaster_SoundRange = GetDouble("Blaster_SoundRange");
+  m_Params.Bolt_MaxSpeed = GetDouble("Bolt_MaxSpeed");
+  m_Params.Bolt_Mass = GetDouble("Bolt_Mass");
+  m_Params.Bolt_MaxForce = GetDouble("Bolt_MaxForce");
+  m_Params.Bolt_Scale = GetDouble("Bolt_Scale");
+  m_Params.Bolt_Damage = GetInt("Bolt_Damage");
+  m_Params.RocketLauncher_FiringFreq = GetDouble("RocketLauncher_FiringFreq");
+  m_Params.RocketLauncher_DefaultRounds = GetInt("RocketLauncher_DefaultRounds");
+  m_Params.RocketLauncher_MaxRoundsCarried = GetInt("RocketLauncher_MaxRoundsCarried");
+  m_Params.RocketLauncher_IdealRange = GetDouble("RocketLauncher_IdealRange");
+  m_Params.RocketLauncher_SoundRange = GetDouble("RocketLauncher_SoundRange");
+  m_Params.Rocket_BlastRadius = GetDouble("Rocket_BlastRadius");
+  m_Params.Rocket_MaxSpeed = GetDouble("Rocket_MaxSpeed");
+  m_Params.Rocket_Mass = GetDouble("Rocket_Mass");
+  m_Params.Rocket_MaxForce = GetDouble("Rocket_MaxForce");
+  m_Params.Rocket_Scale = GetDouble("Rocket_Scale");
+  m_Params.Rocket_Damage = GetInt("Rocket_Damage");
+  m_Params.Rocket_ExplosionDecayRate = GetDouble("Rocket_ExplosionDecayRate");
+  m_Params.RailGun_FiringFreq = GetDouble("RailGun_FiringFreq");
+  m_Params.RailGun_DefaultRounds = GetInt("RailGun_DefaultRounds");
+  m_Params.RailGun_MaxRoundsCarried = GetInt("RailGun_MaxRoundsCarried");
+  m_Params.RailGun_IdealRange = GetDouble("RailGun_IdealRange");
+  m_Params.RailGun_SoundRange = GetDouble("RailGun_SoundRange");
+  m_Params.Slug_MaxSpeed = GetDouble("Slug_MaxSpeed");
+  m_Params.Slug_Mass = GetDouble("Slug_Mass");
+  m_Params.Slug_MaxForce = GetDouble("Slug_MaxForce");
+  m_Params.Slug_Scale = GetDouble("Slug_Scale");
+  m_Params.Slug_Persistance = GetDouble("Slug_Persistance");
+  m_Params.Slug_Damage = GetInt("Slug_Damage");
+  m_Params.ShotGun_FiringFreq = GetDouble("ShotGun_FiringFreq");
+  m_Params.ShotGun_DefaultRounds = GetInt("ShotGun_DefaultRounds");
+  m_Params.ShotGun_MaxRoundsCarried = GetInt("ShotGun_MaxRoundsCarried");
+  m_Params.ShotGun_NumBallsInShell = GetInt("ShotGun_NumBallsInShell");
+  m_Params.ShotGun_Spread = GetDouble("ShotGun_Spread");
+  m_Params.ShotGun_IdealRange = GetDouble("ShotGun_IdealRange");
+  m_Params.ShotGun_SoundRange = GetDouble("ShotGun_SoundRange");
+  m_Params.Pellet_MaxSpeed = GetDouble("Pellet_MaxSpeed");
+  m_Params.Pellet_Mass = GetDouble("Pellet_Mass");
+  m_Params.Pellet_MaxForce = GetDouble("Pellet_MaxForce");
+  m_Params.Pellet_Scale = GetDouble("Pellet_Scale");
+  m_Params.Pellet_Persistance = GetDouble("Pellet_Persistance");
+  m_Params.Pellet_Damage = GetInt("Pellet_Damage");
+  m_Params.Grenade_FiringFreq = GetDouble("Grenade_FiringFreq");
+  m_Params.Grenade_DefaultRounds = GetInt("Grenade_DefaultRounds");
+  m_Params.Grenade_MaxRoundsCarried = GetInt("Grenade_MaxRoundsCarried");
+  m_Params.Grenade_IdealRange = GetDouble("Grenade_IdealRange");
+  m_Params.Grenade_SoundRange = GetDouble("Grenade_SoundRange");
+  m_Params.Grenade_BlastRadius = GetDouble("Grenade_BlastRadius");
+  m_Params.Grenade_MaxSpeed = GetDouble("Grenade_MaxSpeed");
+  m_Params.Grenade_Mass = GetDouble("Grenade_Mass");
+  m_Params.Grenade_MaxForce = GetDouble("Grenade_MaxForce");
+  m_Params.Grenade_Scale = GetDouble("Grenade_Scale");
+  m_Params.Grenade_Damage = GetInt("Grenade_Damage");
+  m_Params.Grenade_TimeBeforeExplosion = GetDouble("Grenade_TimeBeforeExplosion");
+  m_Params.Blade_AttackFreq = GetDouble("Blade_AttackFreq");
+  m_Params.Blade_DefaultRounds = GetInt("Blade_DefaultRounds");
+  m_Params.Blade_MaxRoundsCarried = GetInt("Blade_MaxRoundsCarried");
+  m_Params.Blade_IdealRange = GetDouble("Blade_IdealRange");
+  m_Params.Blade_SoundRange = GetDouble("Blade_SoundRange");
+  m_Params.Blade_MaxSpeed = GetDouble("Blade_MaxSpeed");
+  m_Params.Blade_Mass = GetDouble("Blade_Mass");
+  m_Params.Blade_MaxForce = GetDouble("Blade_MaxForce");
+  m_Params.Blade_Scale = GetDouble("Blade_Scale");
+  m_Params.Blade_Damage = GetInt("Blade_Damage");
+  m_Params.Blade_Range = GetDouble("Blade_Range");
 }
\ No newline at end of file
@@ -9,7 +9,8 @@
 //
 //  Desc:   A Singleton Scriptor class for use with the Raven project
 //-----------------------------------------------------------------------------
-#include "Script/scriptor.h"
+#include "script/Scriptor.h"
+#include "lua/Raven_Params.h"
 
 
 
@@ -18,6 +19,18 @@
 class Raven_Scriptor : public Scriptor
 {
 private:
+
+  //the values of the script variables, read when the script is run
+  RavenParams m_Params;
+
+  //copies the script variables into m_Params
+  void ReadParams();
+
+  //when set, the instance returned by Instance() for the calling thread.
+  //Each Raven_World has its own Lua state (see WorldContext)
+  static thread_local Raven_Scriptor* m_pThreadInstance;
+
+  friend class Raven_World;
   
   Raven_Scriptor();
 
@@ -29,6 +42,13 @@ public:
 
   static Raven_Scriptor* Instance();
 
+  const RavenParams& Params()const{return m_Params;}
+
+  //runs Params.lua again and refreshes the parameters. Objects which copied
+  //a parameter when they were created (bots, weapons...) keep the old value
+  //until they are recreated
+  void Reload();
+
 };
 
 #endif
@@ -4,10 +4,10 @@
 #include "constants.h"
 #include "misc/utils.h"
 #include "Time/PrecisionTimer.h"
-#include "Resource.h"
-#include "misc/windowutils.h"
+#include "resource.h"
+#include "misc/WindowUtils.h"
 #include "misc/Cgdi.h"
-#include "debug/DebugConsole.h"
+#include "Debug/DebugConsole.h"
 #include "Raven_UserOptions.h"
 #include "Raven_Game.h"
 #include "lua/Raven_Scriptor.h"
@@ -267,14 +267,14 @@ LRESULT CALLBACK WindowProc (HWND   hwnd,
 
     case WM_LBUTTONDOWN:
     {
-      g_pRaven->ClickLeftMouseButton(MAKEPOINTS(lParam));
+      g_pRaven->ClickLeftMouseButton(POINTStoVector(MAKEPOINTS(lParam)));
     }
     
     break;
 
    case WM_RBUTTONDOWN:
     {
-      g_pRaven->ClickRightMouseButton(MAKEPOINTS(lParam));
+      g_pRaven->ClickRightMouseButton(POINTStoVector(MAKEPOINTS(lParam)));
     }
     
     break;
@@ -10,7 +10,7 @@
 //          planner in the creation of paths. 
 //
 //-----------------------------------------------------------------------------
-#include "2d/vector2D.h"
+#include "2D/Vector2D.h"
 
 class PathEdge
 {
@@ -25,15 +25,20 @@ private:
 
   int      m_iDoorID;
 
+  //the distance from the edge to the nearest wall, 0 if it is not known
+  double   m_dClearance;
+
 public:
   
   PathEdge(Vector2D Source,
            Vector2D Destination,
            int      Behavior,
-           int      DoorID = 0):m_vSource(Source),
-                                m_vDestination(Destination),
-                                m_iBehavior(Behavior),
-                                m_iDoorID(DoorID)
+           int      DoorID = 0,
+           double   Clearance = 0):m_vSource(Source),
+                                   m_vDestination(Destination),
+                                   m_iBehavior(Behavior),
+                                   m_iDoorID(DoorID),
+                                   m_dClearance(Clearance)
   {}
 
   Vector2D Destination()const{return m_vDestination;}
@@ -44,6 +49,8 @@ public:
 
   int      DoorID()const{return m_iDoorID;}
   int      Behavior()const{return m_iBehavior;}
+
+  double   Clearance()const{return m_dClearance;}
 };
 
 
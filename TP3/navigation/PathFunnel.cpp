@@ -0,0 +1,237 @@
+#include "PathFunnel.h"
+#include "Graph/GraphEdgeTypes.h"
+#include "misc/utils.h"
+
+#include <vector>
+#include <cmath>
+
+
+typedef std::list<PathEdge> Path;
+
+
+//the segment a path must cross at one of its nodes. Left is on the left of
+//the way the path goes
+struct Portal
+{
+  Vector2D Left;
+  Vector2D Right;
+};
+
+
+//twice the signed area of the triangle abc: more than 0 if c is on the
+//left of the line from a through b
+static double TriArea2(Vector2D a, Vector2D b, Vector2D c)
+{
+  return (b.x - a.x)*(c.y - a.y) - (b.y - a.y)*(c.x - a.x);
+}
+
+//---------------------------------- Narrow -----------------------------------
+//
+//  the portal across side at a node, and the one across heading at the node
+//  length further along dir, must each keep to their own side of the line
+//  through the other, or the funnel folds over itself. Returns the reach of
+//  the first which leaves it halfway to that line
+//-----------------------------------------------------------------------------
+static double Narrow(double    reach,
+                     Vector2D  side,
+                     Vector2D  heading,
+                     Vector2D  dir,
+                     double    length)
+{
+  const double room  = length * heading.Dot(dir);
+  const double slant = fabs(side.Dot(heading));
+
+  if (room <= 0) return 0;
+
+  if (slant * reach > 0.5 * room) return 0.5 * room / slant;
+
+  return reach;
+}
+
+//------------------------------- MakePortals ---------------------------------
+//
+//  the portals of the edges from first up to last: one at the source of
+//  first, one at each node where two of the edges meet and one at the
+//  destination of the edge before last. The first and last are points
+//-----------------------------------------------------------------------------
+static void MakePortals(Path::const_iterator  first,
+                        Path::const_iterator  last,
+                        double                BoundingRadius,
+                        std::vector<Portal>&  portals)
+{
+  //the direction and length of each edge, and the way the path heads at
+  //each node: along the bisector of the turn there
+  std::vector<Vector2D> dirs;
+  std::vector<double>   lengths;
+  std::vector<double>   clearances;
+
+  for (Path::const_iterator e = first; e != last; ++e)
+  {
+    dirs.push_back(Vec2DNormalize(e->Destination() - e->Source()));
+    lengths.push_back(Vec2DDistance(e->Source(), e->Destination()));
+    clearances.push_back(e->Clearance());
+  }
+
+  const int NumEdges = (int)dirs.size();
+
+  std::vector<Vector2D> headings(NumEdges + 1);
+
+  headings[0]        = dirs[0];
+  headings[NumEdges] = dirs[NumEdges-1];
+
+  //where the path turns back or stands still it has no heading, and the
+  //portals there and next to it have no room
+  for (int nd=1; nd<NumEdges; ++nd)
+  {
+    headings[nd] = dirs[nd-1] + dirs[nd];
+
+    if (headings[nd].Length() < 1e-6 || lengths[nd-1] < 1e-6 || lengths[nd] < 1e-6)
+    {
+      headings[nd].Zero();
+    }
+
+    else
+    {
+      headings[nd].Normalize();
+    }
+  }
+
+  portals.clear();
+
+  Portal start = {first->Source(), first->Source()};
+
+  portals.push_back(start);
+
+  Path::const_iterator e = first;
+
+  for (int nd=1; nd<NumEdges; ++nd)
+  {
+    Vector2D node = (e++)->Destination();
+
+    Vector2D side = headings[nd].Perp();
+
+    double reach = MaxOf(0.0, MinOf(clearances[nd-1], clearances[nd]) - BoundingRadius);
+
+    if (headings[nd].isZero()) reach = 0;
+
+    reach = Narrow(reach, side, headings[nd-1], dirs[nd-1], lengths[nd-1]);
+    reach = Narrow(reach, side, headings[nd+1], dirs[nd], lengths[nd]);
+
+    Portal portal = {node + side * reach, node - side * reach};
+
+    portals.push_back(portal);
+  }
+
+  Portal end = {e->Destination(), e->Destination()};
+
+  portals.push_back(end);
+}
+
+//---------------------------------- Funnel -----------------------------------
+//
+//  the corners of the shortest path through the portals, the end included
+//  and the start left out
+//-----------------------------------------------------------------------------
+static void Funnel(const std::vector<Portal>& portals, std::vector<Vector2D>& corners)
+{
+  corners.clear();
+
+  Vector2D apex  = portals[0].Left;
+  Vector2D left  = apex;
+  Vector2D right = apex;
+
+  int ApexIndex = 0, LeftIndex = 0, RightIndex = 0;
+
+  for (int i=1; i<(int)portals.size(); ++i)
+  {
+    //narrow the funnel on the right, unless that crosses over the left
+    //side, in which case the left side is a corner
+    if (TriArea2(apex, right, portals[i].Right) >= 0)
+    {
+      if (apex == right || TriArea2(apex, left, portals[i].Right) < 0)
+      {
+        right      = portals[i].Right;
+        RightIndex = i;
+      }
+
+      else
+      {
+        corners.push_back(left);
+
+        apex       = left;
+        ApexIndex  = LeftIndex;
+        right      = apex;
+        RightIndex = ApexIndex;
+
+        i = ApexIndex;
+
+        continue;
+      }
+    }
+
+    //the same on the left
+    if (TriArea2(apex, left, portals[i].Left) <= 0)
+    {
+      if (apex == left || TriArea2(apex, right, portals[i].Left) > 0)
+      {
+        left      = portals[i].Left;
+        LeftIndex = i;
+      }
+
+      else
+      {
+        corners.push_back(right);
+
+        apex      = right;
+        ApexIndex = RightIndex;
+        left      = apex;
+        LeftIndex = ApexIndex;
+
+        i = ApexIndex;
+
+        continue;
+      }
+    }
+  }
+
+  //the last portal is a point, so the path always ends on it
+  if (corners.empty() || !(corners.back() == portals.back().Left))
+  {
+    corners.push_back(portals.back().Left);
+  }
+}
+
+//--------------------------- StringPullPathEdges -----------------------------
+//-----------------------------------------------------------------------------
+void StringPullPathEdges(Path& path, double BoundingRadius)
+{
+  std::vector<Portal>   portals;
+  std::vector<Vector2D> corners;
+
+  Path::iterator first = path.begin();
+
+  while (first != path.end())
+  {
+    //first, and the normal edges after it, are smoothed together
+    Path::iterator last = first;
+
+    do ++last; while (last != path.end() && last->Behavior() == NavGraphEdge::normal);
+
+    MakePortals(first, last, BoundingRadius, portals);
+
+    Funnel(portals, corners);
+
+    //first goes on to the first corner, and new normal edges join the
+    //others
+    first->SetDestination(corners[0]);
+
+    path.erase(++first, last);
+
+    for (unsigned int c=1; c<corners.size(); ++c)
+    {
+      path.insert(last, PathEdge(corners[c-1], corners[c], NavGraphEdge::normal));
+    }
+
+    first = last;
+  }
+}
@@ -0,0 +1,34 @@
+#ifndef PATH_FUNNEL_H
+#define PATH_FUNNEL_H
+//-----------------------------------------------------------------------------
+//
+//  Name:   PathFunnel.h
+//
+//  Desc:   smooths a path by pulling it tight like a string, using the
+//          distance from each of its edges to the nearest wall (see
+//          PathEdge::Clearance) instead of tracing against the walls.
+//
+//          a bot whose center stays within Clearance - BoundingRadius of
+//          an edge cannot touch a wall. So at each node the path may cross
+//          a portal: a segment through the node, across the way the path
+//          goes, reaching that far on both sides for both edges meeting
+//          there. Any path going through the portals in order is clear.
+//          The funnel algorithm finds the shortest such path, and each
+//          edge is looked at a few times at most, where tracing looks at
+//          every pair of edges.
+//
+//          as SmoothPathEdgesPrecise does, only normal edges are merged
+//          into the edge before them: the path still goes through the
+//          source node of every other edge, and that edge keeps its
+//          behavior and door.
+//
+//-----------------------------------------------------------------------------
+#include <list>
+
+#include "PathEdge.h"
+
+
+void StringPullPathEdges(std::list<PathEdge>& path, double BoundingRadius);
+
+
+#endif
@@ -11,13 +11,31 @@
 //          distribute the calculation of each search over several update-steps
 //-----------------------------------------------------------------------------
 #include <list>
+#include <algorithm>
 #include <cassert>
 
+#include "TimeSlicedGraphAlgorithms.h"
+
 
 
 template <class path_planner>
 class PathManager
 {
+public:
+
+  //totals over the searches the manager has seen through to the end. The
+  //cycles and nodes of a long game add up past the range of an int
+  struct Statistics
+  {
+    int        NumSearches;
+    int        NumFailed;
+    long long  NumCycles;
+    long long  NumNodesExpanded;
+
+    //the most cycles any one search took
+    int        MostCycles;
+  };
+
 private:
 
   //a container of all the active search requests
@@ -28,9 +46,19 @@ private:
   //requests
   unsigned int              m_iNumSearchCyclesPerUpdate;
 
+  Statistics                m_Stats;
+
+  //adds a search that has come to an end to the statistics
+  void  RecordSearch(const path_planner* pPathPlanner, int result);
+
 public:
     
-  PathManager(unsigned int NumCyclesPerUpdate):m_iNumSearchCyclesPerUpdate(NumCyclesPerUpdate){}
+  PathManager(unsigned int NumCyclesPerUpdate):m_iNumSearchCyclesPerUpdate(NumCyclesPerUpdate)
+  {
+    Statistics stats = {0, 0, 0, 0, 0};
+
+    m_Stats = stats;
+  }
 
   //every time this is called the total amount of search cycles available will
   //be shared out equally between all the active path requests. If a search
@@ -46,6 +74,8 @@ public:
 
   //returns the amount of path requests currently active.
   int  GetNumActiveSearches()const{return m_SearchRequests.size();}
+
+  const Statistics& GetStats()const{return m_Stats;}
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -65,7 +95,7 @@ inline void PathManager<path_planner>::UpdateSearches()
 
   //iterate through the search requests until either all requests have been
   //fulfilled or there are no search cycles remaining for this update-step.
-  std::list<path_planner*>::iterator curPath = m_SearchRequests.begin();
+  typename std::list<path_planner*>::iterator curPath = m_SearchRequests.begin();
   while (NumCyclesRemaining-- && !m_SearchRequests.empty())
   {
     //make one search cycle of this path request
@@ -74,6 +104,8 @@ inline void PathManager<path_planner>::UpdateSearches()
     //if the search has terminated remove from the list
     if ( (result == target_found) || (result == target_not_found) )
     {
+      RecordSearch(*curPath, result);
+
       //remove this path from the path list
       curPath = m_SearchRequests.erase(curPath);       
     }
@@ -93,6 +125,26 @@ inline void PathManager<path_planner>::UpdateSearches()
   }//end while
 }
 
+//--------------------------- RecordSearch ------------------------------------
+//-----------------------------------------------------------------------------
+template <class path_planner>
+inline void PathManager<path_planner>::RecordSearch(const path_planner* pPathPlanner,
+                                                    int                 result)
+{
+  const typename path_planner::Search* pSearch = pPathPlanner->GetCurrentSearch();
+
+  if (!pSearch) return;
+
+  ++m_Stats.NumSearches;
+
+  if (result == target_not_found) ++m_Stats.NumFailed;
+
+  m_Stats.NumCycles        += pSearch->NumCycles();
+  m_Stats.NumNodesExpanded += pSearch->NumNodesExpanded();
+
+  if (pSearch->NumCycles() > m_Stats.MostCycles) m_Stats.MostCycles = pSearch->NumCycles();
+}
+
 //--------------------------- Register ----------------------------------------
 //
 //  this is called to register a search with the manager.
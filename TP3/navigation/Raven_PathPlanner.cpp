@@ -1,29 +1,35 @@
 #include "Raven_PathPlanner.h"
 #include "../Raven_Game.h"
 #include "misc/utils.h"
-#include "graph/GraphAlgorithms.h"
+#include "Graph/GraphAlgorithms.h"
 #include "misc/Cgdi.h"
 #include "../Raven_Bot.h"
 #include "../constants.h"
 #include "../Raven_UserOptions.h"
-#include "pathmanager.h"
+#include "PathManager.h"
+#include "PathFunnel.h"
 #include "SearchTerminationPolicies.h"
 #include "../lua/Raven_Scriptor.h"
 #include "misc/CellSpacePartition.h"
 #include "../Raven_Messages.h"
 #include "Messaging/MessageDispatcher.h"
-#include "graph/NodeTypeEnumerations.h"
+#include "Graph/NodeTypeEnumerations.h"
 
 
 #include "Debug/DebugConsole.h"
 //#define SHOW_NAVINFO
 #include <cassert>
+#include <algorithm>
 
 //---------------------------- ctor -------------------------------------------
 //-----------------------------------------------------------------------------
 Raven_PathPlanner::Raven_PathPlanner(Raven_Bot* owner):m_pOwner(owner),
                m_NavGraph(m_pOwner->GetWorld()->GetMap()->GetNavGraph()),
-               m_pCurrentSearch(NULL)
+               m_pCurrentSearch(NULL),
+               m_pPositionSearch(NULL),
+               m_iClosestNodeToBot(no_closest_node_found),
+               m_iClosestNodeToBotWallEpoch(0),
+               m_bClosestNodeToBotKnown(false)
 {
 }
 
@@ -47,6 +53,19 @@ void Raven_PathPlanner::GetReadyForNewSearch()
   //clean up memory used by any existing search
   delete m_pCurrentSearch;    
   m_pCurrentSearch = 0;
+  m_pPositionSearch = 0;
+}
+
+//---------------------------- EdgeCostsChanged --------------------------------
+//-----------------------------------------------------------------------------
+void Raven_PathPlanner::EdgeCostsChanged(const std::vector<std::pair<int, int> >& edges)
+{
+  if (!m_pCurrentSearch) return;
+
+  for (unsigned int e=0; e<edges.size(); ++e)
+  {
+    m_pCurrentSearch->EdgeCostChanged(edges[e].first, edges[e].second);
+  }
 }
 
 //---------------------------- GetCostToNode ----------------------------------
@@ -57,7 +76,7 @@ void Raven_PathPlanner::GetReadyForNewSearch()
 double Raven_PathPlanner::GetCostToNode(unsigned int NodeIdx)const
 {
   //find the closest visible node to the bots position
-  int nd = GetClosestNodeToPosition(m_pOwner->Pos());
+  int nd = GetClosestNodeToBot();
 
   //add the cost to this node
   double cost =Vec2DDistance(m_pOwner->Pos(),
@@ -76,7 +95,7 @@ double Raven_PathPlanner::GetCostToNode(unsigned int NodeIdx)const
 double Raven_PathPlanner::GetCostToClosestItem(unsigned int GiverType)const
 {
   //find the closest visible node to the bots position
-  int nd = GetClosestNodeToPosition(m_pOwner->Pos());
+  int nd = GetClosestNodeToBot();
 
   //if no closest node found return failure
   if (nd == invalid_node_index) return -1;
@@ -84,25 +103,9 @@ double Raven_PathPlanner::GetCostToClosestItem(unsigned int GiverType)const
   double ClosestSoFar = MaxDouble;
 
   if (GiverType != type_team_cache) {
-	  //iterate through all the triggers to find the closest *active* trigger of 
-	  //type GiverType
-	  const Raven_Map::TriggerSystem::TriggerList& triggers = m_pOwner->GetWorld()->GetMap()->GetTriggers();
-
-	  Raven_Map::TriggerSystem::TriggerList::const_iterator it;
-	  for (it = triggers.begin(); it != triggers.end(); ++it)
-	  {
-		  if (((*it)->EntityType() == GiverType) && (*it)->isActive())
-		  {
-			  double cost =
-				  m_pOwner->GetWorld()->GetMap()->CalculateCostToTravelBetweenNodes(nd,
-				  (*it)->GraphNodeIndex());
-
-			  if (cost < ClosestSoFar)
-			  {
-				  ClosestSoFar = cost;
-			  }
-		  }
-	  }
+	  //the map keeps the active triggers of each type and, for each node,
+	  //the order of the triggers by their cost from it
+	  return m_pOwner->GetWorld()->GetMap()->CalculateCostToClosestActiveGiver(nd, GiverType);
   }
   else {
 	  Trigger_WeaponCache *wc = m_pOwner->GetWorld()->GetMap()->GetWeaponCache(m_pOwner->EntityType());
@@ -143,11 +146,22 @@ Raven_PathPlanner::Path Raven_PathPlanner::GetPath()
 
   Path path =  m_pCurrentSearch->GetPathAsPathEdges();
 
-  int closest = GetClosestNodeToPosition(m_pOwner->Pos());
+  int closest = GetClosestNodeToBot();
+
+  //the bot may have moved out of sight of every node since the search was
+  //made, in which case it heads for the node the search started from
+  if (closest == no_closest_node_found)
+  {
+    closest = m_pCurrentSearch->GetPathToTarget().front();
+  }
+
+  const Raven_Map* pMap = m_pOwner->GetWorld()->GetMap();
 
   path.push_front(PathEdge(m_pOwner->Pos(),
                             GetNodePosition(closest),
-                            NavGraphEdge::normal));
+                            NavGraphEdge::normal,
+                            0,
+                            pMap->CalculateClearance(m_pOwner->Pos(), GetNodePosition(closest))));
 
   
   //if the bot requested a path to a location then an edge leading to the
@@ -156,7 +170,9 @@ Raven_PathPlanner::Path Raven_PathPlanner::GetPath()
   {   
     path.push_back(PathEdge(path.back().Destination(),
                             m_vDestinationPos,
-                            NavGraphEdge::normal));
+                            NavGraphEdge::normal,
+                            0,
+                            pMap->CalculateClearance(path.back().Destination(), m_vDestinationPos)));
   }
 
   //smooth paths if required
@@ -167,7 +183,15 @@ Raven_PathPlanner::Path Raven_PathPlanner::GetPath()
 
   if (UserOptions->m_bSmoothPathsPrecise)
   {
-    SmoothPathEdgesPrecise(path);
+    if (script->Params().Bot_SmoothPathsWithFunnel)
+    {
+      StringPullPathEdges(path, m_pOwner->BRadius());
+    }
+
+    else
+    {
+      SmoothPathEdgesPrecise(path);
+    }
   }
 
   return path;
@@ -300,79 +324,75 @@ int Raven_PathPlanner::CycleOnce()const
 //------------------------ GetClosestNodeToPosition ---------------------------
 //
 //  returns the index of the closest visible graph node to the given position
+//
+//  the nodes are tried nearest first so the walls only need to be tested
+//  until a node which can be walked to is found. Nodes at the same distance
+//  are tried in the order the cell space returns them
 //-----------------------------------------------------------------------------
 int Raven_PathPlanner::GetClosestNodeToPosition(Vector2D pos)const
 {
-  double ClosestSoFar = MaxDouble;
-  int   ClosestNode  = no_closest_node_found;
-
   //when the cell space is queried this the the range searched for neighboring
   //graph nodes. This value is inversely proportional to the density of a 
   //navigation graph (less dense = bigger values)
   const double range = m_pOwner->GetWorld()->GetMap()->GetCellSpaceNeighborhoodRange();
 
   //calculate the graph nodes that are neighboring this position
-  m_pOwner->GetWorld()->GetMap()->GetCellSpace()->CalculateNeighbors(pos, range);
+  m_pOwner->GetWorld()->GetMap()->GetCellSpace()->CalculateNeighbors(pos, range, m_NearbyNodes);
+
+  m_NodesByDistance.clear();
 
-  //iterate through the neighbors and sum up all the position vectors
-  for (NodeType* pN = m_pOwner->GetWorld()->GetMap()->GetCellSpace()->begin();
-                 !m_pOwner->GetWorld()->GetMap()->GetCellSpace()->end();     
-                 pN = m_pOwner->GetWorld()->GetMap()->GetCellSpace()->next())
+  for (unsigned int n=0; n<m_NearbyNodes.size(); ++n)
   {
-    //if the path between this node and pos is unobstructed calculate the
-    //distance
+    m_NodesByDistance.push_back(std::make_pair(Vec2DDistanceSq(pos, m_NearbyNodes[n]->Pos()), (int)n));
+  }
+
+  std::sort(m_NodesByDistance.begin(), m_NodesByDistance.end());
+
+  for (unsigned int n=0; n<m_NodesByDistance.size(); ++n)
+  {
+    const NodeType* pN = m_NearbyNodes[m_NodesByDistance[n].second];
+
+    //the first node the path to which is unobstructed is the closest
     if (m_pOwner->canWalkBetween(pos, pN->Pos()))
     {
-      double dist = Vec2DDistanceSq(pos, pN->Pos());
-
-      //keep a record of the closest so far
-      if (dist < ClosestSoFar)
-      {
-        ClosestSoFar = dist;
-        ClosestNode  = pN->Index();
-      }
+      return pN->Index();
     }
   }
    
-  return ClosestNode;
+  return no_closest_node_found;
 }
 
-//--------------------------- RequestPathToPosition ------------------------------
-//
-//  Given a target, this method first determines if nodes can be reached from 
-//  the  bot's current position and the target position. If either end point
-//  is unreachable the method returns false. 
-//
-//  If nodes are reachable from both positions then an instance of the time-
-//  sliced A* search is created and registered with the search manager. the
-//  method then returns true.
-//        
+//--------------------------- GetClosestNodeToBot -----------------------------
 //-----------------------------------------------------------------------------
-bool Raven_PathPlanner::RequestPathToPosition(Vector2D TargetPos)
-{ 
-  #ifdef SHOW_NAVINFO
-    debug_con << "------------------------------------------------" << "";
-#endif
-  GetReadyForNewSearch();
-
-  //make a note of the target position.
-  m_vDestinationPos = TargetPos;
+int Raven_PathPlanner::GetClosestNodeToBot()const
+{
+  const unsigned int WallEpoch = m_pOwner->GetWorld()->GetMap()->GetWallEpoch();
 
-  //if the target is walkable from the bot's position a path does not need to
-  //be calculated, the bot can go straight to the position by ARRIVING at
-  //the current waypoint
-  if (m_pOwner->canWalkTo(TargetPos))
-  { 
-    return true;
+  if (!m_bClosestNodeToBotKnown                       ||
+      m_vClosestNodeToBotPos != m_pOwner->Pos()       ||
+      m_iClosestNodeToBotWallEpoch != WallEpoch)
+  {
+    m_iClosestNodeToBot          = GetClosestNodeToPosition(m_pOwner->Pos());
+    m_vClosestNodeToBotPos       = m_pOwner->Pos();
+    m_iClosestNodeToBotWallEpoch = WallEpoch;
+    m_bClosestNodeToBotKnown     = true;
   }
-  
+
+  return m_iClosestNodeToBot;
+}
+
+//------------------------------ GetEndNodes ----------------------------------
+//-----------------------------------------------------------------------------
+bool Raven_PathPlanner::GetEndNodes(Vector2D TargetPos,
+                                    int&     ClosestNodeToBot,
+                                    int&     ClosestNodeToTarget)const
+{
   //find the closest visible node to the bots position
-  int ClosestNodeToBot = GetClosestNodeToPosition(m_pOwner->Pos());
+  ClosestNodeToBot = GetClosestNodeToBot();
 
-  //remove the destination node from the list and return false if no visible
-  //node found. This will occur if the navgraph is badly designed or if the bot
-  //has managed to get itself *inside* the geometry (surrounded by walls),
-  //or an obstacle.
+  //return false if no visible node found. This will occur if the navgraph
+  //is badly designed or if the bot has managed to get itself *inside* the
+  //geometry (surrounded by walls), or an obstacle.
   if (ClosestNodeToBot == no_closest_node_found)
   { 
 #ifdef SHOW_NAVINFO
@@ -387,7 +407,7 @@ bool Raven_PathPlanner::RequestPathToPosition(Vector2D TargetPos)
 #endif
 
   //find the closest visible node to the target position
-  int ClosestNodeToTarget = GetClosestNodeToPosition(TargetPos);
+  ClosestNodeToTarget = GetClosestNodeToPosition(TargetPos);
   
   //return false if there is a problem locating a visible node from the target.
   //This sort of thing occurs much more frequently than the above. For
@@ -406,12 +426,96 @@ bool Raven_PathPlanner::RequestPathToPosition(Vector2D TargetPos)
     debug_con << "Closest node to target is " << ClosestNodeToTarget << "";
 #endif
 
-  //create an instance of a the distributed A* search class
-  typedef Graph_SearchAStar_TS<Raven_Map::NavGraph, Heuristic_Euclid> AStar;
-   
-  m_pCurrentSearch = new AStar(m_NavGraph,
-                               ClosestNodeToBot,
-                               ClosestNodeToTarget);
+  return true;
+}
+
+//--------------------------- RequestPathToPosition ------------------------------
+//
+//  Given a target, this method first determines if nodes can be reached from 
+//  the  bot's current position and the target position. If either end point
+//  is unreachable the method returns false. 
+//
+//  If nodes are reachable from both positions then an instance of the time-
+//  sliced D* Lite search is created, or the last one carried on with, and
+//  registered with the search manager. the method then returns true.
+//        
+//-----------------------------------------------------------------------------
+bool Raven_PathPlanner::RequestPathToPosition(Vector2D TargetPos)
+{ 
+  #ifdef SHOW_NAVINFO
+    debug_con << "------------------------------------------------" << "";
+#endif
+  //stop any search under way. It is not deleted yet in case it can be
+  //carried on from
+  m_pOwner->GetWorld()->GetPathManager()->UnRegister(this);
+
+  //make a note of the target position.
+  m_vDestinationPos = TargetPos;
+
+  //if the target is walkable from the bot's position a path does not need to
+  //be calculated, the bot can go straight to the position by ARRIVING at
+  //the current waypoint
+  if (m_pOwner->canWalkTo(TargetPos))
+  { 
+    return true;
+  }
+  
+  int ClosestNodeToBot, ClosestNodeToTarget;
+
+  if (!GetEndNodes(TargetPos, ClosestNodeToBot, ClosestNodeToTarget)) return false;
+
+  //if the last search was for the same node it is carried on from the
+  //bot's node, else a new one is made. The search mends what the changes
+  //to edge costs since it was last cycled have spoiled
+  if (m_pPositionSearch && m_pPositionSearch->GetTarget() == ClosestNodeToTarget)
+  {
+    m_pPositionSearch->SetSource(ClosestNodeToBot);
+  }
+
+  else
+  {
+    GetReadyForNewSearch();
+
+    m_pPositionSearch = new PositionSearch(m_NavGraph,
+                                           ClosestNodeToBot,
+                                           ClosestNodeToTarget);
+
+    m_pCurrentSearch = m_pPositionSearch;
+  }
+
+  //and register the search with the path manager
+  m_pOwner->GetWorld()->GetPathManager()->Register(this);
+
+  return true;
+}
+
+//------------------------- RequestPathToFarPosition ---------------------------
+//
+//  as RequestPathToPosition, but the search is a new bidirectional A* each
+//  time, which fails once every path left to it would cost more than
+//  MaxCost
+//-----------------------------------------------------------------------------
+bool Raven_PathPlanner::RequestPathToFarPosition(Vector2D TargetPos, double MaxCost)
+{
+  //clear the waypoint list and delete any active search
+  GetReadyForNewSearch();
+
+  //make a note of the target position.
+  m_vDestinationPos = TargetPos;
+
+  if (m_pOwner->canWalkTo(TargetPos))
+  { 
+    return true;
+  }
+
+  int ClosestNodeToBot, ClosestNodeToTarget;
+
+  if (!GetEndNodes(TargetPos, ClosestNodeToBot, ClosestNodeToTarget)) return false;
+
+  m_pCurrentSearch = new FarPositionSearch(m_NavGraph,
+                                           ClosestNodeToBot,
+                                           ClosestNodeToTarget,
+                                           MaxCost);
 
   //and register the search with the path manager
   m_pOwner->GetWorld()->GetPathManager()->Register(this);
@@ -423,8 +527,10 @@ bool Raven_PathPlanner::RequestPathToPosition(Vector2D TargetPos)
 //------------------------------ RequestPathToItem -----------------------------
 //
 // Given an item type, this method determines the closest reachable graph node
-// to the bot's position and then creates a instance of the time-sliced 
-// Dijkstra's algorithm, which it registers with the search manager
+// to the bot's position and then creates a search from it, which it
+// registers with the search manager. The search follows the map's field of
+// the item type if it has one, which takes a single cycle, else it is an
+// instance of the time-sliced Dijkstra's algorithm
 //
 //-----------------------------------------------------------------------------
 bool Raven_PathPlanner::RequestPathToItem(unsigned int ItemType)
@@ -433,7 +539,7 @@ bool Raven_PathPlanner::RequestPathToItem(unsigned int ItemType)
   GetReadyForNewSearch();
 
   //find the closest visible node to the bots position
-  int ClosestNodeToBot = GetClosestNodeToPosition(m_pOwner->Pos());
+  int ClosestNodeToBot = GetClosestNodeToBot();
 
   //remove the destination node from the list and return false if no visible
   //node found. This will occur if the navgraph is badly designed or if the bot
@@ -448,13 +554,29 @@ bool Raven_PathPlanner::RequestPathToItem(unsigned int ItemType)
     return false; 
   }
 
-  //create an instance of the search algorithm
-  typedef FindActiveTrigger<Trigger<Raven_Bot> > t_con; 
-  typedef Graph_SearchDijkstras_TS<Raven_Map::NavGraph, t_con> DijSearch;
+  //the map keeps the way to the nearest active giver of the common types
+  //of item from every node, so the path can be read straight off it
+  const Raven_Map::ItemField* pField = m_pOwner->GetWorld()->GetMap()->GetItemField(ItemType);
+
+  if (pField)
+  {
+    typedef Graph_SearchDistanceField_TS<Raven_Map::NavGraph> FieldSearch;
+
+    m_pCurrentSearch = new FieldSearch(m_NavGraph,
+                                       *pField,
+                                       ClosestNodeToBot);
+  }
+
+  //otherwise create an instance of the search algorithm
+  else
+  {
+    typedef FindActiveTrigger<Trigger<Raven_Bot> > t_con; 
+    typedef Graph_SearchDijkstras_TS<Raven_Map::NavGraph, t_con> DijSearch;
   
-  m_pCurrentSearch = new DijSearch(m_NavGraph,
-                                   ClosestNodeToBot,
-                                   ItemType);  
+    m_pCurrentSearch = new DijSearch(m_NavGraph,
+                                     ClosestNodeToBot,
+                                     ItemType);  
+  }
 
   //register the search with the path manager
   m_pOwner->GetWorld()->GetPathManager()->Register(this);
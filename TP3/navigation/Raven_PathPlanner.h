@@ -33,6 +33,14 @@ public:
   typedef Raven_Map::NavGraph::EdgeType           EdgeType;
   typedef Raven_Map::NavGraph::NodeType           NodeType;
   typedef std::list<PathEdge>                     Path;
+  typedef Graph_SearchTimeSliced<EdgeType>        Search;
+
+  //the search used for paths to positions. The navgraph's edge costs are
+  //read from the map file, so the heuristic is shaved
+  typedef Graph_SearchDStarLite_TS<Raven_Map::NavGraph, Heuristic_ShavedEuclid> PositionSearch;
+
+  //the search used for paths to far positions, which may be given up on
+  typedef Graph_SearchBidirectionalAStar_TS<Raven_Map::NavGraph, Heuristic_ShavedEuclid> FarPositionSearch;
   
 private:
 
@@ -44,10 +52,30 @@ private:
 
   //a pointer to an instance of the current graph search algorithm.
   Graph_SearchTimeSliced<EdgeType>*  m_pCurrentSearch;
+
+  //m_pCurrentSearch if it is a search for a position. It is kept when it
+  //has finished so it can be carried on from if the same node is asked for
+  //again, as when a bot that has got stuck plans its way again
+  PositionSearch*                     m_pPositionSearch;
   
   //this is the position the bot wishes to plan a path to reach
   Vector2D                            m_vDestinationPos;
 
+  //the graph nodes found near a position by GetClosestNodeToPosition. Each
+  //planner has its own so the bots can look up nodes concurrently
+  mutable std::vector<NodeType*>      m_NearbyNodes;
+
+  //the squared distance of each of m_NearbyNodes to the position and its
+  //index in m_NearbyNodes, sorted nearest first
+  mutable std::vector<std::pair<double, int> > m_NodesByDistance;
+
+  //the closest node to the bot's position, kept until the bot moves or a
+  //wall does. The costs worked out while the bot thinks all start from it
+  mutable int                         m_iClosestNodeToBot;
+  mutable Vector2D                    m_vClosestNodeToBotPos;
+  mutable unsigned int                m_iClosestNodeToBotWallEpoch;
+  mutable bool                        m_bClosestNodeToBotKnown;
+
 
   //returns the index of the closest visible and unobstructed graph node to
   //the given position
@@ -65,6 +93,10 @@ private:
   //appropriate lists and memory in preparation for a new search request
   void  GetReadyForNewSearch();
 
+  //finds the graph nodes a search for a path from the bot to the position
+  //goes between. Returns false if there is no node near either end
+  bool  GetEndNodes(Vector2D TargetPos, int& ClosestNodeToBot, int& ClosestNodeToTarget)const;
+
 
 
 public:
@@ -73,14 +105,27 @@ public:
 
   Raven_PathPlanner(Raven_Bot* owner);
 
-  //creates an instance of the A* time-sliced search and registers it with
-  //the path manager
+  //creates a search for the nearest active item of the type and registers
+  //it with the path manager
   bool       RequestPathToItem(unsigned int ItemType);
 
-  //creates an instance of the Dijkstra's time-sliced search and registers 
-  //it with the path manager
+  //creates an instance of the D* Lite time-sliced search, or carries on
+  //with the last one if it is for the same node, and registers it with the
+  //path manager
   bool       RequestPathToPosition(Vector2D TargetPos);
 
+  //creates an instance of the time-sliced bidirectional A* search, which
+  //gives up as soon as it can tell the path costs more than MaxCost, and
+  //registers it with the path manager. For long trips to places the bot
+  //need not reach, where either end of a single search would look through
+  //most of the map
+  bool       RequestPathToFarPosition(Vector2D TargetPos, double MaxCost);
+
+  //called by the game after the costs of the edges between the pairs of
+  //nodes have been changed. The current search is told so it can mend
+  //what it has found
+  void       EdgeCostsChanged(const std::vector<std::pair<int, int> >& edges);
+
   //called by an agent after it has been notified that a search has terminated
   //successfully. The method extracts the path from m_pCurrentSearch, adds
   //additional edges appropriate to the search type and returns it as a list of
@@ -97,6 +142,10 @@ public:
   //trigger found
   double      GetCostToClosestItem(unsigned int GiverType)const;
 
+  //same as GetClosestNodeToPosition(m_pOwner->Pos()), remembering the last
+  //result
+  int         GetClosestNodeToBot()const;
+
   
   //the path manager calls this to iterate once though the search cycle
   //of the currently assigned search algorithm. When a search is terminated
@@ -104,6 +153,8 @@ public:
   //msg_PathReady messages
   int        CycleOnce()const;
 
+  const Search* GetCurrentSearch()const{return m_pCurrentSearch;}
+
   Vector2D   GetDestination()const{return m_vDestinationPos;}
   void       SetDestination(Vector2D NewPos){m_vDestinationPos = NewPos;}
 
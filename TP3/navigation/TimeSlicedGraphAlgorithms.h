@@ -18,10 +18,12 @@
 #include <list>
 #include <queue>
 #include <stack>
+#include <functional>
 
-#include "graph/SparseGraph.h"
+#include "Graph/SparseGraph.h"
 #include "misc/PriorityQueue.h"
 #include "Graph/AStarHeuristicPolicies.h"
+#include "Graph/GraphDistanceField.h"
 #include "SearchTerminationPolicies.h"
 #include "PathEdge.h"
 
@@ -47,10 +49,19 @@ private:
 
   SearchType m_SearchType;
 
+protected:
+
+  //for the path manager's statistics: the cycles the search has been given
+  //and the nodes it has expanded in them
+  int        m_iNumCycles;
+  int        m_iNumNodesExpanded;
 
 public:
 
-  Graph_SearchTimeSliced(SearchType type):m_SearchType(type){}
+  Graph_SearchTimeSliced(SearchType type):m_SearchType(type),
+                                          m_iNumCycles(0),
+                                          m_iNumNodesExpanded(0)
+  {}
 
   virtual ~Graph_SearchTimeSliced(){}
 
@@ -73,7 +84,15 @@ public:
   //returns the path as a list of PathEdges
   virtual std::list<PathEdge>           GetPathAsPathEdges()const=0;
 
+  //called after the cost of the edge between two nodes has been changed
+  //(both ways). A search which can mend what it has found does so over its
+  //next cycles; the others carry on with the costs they have already used
+  virtual void                          EdgeCostChanged(int /*from*/, int /*to*/){}
+
   SearchType                            GetType()const{return m_SearchType;}
+
+  int                                   NumCycles()const{return m_iNumCycles;}
+  int                                   NumNodesExpanded()const{return m_iNumNodesExpanded;}
 };
 
 
@@ -81,9 +100,10 @@ public:
 
 //-------------------------- Graph_SearchAStar_TS -----------------------------
 //
-//  a A* class that enables a search to be completed over multiple update-steps
+//  a A* class that enables a search to be completed over multiple update-steps.
+//  The heap policy chooses how the queue is kept (see PriorityQueue.h)
 //-----------------------------------------------------------------------------
-template <class graph_type, class heuristic>
+template <class graph_type, class heuristic, class heap_policy = HeapPolicy_Binary>
 class Graph_SearchAStar_TS : public Graph_SearchTimeSliced<typename graph_type::EdgeType>
 {
 private:
@@ -110,16 +130,22 @@ private:
   int                            m_iSource;
   int                            m_iTarget;
 
+  //the search fails as soon as the cheapest path left to it would cost
+  //more than this. That is only sure if the heuristic is never more than
+  //the cost of an edge between the nodes (see Heuristic_ShavedEuclid)
+  double                         m_dCostBound;
+
   //create an indexed priority queue of nodes. The nodes with the
   //lowest overall F cost (G+H) are positioned at the front.
-  IndexedPriorityQLow<double>*    m_pPQ;
+  IndexedPriorityQLow<double, heap_policy>*    m_pPQ;
 
  
 public:
 
   Graph_SearchAStar_TS(const graph_type& G,
                       int                source,
-                      int                target):Graph_SearchTimeSliced<Edge>(AStar),
+                      int                target,
+                      double             CostBound = MaxDouble):Graph_SearchTimeSliced<Edge>(Graph_SearchTimeSliced<Edge>::AStar),
   
                                               m_Graph(G),
                                               m_ShortestPathTree(G.NumNodes()),                              
@@ -127,10 +153,11 @@ public:
                                               m_GCosts(G.NumNodes(), 0.0),
                                               m_FCosts(G.NumNodes(), 0.0),
                                               m_iSource(source),
-                                              m_iTarget(target)
+                                              m_iTarget(target),
+                                              m_dCostBound(CostBound)
   { 
      //create the PQ   
-     m_pPQ =new IndexedPriorityQLow<double>(m_FCosts, m_Graph.NumNodes());
+     m_pPQ =new IndexedPriorityQLow<double, heap_policy>(m_FCosts, m_Graph.NumNodes());
 
     //put the source node on the queue
     m_pPQ->insert(m_iSource);
@@ -159,9 +186,11 @@ public:
 };
 
 //-----------------------------------------------------------------------------
-template <class graph_type, class heuristic>
-int Graph_SearchAStar_TS<graph_type, heuristic>::CycleOnce()
+template <class graph_type, class heuristic, class heap_policy>
+int Graph_SearchAStar_TS<graph_type, heuristic, heap_policy>::CycleOnce()
 {
+  ++this->m_iNumCycles;
+
   //if the PQ is empty the target has not been found
   if (m_pPQ->empty())
   {
@@ -171,6 +200,15 @@ int Graph_SearchAStar_TS<graph_type, heuristic>::CycleOnce()
   //get lowest cost node from the queue
   int NextClosestNode = m_pPQ->Pop();
 
+  //with the heuristic never more than the real cost, every path left to
+  //the search costs at least this much
+  if (m_FCosts[NextClosestNode] > m_dCostBound)
+  {
+    return target_not_found;
+  }
+
+  ++this->m_iNumNodesExpanded;
+
   //put the node on the SPT
   m_ShortestPathTree[NextClosestNode] = m_SearchFrontier[NextClosestNode];
 
@@ -181,7 +219,7 @@ int Graph_SearchAStar_TS<graph_type, heuristic>::CycleOnce()
   }
 
   //now to test all the edges attached to this node
-  graph_type::ConstEdgeIterator ConstEdgeItr(m_Graph, NextClosestNode);
+  typename graph_type::ConstEdgeIterator ConstEdgeItr(m_Graph, NextClosestNode);
   for (const Edge* pE=ConstEdgeItr.begin();
       !ConstEdgeItr.end();
        pE=ConstEdgeItr.next())
@@ -223,9 +261,9 @@ int Graph_SearchAStar_TS<graph_type, heuristic>::CycleOnce()
 }
 
 //-----------------------------------------------------------------------------
-template <class graph_type, class heuristic>
+template <class graph_type, class heuristic, class heap_policy>
 std::list<int> 
-Graph_SearchAStar_TS<graph_type, heuristic>::GetPathToTarget()const
+Graph_SearchAStar_TS<graph_type, heuristic, heap_policy>::GetPathToTarget()const
 {
   std::list<int> path;
 
@@ -251,9 +289,9 @@ Graph_SearchAStar_TS<graph_type, heuristic>::GetPathToTarget()const
 //
 //  returns the path as a list of PathEdges
 //-----------------------------------------------------------------------------
-template <class graph_type, class heuristic>
+template <class graph_type, class heuristic, class heap_policy>
 std::list<PathEdge> 
-Graph_SearchAStar_TS<graph_type, heuristic>::GetPathAsPathEdges()const
+Graph_SearchAStar_TS<graph_type, heuristic, heap_policy>::GetPathAsPathEdges()const
 {
   std::list<PathEdge> path;
 
@@ -267,7 +305,8 @@ Graph_SearchAStar_TS<graph_type, heuristic>::GetPathAsPathEdges()const
     path.push_front(PathEdge(m_Graph.GetNode(m_ShortestPathTree[nd]->From()).Pos(),
                              m_Graph.GetNode(m_ShortestPathTree[nd]->To()).Pos(),
                              m_ShortestPathTree[nd]->Flags(),
-                             m_ShortestPathTree[nd]->IDofIntersectingEntity()));
+                             m_ShortestPathTree[nd]->IDofIntersectingEntity(),
+                             m_ShortestPathTree[nd]->Clearance()));
 
     nd = m_ShortestPathTree[nd]->From();
   }
@@ -278,9 +317,10 @@ Graph_SearchAStar_TS<graph_type, heuristic>::GetPathAsPathEdges()const
 //-------------------------- Graph_SearchDijkstras_TS -------------------------
 //
 //  Dijkstra's algorithm class modified to spread a search over multiple
-//  update-steps
+//  update-steps. The heap policy chooses how the queue is kept (see
+//  PriorityQueue.h)
 //-----------------------------------------------------------------------------
-template <class graph_type, class termination_condition>
+template <class graph_type, class termination_condition, class heap_policy = HeapPolicy_Binary>
 class Graph_SearchDijkstras_TS : public Graph_SearchTimeSliced<typename graph_type::EdgeType>
 {
 private:
@@ -304,7 +344,7 @@ private:
 
   //create an indexed priority queue of nodes. The nodes with the
   //lowest overall F cost (G+H) are positioned at the front.
-  IndexedPriorityQLow<double>*     m_pPQ;
+  IndexedPriorityQLow<double, heap_policy>*     m_pPQ;
 
  
 
@@ -312,7 +352,7 @@ public:
 
   Graph_SearchDijkstras_TS(const graph_type&  G,
                           int                   source,
-                          int                   target):Graph_SearchTimeSliced<Edge>(Dijkstra),
+                          int                   target):Graph_SearchTimeSliced<Edge>(Graph_SearchTimeSliced<Edge>::Dijkstra),
   
                                               m_Graph(G),
                                               m_ShortestPathTree(G.NumNodes()),                              
@@ -322,7 +362,7 @@ public:
                                               m_iTarget(target)
   { 
      //create the PQ         ,
-     m_pPQ =new IndexedPriorityQLow<double>(m_CostToThisNode, m_Graph.NumNodes());
+     m_pPQ =new IndexedPriorityQLow<double, heap_policy>(m_CostToThisNode, m_Graph.NumNodes());
 
     //put the source node on the queue
     m_pPQ->insert(m_iSource);
@@ -357,9 +397,11 @@ public:
 };
 
 //-----------------------------------------------------------------------------
-template <class graph_type, class termination_condition>
-int Graph_SearchDijkstras_TS<graph_type, termination_condition>::CycleOnce()
+template <class graph_type, class termination_condition, class heap_policy>
+int Graph_SearchDijkstras_TS<graph_type, termination_condition, heap_policy>::CycleOnce()
 {
+  ++this->m_iNumCycles;
+
   //if the PQ is empty the target has not been found
   if (m_pPQ->empty())
   {
@@ -369,6 +411,8 @@ int Graph_SearchDijkstras_TS<graph_type, termination_condition>::CycleOnce()
   //get lowest cost node from the queue
   int NextClosestNode = m_pPQ->Pop();
 
+  ++this->m_iNumNodesExpanded;
+
   //move this node from the frontier to the spanning tree
   m_ShortestPathTree[NextClosestNode] = m_SearchFrontier[NextClosestNode];
 
@@ -384,7 +428,7 @@ int Graph_SearchDijkstras_TS<graph_type, termination_condition>::CycleOnce()
   }
 
   //now to test all the edges attached to this node
-  graph_type::ConstEdgeIterator ConstEdgeItr(m_Graph, NextClosestNode);
+  typename graph_type::ConstEdgeIterator ConstEdgeItr(m_Graph, NextClosestNode);
   for (const Edge* pE=ConstEdgeItr.begin();
       !ConstEdgeItr.end();
        pE=ConstEdgeItr.next())
@@ -428,9 +472,9 @@ int Graph_SearchDijkstras_TS<graph_type, termination_condition>::CycleOnce()
 }
 
 //-----------------------------------------------------------------------------
-template <class graph_type, class termination_condition>
+template <class graph_type, class termination_condition, class heap_policy>
 std::list<int> 
-Graph_SearchDijkstras_TS<graph_type, termination_condition>::GetPathToTarget()const
+Graph_SearchDijkstras_TS<graph_type, termination_condition, heap_policy>::GetPathToTarget()const
 {
   std::list<int> path;
 
@@ -456,9 +500,9 @@ Graph_SearchDijkstras_TS<graph_type, termination_condition>::GetPathToTarget()co
 //
 //  returns the path as a list of PathEdges
 //-----------------------------------------------------------------------------
-template <class graph_type, class termination_condition>
+template <class graph_type, class termination_condition, class heap_policy>
 std::list<PathEdge> 
-Graph_SearchDijkstras_TS<graph_type, termination_condition>::GetPathAsPathEdges()const
+Graph_SearchDijkstras_TS<graph_type, termination_condition, heap_policy>::GetPathAsPathEdges()const
 {
   std::list<PathEdge> path;
 
@@ -472,7 +516,8 @@ Graph_SearchDijkstras_TS<graph_type, termination_condition>::GetPathAsPathEdges(
     path.push_front(PathEdge(m_Graph.GetNode(m_ShortestPathTree[nd]->From()).Pos(),
                              m_Graph.GetNode(m_ShortestPathTree[nd]->To()).Pos(),
                              m_ShortestPathTree[nd]->Flags(),
-                             m_ShortestPathTree[nd]->IDofIntersectingEntity()));
+                             m_ShortestPathTree[nd]->IDofIntersectingEntity(),
+                             m_ShortestPathTree[nd]->Clearance()));
     
     nd = m_ShortestPathTree[nd]->From();
   }
@@ -480,4 +525,796 @@ Graph_SearchDijkstras_TS<graph_type, termination_condition>::GetPathAsPathEdges(
   return path;
 }
 
+//------------------------ Graph_SearchDistanceField_TS -----------------------
+//
+//  follows a GraphDistanceField from the source to its nearest field source.
+//  The path is read off the field when the search is made, so it completes
+//  on its first cycle. It is a Dijkstra search as far as its users are
+//  concerned: it ends at a node, not at a position
+//-----------------------------------------------------------------------------
+template <class graph_type>
+class Graph_SearchDistanceField_TS : public Graph_SearchTimeSliced<typename graph_type::EdgeType>
+{
+private:
+
+  typedef typename graph_type::EdgeType Edge;
+
+private:
+
+  const graph_type&           m_Graph;
+
+  //the edges of the path, in order
+  std::vector<const Edge*>    m_Path;
+
+  double                      m_dCost;
+
+  int                         m_iSource;
+  int                         m_iTarget;
+
+public:
+
+  Graph_SearchDistanceField_TS(const graph_type&                     G,
+                               const GraphDistanceField<graph_type>& field,
+                               int                                   source):Graph_SearchTimeSliced<Edge>(Graph_SearchTimeSliced<Edge>::Dijkstra),
+                                                                    m_Graph(G),
+                                                                    m_dCost(0),
+                                                                    m_iSource(source),
+                                                                    m_iTarget(-1)
+  {
+    if (!field.isReachable(source)) return;
+
+    m_dCost = field.Cost(source);
+
+    int nd = source;
+
+    while (!field.isSource(nd))
+    {
+      assert ((int)m_Path.size() < G.NumNodes() &&
+              "<Graph_SearchDistanceField_TS::ctor>: the field has a loop");
+
+      m_Path.push_back(field.NextEdge(nd));
+
+      nd = field.NextEdge(nd)->To();
+    }
+
+    m_iTarget = nd;
+
+    //the walk stands in for the search
+    this->m_iNumNodesExpanded = (int)m_Path.size() + 1;
+  }
+
+  int                      CycleOnce()
+  {
+    ++this->m_iNumCycles;
+
+    return m_iTarget < 0 ? target_not_found : target_found;
+  }
+
+  //only the edges of the path are on the tree
+  std::vector<const Edge*> GetSPT()const
+  {
+    std::vector<const Edge*> spt(m_Graph.NumNodes());
+
+    for (unsigned int e=0; e<m_Path.size(); ++e) spt[m_Path[e]->To()] = m_Path[e];
+
+    return spt;
+  }
+
+  std::list<int>           GetPathToTarget()const
+  {
+    std::list<int> path;
+
+    if (m_iTarget < 0) return path;
+
+    path.push_back(m_iSource);
+
+    for (unsigned int e=0; e<m_Path.size(); ++e) path.push_back(m_Path[e]->To());
+
+    return path;
+  }
+
+  std::list<PathEdge>      GetPathAsPathEdges()const
+  {
+    std::list<PathEdge> path;
+
+    for (unsigned int e=0; e<m_Path.size(); ++e)
+    {
+      path.push_back(PathEdge(m_Graph.GetNode(m_Path[e]->From()).Pos(),
+                              m_Graph.GetNode(m_Path[e]->To()).Pos(),
+                              m_Path[e]->Flags(),
+                              m_Path[e]->IDofIntersectingEntity(),
+                              m_Path[e]->Clearance()));
+    }
+
+    return path;
+  }
+
+  double                   GetCostToTarget()const{return m_dCost;}
+};
+
+//----------------------- Graph_SearchDStarLite_TS ----------------------------
+//
+//  D* Lite (Koenig & Likhachev). It searches backwards from the target, so
+//  what it has found is, for every node it has reached, the cost of the
+//  way from there to the target. When the costs of edges change only the
+//  nodes whose costs they change are searched again, and the source may be
+//  moved to another node (as the bot moves) without starting again. Each
+//  cycle settles one node.
+//
+//  the graph must be undirected, with the same cost both ways along an
+//  edge: the edges leading into a node are found from those leading out
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+class Graph_SearchDStarLite_TS : public Graph_SearchTimeSliced<typename graph_type::EdgeType>
+{
+private:
+
+  typedef typename graph_type::EdgeType Edge;
+
+  //the priority of a node on the queue. Smaller keys come first, compared
+  //on the first value and then on the second
+  struct Key
+  {
+    double  k1;
+    double  k2;
+
+    bool operator<(const Key& rhs)const{return k1 < rhs.k1 || (k1 == rhs.k1 && k2 < rhs.k2);}
+    bool operator==(const Key& rhs)const{return k1 == rhs.k1 && k2 == rhs.k2;}
+  };
+
+  struct QueueEntry
+  {
+    Key     key;
+    int     node;
+
+    bool operator>(const QueueEntry& rhs)const{return rhs.key < key;}
+  };
+
+  typedef std::priority_queue<QueueEntry,
+                              std::vector<QueueEntry>,
+                              std::greater<QueueEntry> > Queue;
+
+private:
+
+  const graph_type&         m_Graph;
+
+  //indexed by node. The cost of the way to the target as last settled (g)
+  //and as its neighbors make it now (rhs). A node whose two costs differ
+  //is on the queue
+  std::vector<double>       m_Costs;
+  std::vector<double>       m_Lookahead;
+
+  //indexed by node. Whether the node is on the queue and with which key.
+  //The queue is never searched: an entry is just passed over when it is
+  //popped if it is not the node's current one
+  std::vector<char>         m_bQueued;
+  std::vector<Key>          m_Keys;
+
+  Queue                     m_Queue;
+
+  int                       m_iSource;
+  int                       m_iTarget;
+
+  //the source when the keys of the nodes on the queue were worked out and
+  //the amount the keys have fallen behind since (km)
+  int                       m_iLastSource;
+  double                    m_dKeyModifier;
+
+  //the search relies on the heuristic never being more than the cost of an
+  //edge between the nodes (see Heuristic_ShavedEuclid)
+  double Heuristic(int nd1, int nd2)const
+  {
+    return heuristic::Calculate(m_Graph, nd1, nd2);
+  }
+
+  Key   CalculateKey(int nd)const
+  {
+    const double cost = m_Costs[nd] < m_Lookahead[nd] ? m_Costs[nd] : m_Lookahead[nd];
+
+    Key key = {cost + Heuristic(m_iSource, nd) + m_dKeyModifier, cost};
+
+    return key;
+  }
+
+  void  Push(int nd)
+  {
+    m_Keys[nd]    = CalculateKey(nd);
+    m_bQueued[nd] = true;
+
+    QueueEntry entry = {m_Keys[nd], nd};
+
+    m_Queue.push(entry);
+  }
+
+  //pops the entries which are no longer current. Returns false if the
+  //queue is empty
+  bool  SkipStaleEntries()
+  {
+    while (!m_Queue.empty())
+    {
+      const QueueEntry& top = m_Queue.top();
+
+      if (m_bQueued[top.node] && m_Keys[top.node] == top.key) return true;
+
+      m_Queue.pop();
+    }
+
+    return false;
+  }
+
+  //works the lookahead cost of the node out again from its neighbors and
+  //puts it on or takes it off the queue accordingly
+  void  UpdateNode(int nd);
+
+  //the neighbor the way from the node goes to next, or -1 if none
+  int   BestNeighbor(int nd, const Edge** ppEdge)const;
+
+public:
+
+  Graph_SearchDStarLite_TS(const graph_type& G,
+                           int               source,
+                           int               target):Graph_SearchTimeSliced<Edge>(Graph_SearchTimeSliced<Edge>::AStar),
+                                                     m_Graph(G),
+                                                     m_Costs(G.NumNodes(), MaxDouble),
+                                                     m_Lookahead(G.NumNodes(), MaxDouble),
+                                                     m_bQueued(G.NumNodes(), false),
+                                                     m_Keys(G.NumNodes()),
+                                                     m_iSource(source),
+                                                     m_iTarget(target),
+                                                     m_iLastSource(source),
+                                                     m_dKeyModifier(0)
+  {
+    assert (!G.isDigraph() && "<Graph_SearchDStarLite_TS::ctor>: the graph must be undirected");
+
+    m_Lookahead[m_iTarget] = 0;
+
+    Push(m_iTarget);
+  }
+
+  int                      CycleOnce();
+
+  //moves the source. What has been found so far still holds. The counts
+  //of cycles and nodes expanded start again
+  void                     SetSource(int source)
+  {
+    m_dKeyModifier += Heuristic(m_iLastSource, source);
+
+    m_iLastSource = m_iSource = source;
+
+    this->m_iNumCycles        = 0;
+    this->m_iNumNodesExpanded = 0;
+  }
+
+  int                      GetTarget()const{return m_iTarget;}
+
+  void                     EdgeCostChanged(int from, int to)
+  {
+    UpdateNode(from);
+    UpdateNode(to);
+  }
+
+  //for each node reached, the edge leading on from it
+  std::vector<const Edge*> GetSPT()const;
+
+  std::list<int>           GetPathToTarget()const;
+
+  std::list<PathEdge>      GetPathAsPathEdges()const;
+
+  double                   GetCostToTarget()const{return m_Costs[m_iSource];}
+};
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+void Graph_SearchDStarLite_TS<graph_type, heuristic>::UpdateNode(int nd)
+{
+  if (nd != m_iTarget)
+  {
+    const Edge* pE;
+
+    int next = BestNeighbor(nd, &pE);
+
+    m_Lookahead[nd] = next < 0 ? MaxDouble : m_Costs[next] + pE->Cost();
+  }
+
+  m_bQueued[nd] = false;
+
+  if (m_Costs[nd] != m_Lookahead[nd]) Push(nd);
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+int Graph_SearchDStarLite_TS<graph_type, heuristic>::BestNeighbor(int nd, const Edge** ppEdge)const
+{
+  int    best     = -1;
+  double BestCost = MaxDouble;
+
+  typename graph_type::ConstEdgeIterator ConstEdgeItr(m_Graph, nd);
+  for (const Edge* pE=ConstEdgeItr.begin();
+      !ConstEdgeItr.end();
+       pE=ConstEdgeItr.next())
+  {
+    if (m_Costs[pE->To()] == MaxDouble) continue;
+
+    double cost = m_Costs[pE->To()] + pE->Cost();
+
+    if (cost < BestCost)
+    {
+      best     = pE->To();
+      BestCost = cost;
+      *ppEdge  = pE;
+    }
+  }
+
+  return best;
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+int Graph_SearchDStarLite_TS<graph_type, heuristic>::CycleOnce()
+{
+  ++this->m_iNumCycles;
+
+  //the search is over when the source has settled and no node on the
+  //queue could give it a cheaper way
+  const bool bEmpty = !SkipStaleEntries();
+
+  if ((bEmpty || !(m_Queue.top().key < CalculateKey(m_iSource))) &&
+      m_Costs[m_iSource] == m_Lookahead[m_iSource])
+  {
+    return m_Costs[m_iSource] == MaxDouble ? target_not_found : target_found;
+  }
+
+  if (bEmpty) return target_not_found;
+
+  const int  nd     = m_Queue.top().node;
+  const Key  OldKey = m_Queue.top().key;
+  const Key  NewKey = CalculateKey(nd);
+
+  m_Queue.pop();
+  m_bQueued[nd] = false;
+
+  ++this->m_iNumNodesExpanded;
+
+  //the key was worked out for an earlier source
+  if (OldKey < NewKey)
+  {
+    Push(nd);
+  }
+
+  //the node's cost has fallen. It is settled and its neighbors may now
+  //have cheaper ways through it
+  else if (m_Costs[nd] > m_Lookahead[nd])
+  {
+    m_Costs[nd] = m_Lookahead[nd];
+
+    typename graph_type::ConstEdgeIterator ConstEdgeItr(m_Graph, nd);
+    for (const Edge* pE=ConstEdgeItr.begin();
+        !ConstEdgeItr.end();
+         pE=ConstEdgeItr.next())
+    {
+      UpdateNode(pE->To());
+    }
+  }
+
+  //the node's cost has risen. Its neighbors, and it, must look again
+  else
+  {
+    m_Costs[nd] = MaxDouble;
+
+    typename graph_type::ConstEdgeIterator ConstEdgeItr(m_Graph, nd);
+    for (const Edge* pE=ConstEdgeItr.begin();
+        !ConstEdgeItr.end();
+         pE=ConstEdgeItr.next())
+    {
+      UpdateNode(pE->To());
+    }
+
+    UpdateNode(nd);
+  }
+
+  return search_incomplete;
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+std::vector<const typename graph_type::EdgeType*>
+Graph_SearchDStarLite_TS<graph_type, heuristic>::GetSPT()const
+{
+  std::vector<const Edge*> spt(m_Graph.NumNodes());
+
+  for (int nd=0; nd<m_Graph.NumNodes(); ++nd)
+  {
+    const Edge* pE;
+
+    if (nd != m_iTarget && m_Costs[nd] != MaxDouble && BestNeighbor(nd, &pE) >= 0)
+    {
+      spt[nd] = pE;
+    }
+  }
+
+  return spt;
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+std::list<int>
+Graph_SearchDStarLite_TS<graph_type, heuristic>::GetPathToTarget()const
+{
+  std::list<int> path;
+
+  if (m_Costs[m_iSource] == MaxDouble) return path;
+
+  int nd = m_iSource;
+
+  path.push_back(nd);
+
+  while (nd != m_iTarget)
+  {
+    assert ((int)path.size() <= m_Graph.NumNodes() &&
+            "<Graph_SearchDStarLite_TS::GetPathToTarget>: the path has a loop");
+
+    const Edge* pE;
+
+    nd = BestNeighbor(nd, &pE);
+
+    if (nd < 0) break;
+
+    path.push_back(nd);
+  }
+
+  return path;
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+std::list<PathEdge>
+Graph_SearchDStarLite_TS<graph_type, heuristic>::GetPathAsPathEdges()const
+{
+  std::list<PathEdge> path;
+
+  if (m_Costs[m_iSource] == MaxDouble) return path;
+
+  int nd = m_iSource;
+
+  while (nd != m_iTarget)
+  {
+    assert ((int)path.size() < m_Graph.NumNodes() &&
+            "<Graph_SearchDStarLite_TS::GetPathAsPathEdges>: the path has a loop");
+
+    const Edge* pE;
+
+    nd = BestNeighbor(nd, &pE);
+
+    if (nd < 0) break;
+
+    path.push_back(PathEdge(m_Graph.GetNode(pE->From()).Pos(),
+                            m_Graph.GetNode(pE->To()).Pos(),
+                            pE->Flags(),
+                            pE->IDofIntersectingEntity(),
+                            pE->Clearance()));
+  }
+
+  return path;
+}
+
+//-------------------- Graph_SearchBidirectionalAStar_TS ----------------------
+//
+//  A* run from the source and from the target at once, one node from each
+//  side in turn, until the cheapest way through a node reached by both
+//  can no longer be beaten. Each side only has to search about half as far
+//  as a single search would, which on an open map is about half as many
+//  nodes. The graph must be undirected.
+//
+//  like Graph_SearchAStar_TS it can be given a cost bound, beyond which it
+//  gives up as soon as it can tell no path will do.
+//
+//  a node is never reopened once closed, and the search stops and gives up
+//  on the strength of the heuristic, so the heuristic must never be more
+//  than the cost of an edge between the nodes (see Heuristic_ShavedEuclid)
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+class Graph_SearchBidirectionalAStar_TS : public Graph_SearchTimeSliced<typename graph_type::EdgeType>
+{
+private:
+
+  typedef typename graph_type::EdgeType Edge;
+
+  enum {forward, backward};
+
+  //what one side of the search keeps. The edges of the backward side run
+  //from the node nearer the target
+  struct Side
+  {
+    std::vector<double>            GCosts;
+    std::vector<double>            FCosts;
+
+    std::vector<const Edge*>       SearchFrontier;
+    std::vector<char>              bReached;
+    std::vector<char>              bClosed;
+
+    IndexedPriorityQLow<double>*   pPQ;
+
+    //the node the side heads for
+    int                            iGoal;
+
+    Side(int NumNodes, int start, int goal):GCosts(NumNodes, 0.0),
+                                            FCosts(NumNodes, 0.0),
+                                            SearchFrontier(NumNodes),
+                                            bReached(NumNodes, false),
+                                            bClosed(NumNodes, false),
+                                            iGoal(goal)
+    {
+      pPQ = new IndexedPriorityQLow<double>(FCosts, NumNodes);
+
+      bReached[start] = true;
+
+      pPQ->insert(start);
+    }
+
+    ~Side(){delete pPQ;}
+
+  private:
+
+    Side(const Side&);
+    Side& operator=(const Side&);
+  };
+
+private:
+
+  const graph_type&  m_Graph;
+
+  int                m_iSource;
+  int                m_iTarget;
+
+  double             m_dCostBound;
+
+  Side               m_Forward;
+  Side               m_Backward;
+
+  Side&              GetSide(int side){return side == forward ? m_Forward : m_Backward;}
+
+  //the side to expand next
+  int                m_iNextSide;
+
+  //the cheapest way found so far and the node where its two halves meet
+  double             m_dBestCost;
+  int                m_iMeetingNode;
+
+  //the search is over
+  bool               m_bFinished;
+
+  //no copies. The queues index into the sides' costs
+  Graph_SearchBidirectionalAStar_TS(const Graph_SearchBidirectionalAStar_TS&);
+  Graph_SearchBidirectionalAStar_TS& operator=(const Graph_SearchBidirectionalAStar_TS&);
+
+  //expands the node at the front of one side's queue
+  void Expand(int side);
+
+public:
+
+  Graph_SearchBidirectionalAStar_TS(const graph_type& G,
+                                    int               source,
+                                    int               target,
+                                    double            CostBound = MaxDouble):Graph_SearchTimeSliced<Edge>(Graph_SearchTimeSliced<Edge>::AStar),
+                                                        m_Graph(G),
+                                                        m_iSource(source),
+                                                        m_iTarget(target),
+                                                        m_dCostBound(CostBound),
+                                                        m_Forward(G.NumNodes(), source, target),
+                                                        m_Backward(G.NumNodes(), target, source),
+                                                        m_iNextSide(forward),
+                                                        m_dBestCost(MaxDouble),
+                                                        m_iMeetingNode(-1),
+                                                        m_bFinished(false)
+  {
+    assert (!G.isDigraph() && "<Graph_SearchBidirectionalAStar_TS::ctor>: the graph must be undirected");
+  }
+
+  int                      CycleOnce();
+
+  //the edges each side has found, the backward ones turned round
+  std::vector<const Edge*> GetSPT()const;
+
+  std::list<int>           GetPathToTarget()const;
+
+  std::list<PathEdge>      GetPathAsPathEdges()const;
+
+  double                   GetCostToTarget()const{return m_dBestCost;}
+};
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+void Graph_SearchBidirectionalAStar_TS<graph_type, heuristic>::Expand(int side)
+{
+  Side& s     = GetSide(side);
+  Side& other = GetSide(1 - side);
+
+  int NextClosestNode = s.pPQ->Pop();
+
+  s.bClosed[NextClosestNode] = true;
+
+  ++this->m_iNumNodesExpanded;
+
+  typename graph_type::ConstEdgeIterator ConstEdgeItr(m_Graph, NextClosestNode);
+  for (const Edge* pE=ConstEdgeItr.begin();
+      !ConstEdgeItr.end();
+       pE=ConstEdgeItr.next())
+  {
+    const int to = pE->To();
+
+    if (s.bClosed[to]) continue;
+
+    double GCost = s.GCosts[NextClosestNode] + pE->Cost();
+
+    if (!s.bReached[to] || GCost < s.GCosts[to])
+    {
+      s.GCosts[to]         = GCost;
+      s.FCosts[to]         = GCost + heuristic::Calculate(m_Graph, s.iGoal, to);
+      s.SearchFrontier[to] = pE;
+
+      if (s.bReached[to])
+      {
+        s.pPQ->ChangePriority(to);
+      }
+      else
+      {
+        s.bReached[to] = true;
+
+        s.pPQ->insert(to);
+      }
+
+      //the other side has been here too, so here is a way
+      if (other.bReached[to] && GCost + other.GCosts[to] < m_dBestCost)
+      {
+        m_dBestCost    = GCost + other.GCosts[to];
+        m_iMeetingNode = to;
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+int Graph_SearchBidirectionalAStar_TS<graph_type, heuristic>::CycleOnce()
+{
+  ++this->m_iNumCycles;
+
+  if (!m_bFinished)
+  {
+    if (m_iSource == m_iTarget)
+    {
+      m_dBestCost    = 0;
+      m_iMeetingNode = m_iSource;
+      m_bFinished    = true;
+    }
+
+    //once either side has run dry every way has been seen
+    else if (m_Forward.pPQ->empty() || m_Backward.pPQ->empty())
+    {
+      m_bFinished = true;
+    }
+
+    else
+    {
+      //every way not yet found costs at least the F cost at the front of
+      //either queue
+      const double FwdF  = m_Forward.FCosts[m_Forward.pPQ->Peek()];
+      const double BwdF  = m_Backward.FCosts[m_Backward.pPQ->Peek()];
+      const double Bound = FwdF > BwdF ? FwdF : BwdF;
+
+      if (m_dBestCost <= Bound || Bound > m_dCostBound)
+      {
+        m_bFinished = true;
+      }
+    }
+  }
+
+  if (m_bFinished)
+  {
+    return m_iMeetingNode >= 0 && m_dBestCost <= m_dCostBound ? target_found : target_not_found;
+  }
+
+  Expand(m_iNextSide);
+
+  m_iNextSide = 1 - m_iNextSide;
+
+  return search_incomplete;
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+std::vector<const typename graph_type::EdgeType*>
+Graph_SearchBidirectionalAStar_TS<graph_type, heuristic>::GetSPT()const
+{
+  std::vector<const Edge*> spt(m_Forward.SearchFrontier);
+
+  for (int nd=0; nd<m_Graph.NumNodes(); ++nd)
+  {
+    if (!spt[nd] && m_Backward.SearchFrontier[nd])
+    {
+      spt[nd] = &m_Graph.GetEdge(nd, m_Backward.SearchFrontier[nd]->From());
+    }
+  }
+
+  return spt;
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+std::list<int>
+Graph_SearchBidirectionalAStar_TS<graph_type, heuristic>::GetPathToTarget()const
+{
+  std::list<int> path;
+
+  if (m_iMeetingNode < 0 || m_dBestCost > m_dCostBound) return path;
+
+  int nd = m_iMeetingNode;
+
+  path.push_back(nd);
+
+  while (nd != m_iSource)
+  {
+    nd = m_Forward.SearchFrontier[nd]->From();
+
+    path.push_front(nd);
+  }
+
+  nd = m_iMeetingNode;
+
+  while (nd != m_iTarget)
+  {
+    nd = m_Backward.SearchFrontier[nd]->From();
+
+    path.push_back(nd);
+  }
+
+  return path;
+}
+
+//-----------------------------------------------------------------------------
+template <class graph_type, class heuristic>
+std::list<PathEdge>
+Graph_SearchBidirectionalAStar_TS<graph_type, heuristic>::GetPathAsPathEdges()const
+{
+  std::list<PathEdge> path;
+
+  if (m_iMeetingNode < 0 || m_dBestCost > m_dCostBound) return path;
+
+  int nd = m_iMeetingNode;
+
+  while (nd != m_iSource)
+  {
+    const Edge* pE = m_Forward.SearchFrontier[nd];
+
+    path.push_front(PathEdge(m_Graph.GetNode(pE->From()).Pos(),
+                             m_Graph.GetNode(pE->To()).Pos(),
+                             pE->Flags(),
+                             pE->IDofIntersectingEntity(),
+                             pE->Clearance()));
+
+    nd = pE->From();
+  }
+
+  //the backward side's edges run towards the meeting node, so the edges
+  //of the path are the ones going the other way, which may be flagged
+  //differently
+  nd = m_iMeetingNode;
+
+  while (nd != m_iTarget)
+  {
+    const Edge& E = m_Graph.GetEdge(nd, m_Backward.SearchFrontier[nd]->From());
+
+    path.push_back(PathEdge(m_Graph.GetNode(E.From()).Pos(),
+                            m_Graph.GetNode(E.To()).Pos(),
+                            E.Flags(),
+                            E.IDofIntersectingEntity(),
+                            E.Clearance()));
+
+    nd = E.To();
+  }
+
+  return path;
+}
+
+
 #endif
\ No newline at end of file
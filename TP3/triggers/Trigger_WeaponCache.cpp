@@ -25,16 +25,19 @@ void Trigger_WeaponCache::Try(Raven_Bot *pBot) {
 		if (weapons[type_shotgun] != 0 && pBot->GetWeaponSys()->GetWeaponFromInventory(type_shotgun) == nullptr) {
 			pBot->GetWeaponSys()->AddWeapon(type_shotgun);
 			weapons[type_shotgun]--;
+			pBot->IncrementItemsPickedUp();
 		}
 
 		if (weapons[type_rail_gun] != 0 && pBot->GetWeaponSys()->GetWeaponFromInventory(type_rail_gun) == nullptr) {
 			pBot->GetWeaponSys()->AddWeapon(type_rail_gun);
 			weapons[type_rail_gun]--;
+			pBot->IncrementItemsPickedUp();
 		}
 
 		if (weapons[type_rocket_launcher] != 0 && pBot->GetWeaponSys()->GetWeaponFromInventory(type_rocket_launcher) == nullptr) {
 			pBot->GetWeaponSys()->AddWeapon(type_rocket_launcher);
 			weapons[type_rocket_launcher]--;
+			pBot->IncrementItemsPickedUp();
 		}
 	}
 
@@ -40,6 +40,8 @@ void Trigger_WeaponGiver::Try(Raven_Bot* pBot)
   {
     pBot->GetWeaponSys()->AddWeapon(EntityType());
 
+    pBot->IncrementItemsPickedUp();
+
     Deactivate();
   } 
 }
@@ -59,10 +61,10 @@ void Trigger_WeaponGiver::Read(std::ifstream& in)
   SetGraphNodeIndex(GraphNodeIndex);
 
   //create this trigger's region of fluence
-  AddCircularTriggerRegion(Pos(), script->GetDouble("DefaultGiverTriggerRange"));
+  AddCircularTriggerRegion(Pos(), script->Params().DefaultGiverTriggerRange);
 
 
-  SetRespawnDelay((unsigned int)(script->GetDouble("Weapon_RespawnDelay") * FrameRate));
+  SetRespawnDelay((unsigned int)(script->Params().Weapon_RespawnDelay * FrameRate));
 }
 
 